@@ -5,7 +5,33 @@
 #include "sht3x.h"
 #include "sht4x.h"
 #include "shtc1.h"
-#include "sensirion_humidity_conversion.h "
+#include "sensirion_humidity_conversion.h"
 #include "sensirion_temperature_unit_conversion.h"
+#include "sht_sample.h"
+#include "sht_executor.h"
+#include "sht_frame.h"
+#include "sht3x_fetch_sched.h"
+#include "sht3x_art.h"
+#include "sht_handle.h"
+#include "sht_mux.h"
+#include "sht_wheel.h"
+#include "sht_bus_sched.h"
+#include "sht_bus_plan.h"
+#include "sht_clock.h"
+#include "sht_softi2c.h"
+#include "sht_sysfs.h"
+#include "sht_cobs.h"
+#include "sht_cbor.h"
+#include "sht_influx.h"
+#include "sht_mqtt.h"
+#include "sht_pack.h"
+#include "sht_flash_log.h"
+#include "sht_registry.h"
+#include "sht_batch.h"
+#include "sht_presence.h"
+#include "sht_breaker.h"
+#include "sht_buslock.h"
+#include "sht_hist.h"
+#include "sht_units.h"
 
 #endif
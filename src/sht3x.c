@@ -41,6 +41,7 @@
 #include "sht3x.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sht_frame.h"
 #include <sensirion-embedded-common.h>
 
 /* all measurement commands return T (CRC) RH (CRC) */
@@ -72,6 +73,21 @@ static const uint16_t SHT3X_CMD_WRITE_HIALRT_LIM_CLR = 0x6116;
 static const uint16_t SHT3X_CMD_WRITE_LOALRT_LIM_CLR = 0x610B;
 static const uint16_t SHT3X_CMD_WRITE_LOALRT_LIM_SET = 0x6100;
 
+/* periodic data acquisition commands, rows by rate, columns by mode */
+static const uint16_t SHT3X_CMD_PERIODIC[5][3] = {
+    /* LPM     MPM     HPM */
+    {0x202F, 0x2024, 0x2032}, /* 0.5 mps */
+    {0x212D, 0x2126, 0x2130}, /* 1 mps */
+    {0x222B, 0x2220, 0x2236}, /* 2 mps */
+    {0x2329, 0x2322, 0x2334}, /* 4 mps */
+    {0x272A, 0x2721, 0x2737}, /* 10 mps */
+};
+static const uint32_t SHT3X_PERIODIC_INTERVAL_USEC[6] = {
+    2000000, 1000000, 500000, 250000, 100000, 250000 /* ART */};
+static const uint16_t SHT3X_CMD_ART = 0x2B32;
+static const uint16_t SHT3X_CMD_FETCH_DATA = 0xE000;
+static const uint16_t SHT3X_CMD_BREAK = 0x3093;
+
 static uint16_t sht3x_cmd_measure = SHT3X_CMD_MEASURE_HPM;
 
 int16_t sht3x_measure_blocking_read(sht3x_i2c_addr_t addr, int32_t* temperature,
@@ -92,20 +108,79 @@ int16_t sht3x_measure(sht3x_i2c_addr_t addr) {
 
 int16_t sht3x_read(sht3x_i2c_addr_t addr, int32_t* temperature,
                    int32_t* humidity) {
-    uint16_t words[2];
-    int16_t ret =
-        sensirion_i2c_read_words(addr, words, SENSIRION_NUM_WORDS(words));
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    int16_t ret = sht3x_read_ticks(addr, &t_ticks, &rh_ticks);
+    if (ret != STATUS_OK)
+        return ret;
     /**
      * formulas for conversion of the sensor signals, optimized for fixed point
      * algebra: Temperature = 175 * S_T / 2^16 - 45
      * Relative Humidity = * 100 * S_RH / 2^16
      */
-    tick_to_temperature(words[0], temperature);
-    tick_to_humidity(words[1], humidity);
+    tick_to_temperature(t_ticks, temperature);
+    tick_to_humidity(rh_ticks, humidity);
 
     return ret;
 }
 
+int16_t sht3x_read_ticks(sht3x_i2c_addr_t addr, uint16_t* t_ticks,
+                         uint16_t* rh_ticks) {
+    uint8_t data[SHT_FRAME_MEASUREMENT_SIZE];
+    int16_t ret = sensirion_i2c_read(addr, data, sizeof(data));
+    if (ret != STATUS_OK)
+        return ret;
+
+    return sht_frame_unpack_ticks(data, t_ticks, rh_ticks);
+}
+
+int16_t sht3x_start_periodic_measurement(sht3x_i2c_addr_t addr,
+                                         sht3x_periodic_rate_t rate,
+                                         sht3x_measurement_mode_t mode) {
+    if (rate == SHT3X_PERIODIC_ART)
+        return sensirion_i2c_write_cmd(addr, SHT3X_CMD_ART);
+
+    if ((unsigned)rate > SHT3X_PERIODIC_10_MPS ||
+        (unsigned)mode > SHT3X_MEAS_MODE_HPM)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    return sensirion_i2c_write_cmd(addr, SHT3X_CMD_PERIODIC[rate][mode]);
+}
+
+int16_t sht3x_stop_periodic_measurement(sht3x_i2c_addr_t addr) {
+    return sensirion_i2c_write_cmd(addr, SHT3X_CMD_BREAK);
+}
+
+int16_t sht3x_fetch(sht3x_i2c_addr_t addr, int32_t* temperature,
+                    int32_t* humidity) {
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    int16_t ret = sht3x_fetch_ticks(addr, &t_ticks, &rh_ticks);
+    if (ret != STATUS_OK)
+        return ret;
+
+    tick_to_temperature(t_ticks, temperature);
+    tick_to_humidity(rh_ticks, humidity);
+
+    return ret;
+}
+
+int16_t sht3x_fetch_ticks(sht3x_i2c_addr_t addr, uint16_t* t_ticks,
+                          uint16_t* rh_ticks) {
+    int16_t ret = sensirion_i2c_write_cmd(addr, SHT3X_CMD_FETCH_DATA);
+    if (ret != STATUS_OK)
+        return ret;
+
+    return sht3x_read_ticks(addr, t_ticks, rh_ticks);
+}
+
+uint32_t sht3x_periodic_interval_usec(sht3x_periodic_rate_t rate) {
+    if ((unsigned)rate > SHT3X_PERIODIC_ART)
+        return 0;
+
+    return SHT3X_PERIODIC_INTERVAL_USEC[rate];
+}
+
 int16_t sht3x_probe(sht3x_i2c_addr_t addr) {
     uint16_t status;
     return sensirion_i2c_delayed_read_cmd(addr, SHT3X_CMD_READ_STATUS_REG,
@@ -79,6 +79,21 @@ typedef enum _sht3x_measurement_mode {
     SHT3X_MEAS_MODE_HPM  /*high power mode*/
 } sht3x_measurement_mode_t;
 
+/**
+ * @brief SHT3x periodic data acquisition rates in measurements per second.
+ * SHT3X_PERIODIC_ART selects the accelerated response time mode, which
+ * measures at 4 mps with a faster response to changes; it ignores the
+ * repeatability setting.
+ */
+typedef enum _sht3x_periodic_rate {
+    SHT3X_PERIODIC_0_5_MPS,
+    SHT3X_PERIODIC_1_MPS,
+    SHT3X_PERIODIC_2_MPS,
+    SHT3X_PERIODIC_4_MPS,
+    SHT3X_PERIODIC_10_MPS,
+    SHT3X_PERIODIC_ART
+} sht3x_periodic_rate_t;
+
 /**
  * @brief SHT3x Alert Thresholds
  */
@@ -166,6 +181,91 @@ int16_t sht3x_measure(sht3x_i2c_addr_t addr);
 int16_t sht3x_read(sht3x_i2c_addr_t addr, int32_t* temperature,
                    int32_t* humidity);
 
+/**
+ * @brief Reads out the raw ticks of a measurement that was previously started
+ * by sht3x_measure(). The CRC check and the word unpacking are done in a single
+ * pass over the received bytes. Use tick_to_temperature() and
+ * tick_to_humidity() to convert the ticks.
+ *
+ * @param[in]  addr the sensor address
+ * @param[out] t_ticks   the address for the temperature ticks
+ * @param[out] rh_ticks  the address for the relative humidity ticks
+ *
+ * @return              0 if the command was successful, else an error code.
+ */
+int16_t sht3x_read_ticks(sht3x_i2c_addr_t addr, uint16_t* t_ticks,
+                         uint16_t* rh_ticks);
+
+/**
+ * @brief Starts the periodic data acquisition. The sensor measures on its own
+ * at the given rate; use sht3x_fetch() to read out the latest measurement and
+ * sht3x_stop_periodic_measurement() to go back to single shot mode.
+ *
+ * Switching between rates, including to and from ART, requires stopping the
+ * running acquisition first.
+ *
+ * @param[in] addr the sensor address
+ * @param[in] rate the measurement rate, or SHT3X_PERIODIC_ART
+ * @param[in] mode the repeatability (power mode) of the measurements
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_start_periodic_measurement(sht3x_i2c_addr_t addr,
+                                         sht3x_periodic_rate_t rate,
+                                         sht3x_measurement_mode_t mode);
+
+/**
+ * @brief Stops the periodic data acquisition (break command). The sensor
+ * accepts new commands again after 1 ms.
+ *
+ * @param[in] addr the sensor address
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_stop_periodic_measurement(sht3x_i2c_addr_t addr);
+
+/**
+ * @brief Fetches the latest measurement of the periodic data acquisition.
+ * If no new measurement is available since the last fetch, the sensor does
+ * not acknowledge the read and an error is returned.
+ * Temperature is returned in [degree Celsius], multiplied by 1000,
+ * and relative humidity in [percent relative humidity], multiplied by 1000.
+ *
+ * @param[in]  addr the sensor address
+ * @param[out] temperature   the address for the result of the temperature
+ * measurement
+ * @param[out] humidity      the address for the result of the relative humidity
+ * measurement
+ *
+ * @return              0 if the command was successful, else an error code.
+ */
+int16_t sht3x_fetch(sht3x_i2c_addr_t addr, int32_t* temperature,
+                    int32_t* humidity);
+
+/**
+ * @brief Fetches the raw ticks of the latest measurement of the periodic data
+ * acquisition, see sht3x_fetch().
+ *
+ * @param[in]  addr the sensor address
+ * @param[out] t_ticks   the address for the temperature ticks
+ * @param[out] rh_ticks  the address for the relative humidity ticks
+ *
+ * @return              0 if the command was successful, else an error code.
+ */
+int16_t sht3x_fetch_ticks(sht3x_i2c_addr_t addr, uint16_t* t_ticks,
+                          uint16_t* rh_ticks);
+
+/**
+ * @brief Return the nominal interval between two measurements of the periodic
+ * data acquisition. The actual interval deviates with the sensor's internal
+ * oscillator.
+ *
+ * @param[in] rate the measurement rate
+ *
+ * @return the interval in microseconds
+ */
+uint32_t sht3x_periodic_interval_usec(sht3x_periodic_rate_t rate);
+
 /**
  * @brief Enable or disable the SHT's low power mode
  *
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Dynamic ART switching implementation
+ */
+
+#include "sht3x_art.h"
+#include "sensirion_i2c.h"
+
+static const uint32_t SHT3X_ART_BREAK_DURATION_USEC = 1000;
+/* measurements further apart do not tell a rate of change */
+static const uint32_t SHT3X_ART_MAX_INTERVAL_MS = 60000;
+
+static uint32_t sht3x_art_abs_diff(int32_t a, int32_t b) {
+    return a > b ? (uint32_t)(a - b) : (uint32_t)(b - a);
+}
+
+/* d milli-units over dt_ms exceeds rate milli-units per second; in 64 bits,
+ * as at the 60 s cap rate * dt_ms overflows 32 bits from 71.6 units/s on */
+static uint8_t sht3x_art_exceeds(uint32_t d, uint32_t dt_ms, uint32_t rate) {
+    return (uint64_t)d * 1000U > (uint64_t)rate * dt_ms;
+}
+
+int16_t sht3x_art_set(const sht3x_art_policy_t* policy,
+                      sht3x_art_state_t* state, uint8_t art) {
+    int16_t ret = sht3x_stop_periodic_measurement(state->addr);
+    if (ret != STATUS_OK)
+        return ret;
+
+    sensirion_sleep_usec(SHT3X_ART_BREAK_DURATION_USEC);
+    if (art)
+        ret = sht3x_start_periodic_measurement(
+            state->addr, SHT3X_PERIODIC_ART, policy->base_mode);
+    else
+        ret = sht3x_start_periodic_measurement(
+            state->addr, policy->base_rate, policy->base_mode);
+    if (ret != STATUS_OK)
+        return ret;
+
+    state->art = art ? 1 : 0;
+    state->switches++;
+    return ret;
+}
+
+int16_t sht3x_art_init(const sht3x_art_policy_t* policy,
+                       sht3x_art_state_t* state, sht3x_i2c_addr_t addr) {
+    state->addr = addr;
+    state->art = 0;
+    state->has_last = 0;
+    state->last_temperature = 0;
+    state->last_humidity = 0;
+    state->last_ms = 0;
+    state->calm_since_ms = 0;
+    state->switches = 0;
+    return sht3x_start_periodic_measurement(addr, policy->base_rate,
+                                            policy->base_mode);
+}
+
+int16_t sht3x_art_update(const sht3x_art_policy_t* policy,
+                         sht3x_art_state_t* state, uint32_t now_ms,
+                         int32_t temperature, int32_t humidity,
+                         sht3x_fetch_sched_entry_t* sched, uint32_t now_usec) {
+    uint32_t dt_ms = now_ms - state->last_ms;
+    uint32_t dt = sht3x_art_abs_diff(temperature, state->last_temperature);
+    uint32_t drh = sht3x_art_abs_diff(humidity, state->last_humidity);
+    uint8_t has_last = state->has_last;
+    uint8_t art = state->art;
+    int16_t ret;
+
+    state->last_temperature = temperature;
+    state->last_humidity = humidity;
+    state->last_ms = now_ms;
+    state->has_last = 1;
+    if (!has_last || dt_ms == 0 || dt_ms > SHT3X_ART_MAX_INTERVAL_MS)
+        return STATUS_OK;
+
+    if (!state->art) {
+        if (sht3x_art_exceeds(dt, dt_ms, policy->enter_temperature_rate) ||
+            sht3x_art_exceeds(drh, dt_ms, policy->enter_humidity_rate))
+            art = 1;
+    } else if (sht3x_art_exceeds(dt, dt_ms, policy->exit_temperature_rate) ||
+               sht3x_art_exceeds(drh, dt_ms, policy->exit_humidity_rate)) {
+        state->calm_since_ms = now_ms;
+    } else if (now_ms - state->calm_since_ms >= policy->hold_ms) {
+        art = 0;
+    }
+
+    if (art == state->art)
+        return STATUS_OK;
+
+    ret = sht3x_art_set(policy, state, art);
+    if (ret != STATUS_OK)
+        return ret;
+
+    state->calm_since_ms = now_ms;
+    if (sched)
+        ret = sht3x_fetch_sched_init(
+            sched, state->addr, art ? SHT3X_PERIODIC_ART : policy->base_rate,
+            now_usec);
+    return ret;
+}
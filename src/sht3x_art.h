@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Dynamic switching of the SHT3x accelerated response time (ART) mode
+ *
+ * The ART mode tracks fast transients at 4 mps, at the cost of a higher
+ * current than a low rate periodic acquisition. The policy of this module
+ * keeps a sensor in a low rate periodic mode while the signal is stable,
+ * switches it to ART as soon as the rate of change of temperature or
+ * humidity exceeds a threshold, and switches it back once the signal has
+ * stayed below the exit thresholds for a hold time.
+ *
+ * Rates of change are compared without division: a change of d milli-units
+ * over t milliseconds exceeds a threshold of r milli-units per second when
+ * d * 1000 > r * t.
+ */
+
+#ifndef SHT3X_ART_H
+#define SHT3X_ART_H
+
+#include "sht3x.h"
+#include "sht3x_fetch_sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief ART switching thresholds, may be shared by many sensors
+ */
+typedef struct _sht3x_art_policy {
+    sht3x_periodic_rate_t base_rate; /* rate while the signal is stable */
+    sht3x_measurement_mode_t base_mode;
+    uint32_t enter_temperature_rate; /* 1000*°C per second */
+    uint32_t enter_humidity_rate;    /* 1000*%RH per second */
+    uint32_t exit_temperature_rate;  /* 1000*°C per second */
+    uint32_t exit_humidity_rate;     /* 1000*%RH per second */
+    uint32_t hold_ms; /* time below the exit rates before leaving ART */
+} sht3x_art_policy_t;
+
+/**
+ * @brief ART switching state of one sensor
+ */
+typedef struct _sht3x_art_state {
+    sht3x_i2c_addr_t addr;
+    uint8_t art;      /* the sensor currently runs in ART */
+    uint8_t has_last; /* last_* hold a previous measurement */
+    int32_t last_temperature;
+    int32_t last_humidity;
+    uint32_t last_ms;
+    uint32_t calm_since_ms; /* start of the current stable period */
+    uint32_t switches;      /* number of mode switches */
+} sht3x_art_state_t;
+
+/**
+ * @brief Initialize the state of a sensor and start its periodic acquisition
+ * in the base mode of the policy
+ *
+ * @param[in]  policy the policy
+ * @param[out] state  the state of the sensor
+ * @param[in]  addr   the sensor address
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht3x_art_init(const sht3x_art_policy_t* policy,
+                       sht3x_art_state_t* state, sht3x_i2c_addr_t addr);
+
+/**
+ * @brief Feed a new measurement to the policy and switch the sensor between
+ * the base mode and ART if needed. Switching stops the running acquisition,
+ * waits 1 ms and starts the new one.
+ *
+ * @param[in] policy      the policy
+ * @param[in] state       the state of the sensor
+ * @param[in] now_ms      the time of the measurement in milliseconds
+ * @param[in] temperature the temperature in 1000*°C
+ * @param[in] humidity    the relative humidity in 1000*%RH
+ * @param[in] sched       the fetch schedule of the sensor, re-initialized on a
+ *                        switch; may be NULL
+ * @param[in] now_usec    the current time for the fetch schedule
+ *
+ * @return 0 if no switch was needed or the switch was successful, else an
+ * error code
+ */
+int16_t sht3x_art_update(const sht3x_art_policy_t* policy,
+                         sht3x_art_state_t* state, uint32_t now_ms,
+                         int32_t temperature, int32_t humidity,
+                         sht3x_fetch_sched_entry_t* sched, uint32_t now_usec);
+
+/**
+ * @brief Switch a sensor to or from ART explicitly
+ *
+ * @param[in] policy the policy providing the base mode
+ * @param[in] state  the state of the sensor
+ * @param[in] art    1 to enable ART, 0 to go back to the base mode
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht3x_art_set(const sht3x_art_policy_t* policy,
+                      sht3x_art_state_t* state, uint8_t art);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT3X_ART_H */
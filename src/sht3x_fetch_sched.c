@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Phase-locked fetch scheduling implementation
+ */
+
+#include "sht3x_fetch_sched.h"
+
+/* wrap-around safe "a is at or after b" */
+#define SHT3X_FETCH_SCHED_AFTER(a, b) ((int32_t)((uint32_t)(a) - (b)) >= 0)
+
+/* bracketing step while searching the first edge */
+static uint32_t
+sht3x_fetch_sched_coarse_step(const sht3x_fetch_sched_entry_t* e) {
+    return e->period_usec / 16;
+}
+
+/* bracketing step and guard time once locked */
+static uint32_t
+sht3x_fetch_sched_fine_step(const sht3x_fetch_sched_entry_t* e) {
+    uint32_t step = e->period_usec / 64;
+    return step > SHT3X_FETCH_SCHED_MIN_STEP_USEC
+               ? step
+               : SHT3X_FETCH_SCHED_MIN_STEP_USEC;
+}
+
+static void sht3x_fetch_sched_plan(sht3x_fetch_sched_entry_t* e) {
+    uint32_t guard = sht3x_fetch_sched_fine_step(e);
+
+    if (e->streak >= e->probe_interval) {
+        e->state = SHT3X_FETCH_SCHED_PROBE;
+        e->next_usec =
+            e->edge_usec + e->period_usec - (guard << e->probe_shift);
+    } else {
+        e->state = SHT3X_FETCH_SCHED_LOCKED;
+        e->next_usec = e->edge_usec + e->period_usec + guard;
+    }
+}
+
+static void sht3x_fetch_sched_bracketed(sht3x_fetch_sched_entry_t* e,
+                                        uint32_t now_usec) {
+    uint32_t predicted = e->edge_usec + e->period_usec;
+    uint32_t edge = e->nack_usec + (now_usec - e->nack_usec) / 2;
+    uint32_t guard = sht3x_fetch_sched_fine_step(e);
+    uint32_t elapsed;
+    uint32_t periods;
+    int32_t error;
+
+    if (e->has_ref) {
+        elapsed = edge - e->ref_usec;
+        periods = (elapsed + e->period_usec / 2) / e->period_usec;
+        if (periods) {
+            error = (int32_t)(elapsed / periods - e->period_usec);
+            /* reject brackets that do not fit the period, e.g. after a
+             * missed fetch spanning an unknown number of periods; an
+             * oscillator going from -5% to +10% moves it by 15% */
+            if (error < (int32_t)(e->period_usec / 4) &&
+                error > -(int32_t)(e->period_usec / 4))
+                e->period_usec =
+                    (uint32_t)((int32_t)e->period_usec + error / 2);
+        }
+    }
+
+    error = (int32_t)(edge - predicted);
+    if (e->state == SHT3X_FETCH_SCHED_PROBE && error < (int32_t)guard &&
+        error > -(int32_t)guard) {
+        /* the prediction holds, probe less often */
+        if (e->probe_interval < SHT3X_FETCH_SCHED_MAX_PROBE_INTERVAL)
+            e->probe_interval *= 2;
+    } else {
+        e->probe_interval = 1;
+    }
+
+    e->edge_usec = edge;
+    e->ref_usec = edge;
+    e->has_ref = 1;
+    e->nacked = 0;
+    e->streak = 0;
+    e->probe_shift = 0;
+}
+
+int16_t sht3x_fetch_sched_init(sht3x_fetch_sched_entry_t* entry,
+                               sht3x_i2c_addr_t addr,
+                               sht3x_periodic_rate_t rate,
+                               uint32_t start_usec) {
+    uint32_t period_usec = sht3x_periodic_interval_usec(rate);
+
+    /* every step and guard time is derived from the period */
+    if (!period_usec)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    entry->addr = addr;
+    entry->period_usec = period_usec;
+    entry->edge_usec = start_usec;
+    entry->ref_usec = start_usec;
+    entry->nack_usec = start_usec;
+    entry->next_usec = start_usec + sht3x_fetch_sched_coarse_step(entry);
+    entry->streak = 0;
+    entry->probe_interval = 1;
+    entry->probe_shift = 0;
+    entry->state = SHT3X_FETCH_SCHED_ACQUIRE;
+    entry->nacked = 0;
+    entry->has_ref = 0;
+    entry->fetches = 0;
+    entry->wasted = 0;
+    return STATUS_OK;
+}
+
+void sht3x_fetch_sched_report(sht3x_fetch_sched_entry_t* entry,
+                              uint32_t now_usec, int16_t ret) {
+    uint32_t periods;
+
+    entry->fetches++;
+
+    if (ret != STATUS_OK) {
+        entry->wasted++;
+        entry->nacked = 1;
+        entry->nack_usec = now_usec;
+        if (entry->state != SHT3X_FETCH_SCHED_ACQUIRE &&
+            (now_usec - entry->edge_usec) > 2 * entry->period_usec) {
+            /* no data for two periods: the sensor restarted or stopped */
+            entry->state = SHT3X_FETCH_SCHED_ACQUIRE;
+            entry->has_ref = 0;
+        }
+        if (entry->state == SHT3X_FETCH_SCHED_ACQUIRE) {
+            entry->next_usec = now_usec + sht3x_fetch_sched_coarse_step(entry);
+        } else {
+            entry->state = SHT3X_FETCH_SCHED_PROBE;
+            entry->next_usec = now_usec + sht3x_fetch_sched_fine_step(entry);
+        }
+        return;
+    }
+
+    if (entry->nacked) {
+        sht3x_fetch_sched_bracketed(entry, now_usec);
+    } else if (entry->state == SHT3X_FETCH_SCHED_ACQUIRE) {
+        /* the edge lies somewhere in the past, step towards the next one */
+        entry->edge_usec = now_usec;
+        entry->next_usec = now_usec + sht3x_fetch_sched_coarse_step(entry);
+        return;
+    } else {
+        periods = (now_usec - entry->edge_usec) / entry->period_usec;
+        if (periods == 0 || entry->state == SHT3X_FETCH_SCHED_PROBE) {
+            /* data was ready before the predicted edge, which is therefore
+             * late: use the fetch time as upper bound and probe again,
+             * leading further */
+            if (entry->state == SHT3X_FETCH_SCHED_PROBE &&
+                (sht3x_fetch_sched_fine_step(entry)
+                 << (entry->probe_shift + 1)) < entry->period_usec / 2)
+                entry->probe_shift++;
+            entry->edge_usec = now_usec;
+            entry->probe_interval = 1;
+            entry->streak = entry->probe_interval;
+        } else {
+            entry->edge_usec += periods * entry->period_usec;
+            entry->streak++;
+        }
+    }
+    sht3x_fetch_sched_plan(entry);
+}
+
+int16_t sht3x_fetch_sched_fetch(sht3x_fetch_sched_entry_t* entry,
+                                uint32_t now_usec, uint16_t* t_ticks,
+                                uint16_t* rh_ticks) {
+    int16_t ret = sht3x_fetch_ticks(entry->addr, t_ticks, rh_ticks);
+    sht3x_fetch_sched_report(entry, now_usec, ret);
+    return ret;
+}
+
+uint16_t sht3x_fetch_sched_due(const sht3x_fetch_sched_entry_t* entries,
+                               uint16_t num_entries, uint32_t now_usec) {
+    uint16_t due = num_entries;
+    uint32_t late = 0;
+    uint32_t l;
+    uint16_t i;
+
+    for (i = 0; i < num_entries; ++i) {
+        if (!SHT3X_FETCH_SCHED_AFTER(now_usec, entries[i].next_usec))
+            continue;
+        l = now_usec - entries[i].next_usec;
+        if (due == num_entries || l > late) {
+            due = i;
+            late = l;
+        }
+    }
+    return due;
+}
+
+uint32_t sht3x_fetch_sched_idle_usec(const sht3x_fetch_sched_entry_t* entries,
+                                     uint16_t num_entries, uint32_t now_usec) {
+    uint32_t idle = UINT32_MAX;
+    uint32_t d;
+    uint16_t i;
+
+    for (i = 0; i < num_entries; ++i) {
+        if (SHT3X_FETCH_SCHED_AFTER(now_usec, entries[i].next_usec))
+            return 0;
+        d = entries[i].next_usec - now_usec;
+        if (d < idle)
+            idle = d;
+    }
+    return idle;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Phase-locked fetch scheduling for the SHT3x periodic mode
+ *
+ * In periodic mode the SHT3x measures on its own clock and NACKs a fetch if
+ * no new measurement is ready, wasting a bus transaction. The scheduler
+ * tracks, per sensor, the instant new data becomes ready (the data edge) and
+ * the actual measurement period, which deviates from the nominal one with the
+ * sensor's oscillator. Fetches are placed a small guard time after the
+ * predicted edge, which keeps both the wasted fetches and the sample age low.
+ *
+ * The edge is located by bracketing: a NACK followed by a successful fetch a
+ * step later pins it within one step. Once locked, the scheduler deliberately
+ * fetches slightly before the predicted edge every probe_interval periods to
+ * re-bracket it; the interval doubles while the predictions stay accurate, so
+ * a well locked sensor costs about one wasted fetch every
+ * SHT3X_FETCH_SCHED_MAX_PROBE_INTERVAL periods. A probe that already finds new
+ * data means the sensor runs faster than predicted; the next probe then leads
+ * the predicted edge twice as far.
+ *
+ * All times are microseconds of a free running 32 bit clock, wrap-around is
+ * handled. One schedule drives the sensors of one bus; the application selects
+ * the bus before servicing it.
+ */
+
+#ifndef SHT3X_FETCH_SCHED_H
+#define SHT3X_FETCH_SCHED_H
+
+#include "sht3x.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Lower bound of the bracketing step and of the guard time
+ */
+#ifndef SHT3X_FETCH_SCHED_MIN_STEP_USEC
+#define SHT3X_FETCH_SCHED_MIN_STEP_USEC 500
+#endif
+
+/**
+ * @brief Upper bound, in periods, of the interval between two probes
+ */
+#ifndef SHT3X_FETCH_SCHED_MAX_PROBE_INTERVAL
+#define SHT3X_FETCH_SCHED_MAX_PROBE_INTERVAL 64
+#endif
+
+/**
+ * @brief Locking state of a tracked sensor
+ */
+typedef enum _sht3x_fetch_sched_state {
+    SHT3X_FETCH_SCHED_ACQUIRE, /* searching the first data edge */
+    SHT3X_FETCH_SCHED_LOCKED,  /* fetching just after the predicted edge */
+    SHT3X_FETCH_SCHED_PROBE    /* re-bracketing the edge */
+} sht3x_fetch_sched_state_t;
+
+/**
+ * @brief Fetch schedule of one sensor
+ */
+typedef struct _sht3x_fetch_sched_entry {
+    sht3x_i2c_addr_t addr;
+    uint32_t period_usec; /* learned measurement period */
+    uint32_t edge_usec;   /* estimated time of the latest data edge */
+    uint32_t ref_usec;    /* bracketed edge the period is measured from */
+    uint32_t nack_usec;   /* time of the latest NACKed fetch */
+    uint32_t next_usec;   /* time of the next fetch */
+    uint16_t streak;      /* fetches since the last probe */
+    uint16_t probe_interval;
+    uint8_t probe_shift; /* probe lead is guard << probe_shift */
+    uint8_t state;   /* sht3x_fetch_sched_state_t */
+    uint8_t nacked;  /* a NACK precedes the next successful fetch */
+    uint8_t has_ref; /* ref_usec is valid */
+    uint32_t fetches;
+    uint32_t wasted; /* NACKed fetches */
+} sht3x_fetch_sched_entry_t;
+
+/**
+ * @brief Initialize the schedule of a sensor whose periodic data acquisition
+ * was started at start_usec
+ *
+ * @param[out] entry      the schedule
+ * @param[in]  addr       the sensor address
+ * @param[in]  rate       the rate the periodic mode was started with
+ * @param[in]  start_usec the time the periodic mode was started
+ *
+ * @return 0 on success, STATUS_ERR_INVALID_PARAMS if rate is not a
+ * sht3x_periodic_rate_t
+ */
+int16_t sht3x_fetch_sched_init(sht3x_fetch_sched_entry_t* entry,
+                               sht3x_i2c_addr_t addr,
+                               sht3x_periodic_rate_t rate,
+                               uint32_t start_usec);
+
+/**
+ * @brief Update the schedule with the outcome of a fetch
+ *
+ * @param[in] entry     the schedule
+ * @param[in] now_usec  the time the fetch was issued
+ * @param[in] ret       the return code of the fetch
+ */
+void sht3x_fetch_sched_report(sht3x_fetch_sched_entry_t* entry,
+                              uint32_t now_usec, int16_t ret);
+
+/**
+ * @brief Fetch the latest measurement of a sensor and update its schedule
+ *
+ * @param[in]  entry    the schedule
+ * @param[in]  now_usec the current time
+ * @param[out] t_ticks  the address for the temperature ticks
+ * @param[out] rh_ticks the address for the relative humidity ticks
+ *
+ * @return 0 if the fetch was successful, else an error code
+ */
+int16_t sht3x_fetch_sched_fetch(sht3x_fetch_sched_entry_t* entry,
+                                uint32_t now_usec, uint16_t* t_ticks,
+                                uint16_t* rh_ticks);
+
+/**
+ * @brief Find the sensor whose fetch is most overdue
+ *
+ * @param[in] entries     the schedules
+ * @param[in] num_entries the number of schedules
+ * @param[in] now_usec    the current time
+ *
+ * @return the index of the due sensor, num_entries if none is due
+ */
+uint16_t sht3x_fetch_sched_due(const sht3x_fetch_sched_entry_t* entries,
+                               uint16_t num_entries, uint32_t now_usec);
+
+/**
+ * @brief Return the time until the next fetch is due, e.g. to sleep
+ *
+ * @param[in] entries     the schedules
+ * @param[in] num_entries the number of schedules
+ * @param[in] now_usec    the current time
+ *
+ * @return the time in microseconds, 0 if a fetch is already due
+ */
+uint32_t sht3x_fetch_sched_idle_usec(const sht3x_fetch_sched_entry_t* entries,
+                                     uint16_t num_entries, uint32_t now_usec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT3X_FETCH_SCHED_H */
@@ -41,6 +41,7 @@
 #include "sht4x.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sht_frame.h"
 #include <sensirion-embedded-common.h>
 
 /* all measurement commands return T (CRC) RH (CRC) */
@@ -69,21 +70,32 @@ int16_t sht4x_measure(void) {
 }
 
 int16_t sht4x_read(int32_t* temperature, int32_t* humidity) {
-    uint16_t words[2];
-    int16_t ret = sensirion_i2c_read_words(SHT4X_ADDRESS, words,
-                                           SENSIRION_NUM_WORDS(words));
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    int16_t ret = sht4x_read_ticks(&t_ticks, &rh_ticks);
+    if (ret)
+        return ret;
     /**
      * formulas for conversion of the sensor signals, optimized for fixed point
      * algebra:
      * Temperature = 175 * S_T / 65535 - 45
      * Relative Humidity = 125 * (S_RH / 65535) - 6
      */
-    *temperature = ((21875 * (int32_t)words[0]) >> 13) - 45000;
-    *humidity = ((15625 * (int32_t)words[1]) >> 13) - 6000;
+    *temperature = ((21875 * (int32_t)t_ticks) >> 13) - 45000;
+    *humidity = ((15625 * (int32_t)rh_ticks) >> 13) - 6000;
 
     return ret;
 }
 
+int16_t sht4x_read_ticks(uint16_t* t_ticks, uint16_t* rh_ticks) {
+    uint8_t data[SHT_FRAME_MEASUREMENT_SIZE];
+    int16_t ret = sensirion_i2c_read(SHT4X_ADDRESS, data, sizeof(data));
+    if (ret)
+        return ret;
+
+    return sht_frame_unpack_ticks(data, t_ticks, rh_ticks);
+}
+
 int16_t sht4x_probe(void) {
     uint32_t serial;
 
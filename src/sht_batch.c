@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Struct-of-arrays sample batch implementation
+ */
+
+#include "sht_batch.h"
+#include "sensirion_humidity_conversion.h"
+#include "sht_mux.h"
+
+void sht_batch_clear(sht_batch_t* batch) {
+    batch->count = 0;
+}
+
+int16_t sht_batch_add(sht_batch_t* batch, const sht_raw_sample_t* sample) {
+    uint16_t i = batch->count;
+
+    if (i == batch->capacity)
+        return STATUS_ERR_NO_SPACE;
+    batch->timestamp_ms[i] = sample->timestamp_ms;
+    batch->sensor_id[i] = sample->sensor_id;
+    batch->t_ticks[i] = sample->t_ticks;
+    batch->rh_ticks[i] = sample->rh_ticks;
+    batch->status[i] = sample->status;
+    batch->family[i] = sample->family;
+    batch->count++;
+    return STATUS_OK;
+}
+
+void sht_batch_get(const sht_batch_t* batch, uint16_t i,
+                   sht_raw_sample_t* sample) {
+    sample->timestamp_ms = batch->timestamp_ms[i];
+    sample->sensor_id = batch->sensor_id[i];
+    sample->seq = 0;
+    sample->t_ticks = batch->t_ticks[i];
+    sample->rh_ticks = batch->rh_ticks[i];
+    sample->status = batch->status[i];
+    sample->bus = 0;
+    sample->family = batch->family[i];
+}
+
+uint16_t sht_batch_sweep_collect(sht_batch_t* batch, sht_handle_t* handles,
+                                 const uint16_t* order, uint16_t num_handles,
+                                 uint32_t now_ms) {
+    sht_handle_t* h;
+    uint16_t i;
+    uint16_t j;
+    int16_t ret;
+
+    for (i = 0; i < num_handles && batch->count < batch->capacity; ++i) {
+        h = &handles[order[i]];
+        j = batch->count;
+        batch->t_ticks[j] = 0;
+        batch->rh_ticks[j] = 0;
+        ret = sht_mux_select_handle(h);
+        if (ret == STATUS_OK)
+            ret = sht_handle_read_ticks(h, &batch->t_ticks[j],
+                                        &batch->rh_ticks[j]);
+        batch->timestamp_ms[j] = now_ms;
+        batch->sensor_id[j] = h->id;
+        batch->status[j] = ret;
+        batch->family[j] = h->family;
+        batch->count++;
+        h->seq++;
+    }
+    return i;
+}
+
+void sht_batch_convert(const sht_batch_t* batch, int32_t* temperature,
+                       int32_t* humidity) {
+    uint16_t n = batch->count;
+    uint16_t i;
+    int32_t sht4x;
+
+    /* as sht_raw_sample_convert(), one column per loop */
+    for (i = 0; i < n; ++i)
+        temperature[i] = ((21875 * (int32_t)batch->t_ticks[i]) >> 13) - 45000;
+    for (i = 0; i < n; ++i) {
+        sht4x = batch->family[i] == SHT_FAMILY_SHT4X;
+        humidity[i] =
+            (((sht4x ? 15625 : 12500) * (int32_t)batch->rh_ticks[i]) >> 13) -
+            (sht4x ? 6000 : 0);
+    }
+}
+
+uint16_t sht_batch_threshold(const sht_batch_t* batch, const int32_t* values,
+                             int32_t low, int32_t high, uint8_t* flags) {
+    uint16_t n = batch->count;
+    uint16_t out = 0;
+    uint16_t i;
+
+    for (i = 0; i < n; ++i) {
+        flags[i] = (uint8_t)(((values[i] < low) * SHT_BATCH_BELOW |
+                              (values[i] > high) * SHT_BATCH_ABOVE) *
+                             (batch->status[i] == STATUS_OK));
+        out = (uint16_t)(out + (flags[i] != 0));
+    }
+    return out;
+}
+
+void sht_batch_absolute_humidity(uint16_t count, const int32_t* temperature,
+                                 const int32_t* humidity, uint32_t* absolute) {
+    uint16_t i;
+
+    for (i = 0; i < count; ++i)
+        absolute[i] =
+            sensirion_calc_absolute_humidity(temperature[i], humidity[i]);
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Struct-of-arrays sample batches
+ *
+ * A batch stores the samples of a sweep column by column: timestamps, sensor
+ * ids, temperature and humidity ticks, status and family each in a
+ * contiguous array. The processing stages then run one simple loop per
+ * column, without the out-pointer calls of the per-sample API, which the
+ * compiler can unroll and vectorize: conversion of whole tick columns to
+ * milli units, threshold checks for alerting and absolute humidity. Tick
+ * columns can be handed to sht_pack_encode() as they are.
+ *
+ * Storage is provided by the application, e.g. with SHT_BATCH_DEFINE().
+ */
+
+#ifndef SHT_BATCH_H
+#define SHT_BATCH_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Flags set by sht_batch_threshold()
+ */
+#define SHT_BATCH_BELOW 0x01U
+#define SHT_BATCH_ABOVE 0x02U
+
+typedef struct _sht_batch {
+    uint32_t* timestamp_ms;
+    uint16_t* sensor_id;
+    uint16_t* t_ticks;
+    uint16_t* rh_ticks;
+    int16_t* status;
+    uint8_t* family; /* sht_family_t, selects the humidity conversion */
+    uint16_t capacity;
+    uint16_t count;
+} sht_batch_t;
+
+/**
+ * @brief Column storage of a batch of up to capacity samples
+ */
+#define SHT_BATCH_STORAGE(capacity)      \
+    struct {                             \
+        uint32_t timestamp_ms[capacity]; \
+        uint16_t sensor_id[capacity];    \
+        uint16_t t_ticks[capacity];      \
+        uint16_t rh_ticks[capacity];     \
+        int16_t status[capacity];        \
+        uint8_t family[capacity];        \
+    }
+
+/**
+ * @brief Define a batch named name with static storage
+ */
+#define SHT_BATCH_DEFINE(name, capacity)                    \
+    static SHT_BATCH_STORAGE(capacity) name##_storage;      \
+    static sht_batch_t name = {name##_storage.timestamp_ms, \
+                               name##_storage.sensor_id,    \
+                               name##_storage.t_ticks,      \
+                               name##_storage.rh_ticks,     \
+                               name##_storage.status,       \
+                               name##_storage.family,       \
+                               (capacity),                  \
+                               0}
+
+/**
+ * @brief Empty the batch
+ *
+ * @param[in] batch the batch
+ */
+void sht_batch_clear(sht_batch_t* batch);
+
+/**
+ * @brief Append a sample
+ *
+ * @param[in] batch  the batch
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the batch is full
+ */
+int16_t sht_batch_add(sht_batch_t* batch, const sht_raw_sample_t* sample);
+
+/**
+ * @brief Copy a sample of the batch out, e.g. for the per-sample encoders
+ *
+ * @param[in]  batch  the batch
+ * @param[in]  i      the index of the sample
+ * @param[out] sample the sample; seq and bus are not stored and set to 0
+ */
+void sht_batch_get(const sht_batch_t* batch, uint16_t i,
+                   sht_raw_sample_t* sample);
+
+/**
+ * @brief Read out the sensors triggered by sht_mux_sweep_trigger() straight
+ * into the columns, like sht_mux_sweep_collect(). A failed read is appended
+ * with its error in the status column.
+ *
+ * Reading stops when the batch is full. The remaining sensors can be read
+ * into the next batch by calling again with order advanced by the returned
+ * count.
+ *
+ * @param[in] batch       the batch, the samples are appended
+ * @param[in] handles     the sensors
+ * @param[in] order       the sweep order from sht_mux_plan()
+ * @param[in] num_handles the number of sensors
+ * @param[in] now_ms      the timestamp of the samples
+ *
+ * @return the number of sensors appended, less than num_handles if the batch
+ * filled up
+ */
+uint16_t sht_batch_sweep_collect(sht_batch_t* batch, sht_handle_t* handles,
+                                 const uint16_t* order, uint16_t num_handles,
+                                 uint32_t now_ms);
+
+/**
+ * @brief Convert the tick columns to milli degree Celsius and milli percent
+ *
+ * @param[in]  batch       the batch
+ * @param[out] temperature count temperatures
+ * @param[out] humidity    count relative humidities
+ */
+void sht_batch_convert(const sht_batch_t* batch, int32_t* temperature,
+                       int32_t* humidity);
+
+/**
+ * @brief Compare a value column against limits, e.g. for alerting. Samples
+ * with a failed read get no flags.
+ *
+ * @param[in]  batch  the batch
+ * @param[in]  values count values, e.g. from sht_batch_convert()
+ * @param[in]  low    the lower limit
+ * @param[in]  high   the upper limit
+ * @param[out] flags  count flags, SHT_BATCH_BELOW and SHT_BATCH_ABOVE
+ *
+ * @return the number of samples outside the limits
+ */
+uint16_t sht_batch_threshold(const sht_batch_t* batch, const int32_t* values,
+                             int32_t low, int32_t high, uint8_t* flags);
+
+/**
+ * @brief Compute the absolute humidity column
+ *
+ * @param[in]  count       the number of values
+ * @param[in]  temperature the temperatures in milli degree Celsius
+ * @param[in]  humidity    the relative humidities in milli percent
+ * @param[out] absolute    the absolute humidities in mg/m^3
+ */
+void sht_batch_absolute_humidity(uint16_t count, const int32_t* temperature,
+                                 const int32_t* humidity, uint32_t* absolute);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_BATCH_H */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Per-sensor circuit breaker implementation
+ */
+
+#include "sht_breaker.h"
+#include "sht_mux.h"
+
+/* context of the sweep order callbacks */
+typedef struct _sht_breaker_group {
+    sht_breaker_t* breakers;
+    const sht_breaker_config_t* config;
+} sht_breaker_group_t;
+
+static void sht_breaker_open(sht_breaker_t* breaker, uint32_t now_ms) {
+    breaker->state = SHT_BREAKER_OPEN;
+    breaker->until_ms = now_ms + breaker->cooldown_ms;
+    breaker->trips++;
+}
+
+void sht_breaker_init(sht_breaker_t* breakers, uint16_t count,
+                      const sht_breaker_config_t* config) {
+    uint16_t i;
+
+    for (i = 0; i < count; ++i) {
+        breakers[i].until_ms = 0;
+        breakers[i].cooldown_ms = config->cooldown_ms;
+        breakers[i].state = SHT_BREAKER_CLOSED;
+        breakers[i].failures = 0;
+        breakers[i].trips = 0;
+        breakers[i].skipped = 0;
+    }
+}
+
+uint8_t sht_breaker_allow(sht_breaker_t* breaker, uint32_t now_ms) {
+    if (breaker->state != SHT_BREAKER_OPEN)
+        return 1;
+    if ((int32_t)(now_ms - breaker->until_ms) < 0) {
+        breaker->skipped++;
+        return 0;
+    }
+    breaker->state = SHT_BREAKER_HALF_OPEN;
+    return 1;
+}
+
+void sht_breaker_report(sht_breaker_t* breaker,
+                        const sht_breaker_config_t* config, int16_t ret,
+                        uint32_t now_ms) {
+    switch (breaker->state) {
+        case SHT_BREAKER_CLOSED:
+            if (ret == STATUS_OK) {
+                breaker->failures = 0;
+            } else if (++breaker->failures >= config->failure_threshold) {
+                breaker->failures = 0;
+                sht_breaker_open(breaker, now_ms);
+            }
+            break;
+        case SHT_BREAKER_HALF_OPEN:
+            if (ret == STATUS_OK) {
+                breaker->state = SHT_BREAKER_CLOSED;
+                breaker->cooldown_ms = config->cooldown_ms;
+                break;
+            }
+            if (breaker->cooldown_ms > config->max_cooldown_ms / 2)
+                breaker->cooldown_ms = config->max_cooldown_ms;
+            else
+                breaker->cooldown_ms *= 2;
+            sht_breaker_open(breaker, now_ms);
+            break;
+        default:
+            /* a transaction started before the breaker opened */
+            break;
+    }
+}
+
+static uint8_t sht_breaker_keep_fn(void* ctx, uint16_t index,
+                                   uint32_t now_ms) {
+    return sht_breaker_allow(&((sht_breaker_t*)ctx)[index], now_ms);
+}
+
+uint16_t sht_breaker_filter(sht_breaker_t* breakers, const uint16_t* order,
+                            uint16_t count, uint32_t now_ms,
+                            uint16_t* allowed) {
+    return sht_mux_order_filter(order, count, sht_breaker_keep_fn, breakers,
+                                now_ms, allowed);
+}
+
+static void sht_breaker_report_fn(void* ctx, uint16_t index, int16_t ret,
+                                  uint32_t now_ms) {
+    sht_breaker_group_t* group = (sht_breaker_group_t*)ctx;
+
+    sht_breaker_report(&group->breakers[index], group->config, ret, now_ms);
+}
+
+void sht_breaker_report_samples(sht_breaker_t* breakers,
+                                const sht_breaker_config_t* config,
+                                const uint16_t* order,
+                                const sht_raw_sample_t* samples,
+                                uint16_t count, uint32_t now_ms) {
+    sht_breaker_group_t group;
+
+    group.breakers = breakers;
+    group.config = config;
+    sht_mux_order_report(order, samples, count, sht_breaker_report_fn, &group,
+                         now_ms);
+}
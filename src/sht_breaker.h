@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Per-sensor circuit breaker
+ *
+ * A sensor that keeps failing, e.g. one stretching the clock to the timeout
+ * on every transaction, costs the full timeout budget on every sweep and
+ * delays all other sensors of its bus. A circuit breaker per handle stops
+ * addressing such a sensor for a while:
+ *
+ * - closed: the sensor is addressed normally; failure_threshold consecutive
+ *   failed transactions open the breaker.
+ * - open: the sensor is skipped until the cool-down has elapsed.
+ * - half-open: the sensor is addressed again on trial. A successful
+ *   transaction closes the breaker; a failure opens it again with the
+ *   cool-down doubled, up to max_cooldown_ms.
+ *
+ * sht_breaker_filter() removes the handles with an open breaker from a sweep
+ * order, sht_breaker_report_samples() feeds the sweep results back, both on
+ * top of sht_mux_order_filter() and sht_mux_order_report() like the presence
+ * tracking of sht_presence.h, which takes sensors that are gone out of the
+ * sweep where the breaker takes out sensors that misbehave. With the
+ * bit-banged master the cost of a failing transaction is bounded by its
+ * transaction timeout, see sht_softi2c_set_timeouts(). All times are
+ * milliseconds of a free running 32 bit clock, wrap-around is handled.
+ */
+
+#ifndef SHT_BREAKER_H
+#define SHT_BREAKER_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+
+typedef enum _sht_breaker_state {
+    SHT_BREAKER_CLOSED,   /* addressed normally */
+    SHT_BREAKER_OPEN,     /* skipped until the cool-down has elapsed */
+    SHT_BREAKER_HALF_OPEN /* addressed on trial */
+} sht_breaker_state_t;
+
+/**
+ * @brief Settings shared by the breakers of a group of sensors
+ */
+typedef struct _sht_breaker_config {
+    uint32_t cooldown_ms;      /* first open period */
+    uint32_t max_cooldown_ms;  /* upper bound of the doubled open period */
+    uint8_t failure_threshold; /* consecutive failures opening the breaker */
+} sht_breaker_config_t;
+
+/**
+ * @brief Breaker of one sensor
+ */
+typedef struct _sht_breaker {
+    uint32_t until_ms;    /* open: end of the cool-down */
+    uint32_t cooldown_ms; /* length of the next cool-down */
+    uint8_t state;        /* sht_breaker_state_t */
+    uint8_t failures;     /* consecutive failures while closed */
+    uint32_t trips;       /* times the breaker opened */
+    uint32_t skipped;     /* transactions skipped while open */
+} sht_breaker_t;
+
+/**
+ * @brief Initialize closed breakers
+ *
+ * @param[out] breakers the breakers
+ * @param[in]  count    the number of breakers
+ * @param[in]  config   the settings
+ */
+void sht_breaker_init(sht_breaker_t* breakers, uint16_t count,
+                      const sht_breaker_config_t* config);
+
+/**
+ * @brief Check whether a sensor may be addressed, moving an open breaker
+ * whose cool-down has elapsed to half-open
+ *
+ * @param[in] breaker the breaker
+ * @param[in] now_ms  the current time
+ *
+ * @return 1 if the sensor may be addressed, 0 if it is skipped
+ */
+uint8_t sht_breaker_allow(sht_breaker_t* breaker, uint32_t now_ms);
+
+/**
+ * @brief Record the outcome of a transaction
+ *
+ * @param[in] breaker the breaker
+ * @param[in] config  the settings
+ * @param[in] ret     the return code of the transaction
+ * @param[in] now_ms  the current time
+ */
+void sht_breaker_report(sht_breaker_t* breaker,
+                        const sht_breaker_config_t* config, int16_t ret,
+                        uint32_t now_ms);
+
+/**
+ * @brief Copy the handles of a sweep order that may be addressed, keeping
+ * their order
+ *
+ * @param[in]  breakers the breakers, indexed like the handles
+ * @param[in]  order    the sweep order, e.g. from sht_mux_plan()
+ * @param[in]  count    the number of indices in order
+ * @param[in]  now_ms   the current time
+ * @param[out] allowed  storage for up to count indices, may equal order
+ *
+ * @return the number of handles that may be addressed
+ */
+uint16_t sht_breaker_filter(sht_breaker_t* breakers, const uint16_t* order,
+                            uint16_t count, uint32_t now_ms,
+                            uint16_t* allowed);
+
+/**
+ * @brief Record the outcome of a sweep, e.g. from sht_mux_sweep_collect()
+ *
+ * @param[in] breakers the breakers, indexed like the handles
+ * @param[in] config   the settings
+ * @param[in] order    the swept handle indices
+ * @param[in] samples  the samples, in sweep order
+ * @param[in] count    the number of swept handles
+ * @param[in] now_ms   the current time
+ */
+void sht_breaker_report_samples(sht_breaker_t* breakers,
+                                const sht_breaker_config_t* config,
+                                const uint16_t* order,
+                                const sht_raw_sample_t* samples,
+                                uint16_t count, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_BREAKER_H */
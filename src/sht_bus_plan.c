@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus bandwidth planner implementation
+ */
+
+#include "sht_bus_plan.h"
+#include "sensirion_common.h"
+#include "sht_clock.h"
+#include "sht_frame.h"
+
+#include <stddef.h>
+
+/* start, address byte with ACK, stop */
+#define SHT_BUS_PLAN_FRAMING_BITS (1 + 9 + 1)
+/* a data byte with its (N)ACK */
+#define SHT_BUS_PLAN_BYTE_BITS 9
+/* sht4x.c sends its commands as a single byte */
+#define SHT_BUS_PLAN_SHT4X_COMMAND_SIZE 1
+/* mux control register */
+#define SHT_BUS_PLAN_MUX_WRITE_SIZE 1
+
+static uint16_t sht_bus_plan_command_size(const sht_handle_t* handle) {
+    return handle->family == SHT_FAMILY_SHT4X ? SHT_BUS_PLAN_SHT4X_COMMAND_SIZE
+                                              : SENSIRION_COMMAND_SIZE;
+}
+
+static uint8_t sht_bus_plan_mux_depth(const sht_handle_t* handle) {
+    const sht_mux_t* m;
+    uint8_t depth = 0;
+
+    for (m = handle->mux; m && depth < SHT_MUX_MAX_DEPTH; m = m->parent)
+        depth++;
+    return depth;
+}
+
+static uint32_t sht_bus_plan_latency_usec(const sht_bus_plan_t* plan,
+                                          const sht_bus_plan_entry_t* e) {
+    uint32_t conversion = e->conversion_usec;
+    uint64_t latency;
+
+    if (plan->busy_period_usec == UINT32_MAX)
+        return UINT32_MAX;
+    if (e->mode == SHT_BUS_PLAN_PERIODIC)
+        return plan->busy_period_usec;
+
+    if (!conversion)
+        conversion = sht_handle_measurement_duration_usec(e->handle);
+    latency = 2 * (uint64_t)plan->busy_period_usec + conversion;
+    return latency < UINT32_MAX ? (uint32_t)latency : UINT32_MAX;
+}
+
+/* L = sum(ceil(L / T_j) * C_j), starting from all sensors due at once */
+static uint32_t sht_bus_plan_busy_period(const sht_bus_plan_entry_t* entries,
+                                         uint16_t num_entries) {
+    uint64_t busy = 0;
+    uint64_t next;
+    uint16_t it;
+    uint16_t i;
+
+    for (i = 0; i < num_entries; ++i)
+        busy += entries[i].bus_usec;
+
+    for (it = 0; it < SHT_BUS_PLAN_MAX_ITERATIONS; ++it) {
+        next = 0;
+        for (i = 0; i < num_entries; ++i)
+            next += (busy + entries[i].period_usec - 1) /
+                    entries[i].period_usec * entries[i].bus_usec;
+        if (next == busy)
+            return busy < UINT32_MAX ? (uint32_t)busy : UINT32_MAX;
+        busy = next;
+    }
+    return UINT32_MAX;
+}
+
+static uint32_t sht_bus_plan_transfer(const sht_bus_plan_t* plan,
+                                      uint16_t bytes, uint32_t clock_hz) {
+    uint32_t bits =
+        SHT_BUS_PLAN_FRAMING_BITS + (uint32_t)bytes * SHT_BUS_PLAN_BYTE_BITS;
+
+    return (uint32_t)(((uint64_t)bits * 1000000 + clock_hz - 1) / clock_hz) +
+           plan->overhead_usec;
+}
+
+uint32_t sht_bus_plan_transfer_usec(const sht_bus_plan_t* plan,
+                                    uint16_t bytes) {
+    return sht_bus_plan_transfer(
+        plan, bytes,
+        plan->clock_hz ? plan->clock_hz : SHT_CLOCK_DEFAULT_KHZ * 1000UL);
+}
+
+uint32_t sht_bus_plan_sample_usec(const sht_bus_plan_t* plan,
+                                  const sht_bus_plan_entry_t* entry) {
+    uint16_t read_bytes = entry->read_bytes;
+    uint32_t mux_writes = 2 * (uint32_t)sht_bus_plan_mux_depth(entry->handle);
+    uint32_t clock_hz = plan->clock_hz;
+    uint32_t usec;
+
+    if (!read_bytes)
+        read_bytes = SHT_FRAME_MEASUREMENT_SIZE;
+    if (!clock_hz)
+        clock_hz = sht_clock_handle_khz(entry->handle) * 1000UL;
+
+    /* measure (or fetch) command and read, each preceded by a selection */
+    usec = sht_bus_plan_transfer(
+        plan, sht_bus_plan_command_size(entry->handle), clock_hz);
+    usec += sht_bus_plan_transfer(plan, read_bytes, clock_hz);
+    if (entry->mode == SHT_BUS_PLAN_SINGLE_SHOT)
+        mux_writes *= 2;
+    return usec + mux_writes * sht_bus_plan_transfer(
+                                   plan, SHT_BUS_PLAN_MUX_WRITE_SIZE, clock_hz);
+}
+
+int16_t sht_bus_plan_evaluate(sht_bus_plan_t* plan,
+                              sht_bus_plan_entry_t* entries,
+                              uint16_t num_entries) {
+    uint64_t ppm = 0;
+    uint16_t i;
+
+    for (i = 0; i < num_entries; ++i) {
+        if (!entries[i].period_usec || !entries[i].handle)
+            return STATUS_ERR_INVALID_PARAMS;
+        entries[i].bus_usec = sht_bus_plan_sample_usec(plan, &entries[i]);
+        ppm += (uint64_t)entries[i].bus_usec * 1000000 /
+               entries[i].period_usec;
+    }
+    plan->utilization_ppm = ppm < UINT32_MAX ? (uint32_t)ppm : UINT32_MAX;
+
+    /* the busy period only converges below full utilization */
+    plan->busy_period_usec = UINT32_MAX;
+    if (ppm < 1000000)
+        plan->busy_period_usec = sht_bus_plan_busy_period(entries, num_entries);
+
+    plan->worst_latency_usec = 0;
+    for (i = 0; i < num_entries; ++i) {
+        entries[i].latency_usec = sht_bus_plan_latency_usec(plan, &entries[i]);
+        if (entries[i].latency_usec > plan->worst_latency_usec)
+            plan->worst_latency_usec = entries[i].latency_usec;
+    }
+
+    if (plan->utilization_ppm > plan->max_utilization_ppm ||
+        (plan->max_latency_usec &&
+         plan->worst_latency_usec > plan->max_latency_usec))
+        return STATUS_ERR_OVER_BUDGET;
+    return STATUS_OK;
+}
+
+int16_t sht_bus_plan_admit(sht_bus_plan_t* plan, sht_bus_plan_entry_t* entries,
+                           uint16_t num_entries) {
+    sht_bus_plan_entry_t* e;
+    uint64_t share;
+    uint64_t max_share;
+    uint16_t victim;
+    uint16_t i;
+    int16_t ret;
+
+    plan->down_rated = 0;
+    while ((ret = sht_bus_plan_evaluate(plan, entries, num_entries)) ==
+           STATUS_ERR_OVER_BUDGET) {
+        victim = num_entries;
+        max_share = 0;
+        for (i = 0; i < num_entries; ++i) {
+            e = &entries[i];
+            if (e->max_period_usec / 2 < e->period_usec)
+                continue;
+            share = (uint64_t)e->bus_usec * 1000000 / e->period_usec;
+            if (victim == num_entries || share > max_share) {
+                victim = i;
+                max_share = share;
+            }
+        }
+        if (victim == num_entries)
+            break;
+        entries[victim].period_usec *= 2;
+        plan->down_rated++;
+    }
+    return ret;
+}
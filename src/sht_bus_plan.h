@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus bandwidth planning and admission control
+ *
+ * An overloaded bus silently stretches the sampling periods of its sensors.
+ * The planner computes, before a configuration is deployed, how busy a bus
+ * will be and how late a sample can be, from the transfers the drivers
+ * actually perform per sample:
+ *
+ * - single shot: the measure command (2 bytes for SHT3x and SHTC1, 1 byte for
+ *   SHT4x), the conversion with the bus released, then a read of T (CRC)
+ *   RH (CRC)
+ * - SHT3x periodic mode: the fetch command followed by the read
+ * - for sensors behind multiplexers, the control register writes needed to
+ *   switch the path, see below
+ *
+ * A transfer of n bytes costs a start condition, the address byte, n data
+ * bytes with their (N)ACK bits and a stop condition on the wire, plus a
+ * configurable per-transfer overhead of the host. The transfers run at the
+ * plan's clock or, if it is 0, at the clock sht_clock_handle_khz() selects for
+ * each sensor. Multiplexer switches are
+ * counted pessimistically: every selection may enter each mux of the path
+ * and close a conflicting mux at each level. The model assumes the drivers'
+ * default of measurements without clock stretching.
+ *
+ * The worst-case latency of a sample is bounded with the busy period of the
+ * bus, i.e. the longest time the bus can be occupied once all sensors become
+ * due at the same instant: the measure command and the read may each have to
+ * wait for a full busy period.
+ */
+
+#ifndef SHT_BUS_PLAN_H
+#define SHT_BUS_PLAN_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_OVER_BUDGET (-6)
+
+/**
+ * @brief Maximum number of busy period iterations
+ */
+#ifndef SHT_BUS_PLAN_MAX_ITERATIONS
+#define SHT_BUS_PLAN_MAX_ITERATIONS 64
+#endif
+
+/**
+ * @brief How a sensor is sampled
+ */
+typedef enum _sht_bus_plan_mode {
+    SHT_BUS_PLAN_SINGLE_SHOT, /* measure, wait, read */
+    SHT_BUS_PLAN_PERIODIC     /* SHT3x periodic mode, fetch and read */
+} sht_bus_plan_mode_t;
+
+/**
+ * @brief Sampling configuration of one sensor and its planned cost
+ */
+typedef struct _sht_bus_plan_entry {
+    const sht_handle_t* handle;
+    uint32_t period_usec;     /* sampling period, raised when down-rated */
+    uint32_t max_period_usec; /* down-rating limit, 0 if the rate is fixed */
+    uint32_t conversion_usec; /* 0 for the family's measurement duration */
+    uint16_t read_bytes;      /* bytes read per sample, 0 for one frame */
+    uint8_t mode;             /* sht_bus_plan_mode_t */
+    uint32_t bus_usec;        /* computed bus time per sample */
+    uint32_t latency_usec;    /* computed worst-case sample latency */
+} sht_bus_plan_entry_t;
+
+/**
+ * @brief Bus parameters, budget and results of a plan
+ */
+typedef struct _sht_bus_plan {
+    uint32_t clock_hz;            /* SCL frequency, 0 for the sensors' */
+    uint16_t overhead_usec;       /* host overhead per transfer */
+    uint32_t max_utilization_ppm; /* budget, parts per million of bus time */
+    uint32_t max_latency_usec;    /* budget, 0 if not checked */
+    uint32_t utilization_ppm;     /* computed */
+    uint32_t busy_period_usec;    /* computed, UINT32_MAX if unbounded */
+    uint32_t worst_latency_usec;  /* computed, over all entries */
+    uint16_t down_rated;          /* period doublings applied by admit */
+} sht_bus_plan_t;
+
+/**
+ * @brief Return the time of one I2C transfer
+ *
+ * @param[in] plan  the bus parameters, a clock of 0 stands for
+ *                  SHT_CLOCK_DEFAULT_KHZ
+ * @param[in] bytes the number of bytes after the address byte
+ *
+ * @return the time in microseconds, rounded up
+ */
+uint32_t sht_bus_plan_transfer_usec(const sht_bus_plan_t* plan,
+                                    uint16_t bytes);
+
+/**
+ * @brief Return the bus time one sample of a sensor costs
+ *
+ * @param[in] plan  the bus parameters
+ * @param[in] entry the sensor configuration
+ *
+ * @return the time in microseconds
+ */
+uint32_t sht_bus_plan_sample_usec(const sht_bus_plan_t* plan,
+                                  const sht_bus_plan_entry_t* entry);
+
+/**
+ * @brief Compute utilization, busy period and latencies of a configuration
+ * and check it against the budget
+ *
+ * @param[in,out] plan        the bus parameters, receives the results
+ * @param[in,out] entries     the sensors of the bus, receive their costs
+ * @param[in]     num_entries the number of sensors
+ *
+ * @return 0 if the configuration fits the budget, STATUS_ERR_OVER_BUDGET if
+ * not, else an error code
+ */
+int16_t sht_bus_plan_evaluate(sht_bus_plan_t* plan,
+                              sht_bus_plan_entry_t* entries,
+                              uint16_t num_entries);
+
+/**
+ * @brief Admit a configuration, down-rating sensors if it exceeds the budget.
+ * The sensor with the largest share of the bus time whose period may still
+ * be raised gets its period doubled, up to its max_period_usec, until the
+ * budget is met.
+ *
+ * @param[in,out] plan        the bus parameters, receives the results
+ * @param[in,out] entries     the sensors of the bus
+ * @param[in]     num_entries the number of sensors
+ *
+ * @return 0 if the (possibly down-rated) configuration fits the budget,
+ * STATUS_ERR_OVER_BUDGET if it cannot be made to fit, in which case the
+ * entries keep the most down-rated periods tried, else an error code
+ */
+int16_t sht_bus_plan_admit(sht_bus_plan_t* plan, sht_bus_plan_entry_t* entries,
+                           uint16_t num_entries);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_BUS_PLAN_H */
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus transaction scheduler implementation
+ */
+
+#include "sht_bus_sched.h"
+#include "sht3x.h"
+#include "sht4x.h"
+#include "sht_clock.h"
+#include "sht_mux.h"
+#include "shtc1.h"
+
+#include <stddef.h>
+
+/* wrap-around safe "a is at or after b" */
+#define SHT_BUS_SCHED_AFTER(a, b) ((int32_t)((uint32_t)(a) - (b)) >= 0)
+
+/* the op that goes first of two ready ops */
+static uint8_t sht_bus_sched_before(const sht_bus_sched_op_t* a,
+                                    const sht_bus_sched_op_t* b) {
+    if (a->cls != b->cls)
+        return a->cls < b->cls;
+    if (a->deadline_usec != b->deadline_usec)
+        return (int32_t)(a->deadline_usec - b->deadline_usec) < 0;
+    /* oldest first among equal deadlines */
+    return (int32_t)(a->ready_usec - b->ready_usec) < 0;
+}
+
+static int16_t sht_bus_sched_status(sht_bus_sched_op_t* op) {
+    switch (op->handle->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_get_status(op->handle->addr, &op->status);
+        case SHT_FAMILY_SHT4X:
+            op->status = 0;
+            return sht4x_probe();
+        case SHT_FAMILY_SHTC1:
+            op->status = 0;
+            return shtc1_probe();
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+/* bus time from the start of a measure transaction until the conversion
+ * starts: mux selection and a command of up to two bytes */
+static uint32_t sht_bus_sched_measure_usec(const sht_handle_t* handle) {
+    uint16_t khz = sht_clock_handle_khz(handle);
+
+    return sht_mux_select_writes(handle) * SHT_HANDLE_TRANSFER_USEC(1, khz) +
+           SHT_HANDLE_TRANSFER_USEC(2, khz);
+}
+
+static void sht_bus_sched_account(sht_bus_sched_t* sched,
+                                  const sht_bus_sched_op_t* op,
+                                  uint32_t now_usec, int16_t ret) {
+    sht_bus_sched_stats_t* s = &sched->stats[op->cls];
+    uint32_t wait = 0;
+
+    if (SHT_BUS_SCHED_AFTER(now_usec, op->ready_usec))
+        wait = now_usec - op->ready_usec;
+    s->transactions++;
+    s->wait_sum_usec += wait;
+    if (wait > s->wait_max_usec)
+        s->wait_max_usec = wait;
+    if (ret != STATUS_OK)
+        s->failed++;
+}
+
+void sht_bus_sched_init(sht_bus_sched_t* sched, sht_bus_sched_op_t* ops,
+                        uint16_t capacity, sht_bus_sched_done_fn done,
+                        void* user_data) {
+    uint16_t i;
+
+    for (i = 0; i < capacity; ++i)
+        ops[i].queued = 0;
+    sched->ops = ops;
+    sched->capacity = capacity;
+    sched->pending = 0;
+    sched->done = done;
+    sched->user_data = user_data;
+    sht_bus_sched_reset_stats(sched);
+}
+
+int16_t sht_bus_sched_submit(sht_bus_sched_t* sched, sht_handle_t* handle,
+                             uint8_t type, uint8_t cls, uint32_t ready_usec,
+                             uint32_t deadline_usec, uint16_t tag) {
+    sht_bus_sched_op_t* op;
+    uint16_t i;
+
+    if (type > SHT_BUS_SCHED_OP_SAMPLE || cls >= SHT_BUS_SCHED_NUM_CLASSES)
+        return STATUS_ERR_INVALID_PARAMS;
+    if (sched->pending == sched->capacity)
+        return STATUS_ERR_NO_SPACE;
+
+    for (i = 0; sched->ops[i].queued; ++i)
+        ;
+    op = &sched->ops[i];
+    op->handle = handle;
+    op->ready_usec = ready_usec;
+    op->deadline_usec = deadline_usec;
+    op->status = 0;
+    op->tag = tag;
+    op->type = type;
+    op->cls = cls;
+    op->measured = 0;
+    op->queued = 1;
+    sched->pending++;
+    return STATUS_OK;
+}
+
+uint16_t sht_bus_sched_cancel(sht_bus_sched_t* sched,
+                              const sht_handle_t* handle) {
+    uint16_t removed = 0;
+    uint16_t i;
+
+    for (i = 0; i < sched->capacity; ++i) {
+        if (sched->ops[i].queued && sched->ops[i].handle == handle) {
+            sched->ops[i].queued = 0;
+            removed++;
+        }
+    }
+    sched->pending -= removed;
+    return removed;
+}
+
+uint16_t sht_bus_sched_next(const sht_bus_sched_t* sched, uint32_t now_usec) {
+    const sht_bus_sched_op_t* op;
+    uint16_t next = sched->capacity;
+    uint16_t i;
+
+    for (i = 0; i < sched->capacity; ++i) {
+        op = &sched->ops[i];
+        if (!op->queued || !SHT_BUS_SCHED_AFTER(now_usec, op->ready_usec))
+            continue;
+        if (next == sched->capacity ||
+            sht_bus_sched_before(op, &sched->ops[next]))
+            next = i;
+    }
+    return next;
+}
+
+uint8_t sht_bus_sched_run_once(sht_bus_sched_t* sched, uint32_t now_usec,
+                               uint32_t now_ms) {
+    sht_bus_sched_op_t* op;
+    uint16_t i = sht_bus_sched_next(sched, now_usec);
+    uint32_t measure_usec;
+    int16_t ret;
+
+    if (i == sched->capacity)
+        return 0;
+    op = &sched->ops[i];
+    /* before the selection changes the mux path */
+    measure_usec = sht_bus_sched_measure_usec(op->handle);
+
+    ret = sht_mux_select_handle(op->handle);
+    if (ret == STATUS_OK) {
+        switch (op->type) {
+            case SHT_BUS_SCHED_OP_MEASURE:
+                ret = sht_handle_measure(op->handle);
+                break;
+            case SHT_BUS_SCHED_OP_STATUS:
+                ret = sht_bus_sched_status(op);
+                break;
+            case SHT_BUS_SCHED_OP_SAMPLE:
+                if (!op->measured) {
+                    ret = sht_handle_measure(op->handle);
+                    break;
+                }
+                /* fall through */
+            default:
+                ret = sht_handle_read_sample(op->handle, now_ms, &op->sample);
+                break;
+        }
+    }
+    sht_bus_sched_account(sched, op, now_usec, ret);
+
+    if (op->type == SHT_BUS_SCHED_OP_SAMPLE && !op->measured &&
+        ret == STATUS_OK) {
+        /* keep the op queued, the bus is free during the conversion */
+        op->measured = 1;
+        op->ready_usec = now_usec + measure_usec +
+                         sht_handle_measurement_duration_usec(op->handle);
+        return 1;
+    }
+
+    if (!SHT_BUS_SCHED_AFTER(op->deadline_usec, now_usec))
+        sched->stats[op->cls].missed++;
+    if (sched->done)
+        sched->done(sched->user_data, op, ret);
+    op->queued = 0;
+    sched->pending--;
+    return 1;
+}
+
+uint32_t sht_bus_sched_idle_usec(const sht_bus_sched_t* sched,
+                                 uint32_t now_usec) {
+    uint32_t idle = UINT32_MAX;
+    uint32_t d;
+    uint16_t i;
+
+    for (i = 0; i < sched->capacity; ++i) {
+        if (!sched->ops[i].queued)
+            continue;
+        if (SHT_BUS_SCHED_AFTER(now_usec, sched->ops[i].ready_usec))
+            return 0;
+        d = sched->ops[i].ready_usec - now_usec;
+        if (d < idle)
+            idle = d;
+    }
+    return idle;
+}
+
+void sht_bus_sched_reset_stats(sht_bus_sched_t* sched) {
+    uint8_t c;
+
+    for (c = 0; c < SHT_BUS_SCHED_NUM_CLASSES; ++c) {
+        sched->stats[c].transactions = 0;
+        sched->stats[c].failed = 0;
+        sched->stats[c].missed = 0;
+        sched->stats[c].wait_sum_usec = 0;
+        sched->stats[c].wait_max_usec = 0;
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Priority and deadline scheduling of the transactions of one bus
+ *
+ * Alert verifications and operator requested spot readings must not wait
+ * behind a routine sweep of the whole bus. The scheduler queues the pending
+ * operations of one bus and, every time the bus becomes free, starts the one
+ * that matters most: operations are ordered by class first and by deadline
+ * within a class (earliest deadline first). Each call to
+ * sht_bus_sched_run_once() performs exactly one I2C transaction, so a routine
+ * sweep submitted as individual operations is preempted at transaction
+ * boundaries and a high priority operation waits at most for the transaction
+ * in progress.
+ *
+ * A sample operation chains a measure and a read: after the measure the
+ * operation stays queued with its earliest start set to the end of the
+ * conversion, leaving the bus to other operations meanwhile.
+ *
+ * The scheduler keeps per class latency metrics: the wait of every
+ * transaction from the moment it could have started (submission or end of the
+ * conversion) until it was started, and the number of operations started
+ * after their deadline. All times are microseconds of a free running 32 bit
+ * clock, wrap-around is handled. The samples are stamped with the
+ * millisecond clock of the other sweep functions, which the caller passes
+ * along: the microsecond clock wraps after 71 minutes.
+ */
+
+#ifndef SHT_BUS_SCHED_H
+#define SHT_BUS_SCHED_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Priority class of an operation, lower values are served first
+ */
+typedef enum _sht_bus_sched_class {
+    SHT_BUS_SCHED_ALERT,   /* verification of an alert condition */
+    SHT_BUS_SCHED_SPOT,    /* operator requested reading */
+    SHT_BUS_SCHED_ROUTINE, /* periodic sweep */
+    SHT_BUS_SCHED_NUM_CLASSES
+} sht_bus_sched_class_t;
+
+/**
+ * @brief Bus operation
+ */
+typedef enum _sht_bus_sched_op_type {
+    SHT_BUS_SCHED_OP_MEASURE, /* start a measurement */
+    SHT_BUS_SCHED_OP_READ,    /* read out a started measurement */
+    SHT_BUS_SCHED_OP_STATUS,  /* read the SHT3x status, probe other families */
+    SHT_BUS_SCHED_OP_SAMPLE   /* measure, wait for the conversion, read */
+} sht_bus_sched_op_type_t;
+
+/**
+ * @brief Queued operation, also passed to the completion callback
+ */
+typedef struct _sht_bus_sched_op {
+    sht_handle_t* handle;
+    uint32_t ready_usec;    /* earliest start of the next transaction */
+    uint32_t deadline_usec; /* latest desired start of the last transaction */
+    sht_raw_sample_t sample; /* result of read and sample operations */
+    uint16_t status;         /* SHT3x status word of status operations */
+    uint16_t tag;            /* application defined */
+    uint8_t type;            /* sht_bus_sched_op_type_t */
+    uint8_t cls;             /* sht_bus_sched_class_t */
+    uint8_t queued;
+    uint8_t measured; /* the measure of a sample operation is done */
+} sht_bus_sched_op_t;
+
+/**
+ * @brief Latency metrics of one class
+ */
+typedef struct _sht_bus_sched_stats {
+    uint32_t transactions;
+    uint32_t failed;        /* transactions that returned an error */
+    uint32_t missed;        /* operations completed after their deadline */
+    uint64_t wait_sum_usec; /* 32 bits wrap after 71 minutes of waiting */
+    uint32_t wait_max_usec;
+} sht_bus_sched_stats_t;
+
+/**
+ * @brief Called when an operation completed, with the return code of its
+ * last transaction. The operation slot is released after the call returns.
+ */
+typedef void (*sht_bus_sched_done_fn)(void* user_data,
+                                      const sht_bus_sched_op_t* op,
+                                      int16_t ret);
+
+typedef struct _sht_bus_sched {
+    sht_bus_sched_op_t* ops; /* queue storage */
+    uint16_t capacity;
+    uint16_t pending;
+    sht_bus_sched_done_fn done;
+    void* user_data;
+    sht_bus_sched_stats_t stats[SHT_BUS_SCHED_NUM_CLASSES];
+} sht_bus_sched_t;
+
+/**
+ * @brief Initialize a scheduler on caller provided storage
+ *
+ * @param[out] sched     the scheduler
+ * @param[in]  ops       storage for the queued operations
+ * @param[in]  capacity  the maximum number of queued operations
+ * @param[in]  done      the completion callback, may be NULL
+ * @param[in]  user_data passed to done
+ */
+void sht_bus_sched_init(sht_bus_sched_t* sched, sht_bus_sched_op_t* ops,
+                        uint16_t capacity, sht_bus_sched_done_fn done,
+                        void* user_data);
+
+/**
+ * @brief Queue an operation
+ *
+ * @param[in] sched          the scheduler
+ * @param[in] handle         the sensor, all handles of a scheduler must be on
+ *                           the same bus
+ * @param[in] type           the sht_bus_sched_op_type_t
+ * @param[in] cls            the sht_bus_sched_class_t
+ * @param[in] ready_usec     the earliest start, e.g. the current time
+ * @param[in] deadline_usec  the latest desired start of the operation's last
+ *                           transaction
+ * @param[in] tag            application defined, passed back on completion
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the queue is full, else an
+ * error code
+ */
+int16_t sht_bus_sched_submit(sht_bus_sched_t* sched, sht_handle_t* handle,
+                             uint8_t type, uint8_t cls, uint32_t ready_usec,
+                             uint32_t deadline_usec, uint16_t tag);
+
+/**
+ * @brief Remove all queued operations of a handle without completing them
+ *
+ * @param[in] sched  the scheduler
+ * @param[in] handle the sensor
+ *
+ * @return the number of removed operations
+ */
+uint16_t sht_bus_sched_cancel(sht_bus_sched_t* sched,
+                              const sht_handle_t* handle);
+
+/**
+ * @brief Return the queued operation that would be started next
+ *
+ * @param[in] sched    the scheduler
+ * @param[in] now_usec the current time
+ *
+ * @return the index of the operation, sched->capacity if none is ready
+ */
+uint16_t sht_bus_sched_next(const sht_bus_sched_t* sched, uint32_t now_usec);
+
+/**
+ * @brief Perform the transaction of the most urgent ready operation,
+ * selecting the multiplexer channel of its handle first
+ *
+ * @param[in] sched    the scheduler
+ * @param[in] now_usec the current time
+ * @param[in] now_ms   the current time in milliseconds, the timestamp of a
+ *                     sample read by the transaction
+ *
+ * @return 1 if a transaction was performed, 0 if no operation is ready
+ */
+uint8_t sht_bus_sched_run_once(sht_bus_sched_t* sched, uint32_t now_usec,
+                               uint32_t now_ms);
+
+/**
+ * @brief Return the time until the next operation becomes ready, e.g. to
+ * sleep
+ *
+ * @param[in] sched    the scheduler
+ * @param[in] now_usec the current time
+ *
+ * @return the time in microseconds, 0 if an operation is ready and
+ * UINT32_MAX if the queue is empty
+ */
+uint32_t sht_bus_sched_idle_usec(const sht_bus_sched_t* sched,
+                                 uint32_t now_usec);
+
+/**
+ * @brief Reset the latency metrics of all classes
+ *
+ * @param[in] sched the scheduler
+ */
+void sht_bus_sched_reset_stats(sht_bus_sched_t* sched);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_BUS_SCHED_H */
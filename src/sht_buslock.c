@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Advisory bus locking implementation
+ */
+
+#ifdef __linux__
+
+/* flock(), clock_gettime() */
+#define _DEFAULT_SOURCE
+
+#include "sht_buslock.h"
+#include "sensirion_i2c.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/file.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t sht_buslock_now_usec(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static int16_t sht_buslock_open(sht_buslock_t* lock, sht_buslock_bus_t* b,
+                                uint8_t bus) {
+    char path[256];
+
+    if (b->fd >= 0)
+        return STATUS_OK;
+    if (snprintf(path, sizeof(path), "%s/sht-i2c-%u.lock", lock->dir,
+                 (unsigned)bus) >= (int)sizeof(path))
+        return STATUS_ERR_INVALID_PARAMS;
+    b->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    return b->fd >= 0 ? STATUS_OK : STATUS_ERR_IO;
+}
+
+static int sht_buslock_flock(int fd, int operation) {
+    int ret;
+
+    do {
+        ret = flock(fd, operation);
+    } while (ret != 0 && errno == EINTR);
+    return ret;
+}
+
+void sht_buslock_init(sht_buslock_t* lock, const char* dir) {
+    uint8_t i;
+
+    lock->dir = dir ? dir : SHT_BUSLOCK_DEFAULT_DIR;
+    for (i = 0; i < SHT_BUSLOCK_MAX_BUSES; ++i) {
+        lock->buses[i].fd = -1;
+        lock->buses[i].depth = 0;
+        lock->buses[i].generation = 0;
+        lock->buses[i].acquisitions = 0;
+        lock->buses[i].contended = 0;
+        lock->buses[i].foreign = 0;
+        lock->buses[i].max_wait_usec = 0;
+        lock->buses[i].wait_usec = 0;
+    }
+}
+
+void sht_buslock_close(sht_buslock_t* lock) {
+    uint8_t i;
+
+    for (i = 0; i < SHT_BUSLOCK_MAX_BUSES; ++i) {
+        if (lock->buses[i].fd >= 0)
+            close(lock->buses[i].fd);
+        lock->buses[i].fd = -1;
+        lock->buses[i].depth = 0;
+    }
+}
+
+int16_t sht_buslock_acquire(sht_buslock_t* lock, uint8_t bus,
+                            uint8_t* foreign) {
+    sht_buslock_bus_t* b;
+    uint64_t start;
+    uint64_t wait;
+    uint32_t generation = 0;
+    int16_t ret;
+
+    if (foreign)
+        *foreign = 0;
+    if (bus >= SHT_BUSLOCK_MAX_BUSES)
+        return STATUS_ERR_INVALID_PARAMS;
+    b = &lock->buses[bus];
+    if (b->depth) {
+        b->depth++;
+        return STATUS_OK;
+    }
+    ret = sht_buslock_open(lock, b, bus);
+    if (ret != STATUS_OK)
+        return ret;
+
+    if (sht_buslock_flock(b->fd, LOCK_EX | LOCK_NB) != 0) {
+        if (errno != EWOULDBLOCK)
+            return STATUS_ERR_IO;
+        start = sht_buslock_now_usec();
+        if (sht_buslock_flock(b->fd, LOCK_EX) != 0)
+            return STATUS_ERR_IO;
+        wait = sht_buslock_now_usec() - start;
+        b->contended++;
+        b->wait_usec += wait;
+        if (wait > b->max_wait_usec)
+            b->max_wait_usec = wait > UINT32_MAX ? UINT32_MAX : (uint32_t)wait;
+    }
+
+    /* an empty file reads as generation 0, as after sht_buslock_init() */
+    if (pread(b->fd, &generation, sizeof(generation), 0) < 0) {
+        (void)sht_buslock_flock(b->fd, LOCK_UN);
+        return STATUS_ERR_IO;
+    }
+    if (generation != b->generation) {
+        b->generation = generation;
+        b->foreign++;
+        if (foreign)
+            *foreign = 1;
+    }
+    b->depth = 1;
+    b->acquisitions++;
+    return STATUS_OK;
+}
+
+int16_t sht_buslock_release(sht_buslock_t* lock, uint8_t bus) {
+    sht_buslock_bus_t* b;
+    uint32_t generation;
+    int16_t ret = STATUS_OK;
+
+    if (bus >= SHT_BUSLOCK_MAX_BUSES || !lock->buses[bus].depth)
+        return STATUS_ERR_INVALID_PARAMS;
+    b = &lock->buses[bus];
+    if (--b->depth)
+        return STATUS_OK;
+
+    /* a channel left enabled would put our sensors next to the ones the
+     * next process selects, possibly at the same address */
+    if (sht_mux_close(bus) != STATUS_OK)
+        ret = STATUS_ERR_IO;
+    generation = b->generation + 1;
+    if (pwrite(b->fd, &generation, sizeof(generation), 0) ==
+        (ssize_t)sizeof(generation))
+        b->generation = generation;
+    else
+        ret = STATUS_ERR_IO;
+    if (sht_buslock_flock(b->fd, LOCK_UN) != 0)
+        ret = STATUS_ERR_IO;
+    return ret;
+}
+
+/* the muxes in front of a handle lost track of their channels */
+static void sht_buslock_invalidate(const sht_handle_t* handle) {
+    sht_mux_t* m;
+
+    for (m = handle->mux; m; m = m->parent)
+        sht_mux_invalidate(m);
+}
+
+/* release the buses of mask, highest first */
+static int16_t sht_buslock_release_mask(sht_buslock_t* lock, uint32_t mask) {
+    int16_t ret = STATUS_OK;
+    uint8_t bus;
+
+    for (bus = SHT_BUSLOCK_MAX_BUSES; bus > 0; --bus) {
+        if ((mask & (1UL << (bus - 1))) &&
+            sht_buslock_release(lock, (uint8_t)(bus - 1)) != STATUS_OK)
+            ret = STATUS_ERR_IO;
+    }
+    return ret;
+}
+
+int16_t sht_buslock_sweep(sht_buslock_t* lock, sht_handle_t* handles,
+                          const uint16_t* order, uint16_t num_handles,
+                          uint32_t now_ms, sht_raw_sample_t* samples,
+                          uint16_t* failed) {
+    uint32_t wanted = 0;
+    uint32_t held = 0;
+    uint32_t foreign = 0;
+    uint8_t f;
+    uint8_t bus;
+    uint16_t i;
+    int16_t ret;
+
+    *failed = 0;
+    for (i = 0; i < num_handles; ++i) {
+        if (handles[order[i]].bus >= SHT_BUSLOCK_MAX_BUSES)
+            return STATUS_ERR_INVALID_PARAMS;
+        wanted |= 1UL << handles[order[i]].bus;
+    }
+
+    for (bus = 0; bus < SHT_BUSLOCK_MAX_BUSES; ++bus) {
+        if (!(wanted & (1UL << bus)))
+            continue;
+        ret = sht_buslock_acquire(lock, bus, &f);
+        if (ret != STATUS_OK) {
+            (void)sht_buslock_release_mask(lock, held);
+            return ret;
+        }
+        held |= 1UL << bus;
+        if (f)
+            foreign |= 1UL << bus;
+    }
+
+    for (i = 0; foreign && i < num_handles; ++i) {
+        if (foreign & (1UL << handles[order[i]].bus))
+            sht_buslock_invalidate(&handles[order[i]]);
+    }
+    *failed = sht_mux_sweep(handles, order, num_handles, now_ms, samples);
+    return sht_buslock_release_mask(lock, held);
+}
+
+int16_t sht_buslock_read_sample(sht_buslock_t* lock, sht_handle_t* handle,
+                                uint32_t now_ms, sht_raw_sample_t* sample) {
+    uint8_t foreign;
+    int16_t ret;
+    int16_t unlock;
+
+    ret = sht_buslock_acquire(lock, handle->bus, &foreign);
+    if (ret != STATUS_OK)
+        return ret;
+    if (foreign)
+        sht_buslock_invalidate(handle);
+
+    ret = sht_mux_select_handle(handle);
+    if (ret == STATUS_OK)
+        ret = sht_handle_measure(handle);
+    if (ret == STATUS_OK) {
+        sensirion_sleep_usec(sht_handle_measurement_duration_usec(handle));
+        ret = sht_handle_read_sample(handle, now_ms, sample);
+    } else {
+        sample->t_ticks = 0;
+        sample->rh_ticks = 0;
+        sample->status = ret;
+        sample->timestamp_ms = now_ms;
+        sample->sensor_id = handle->id;
+        sample->seq = handle->seq++;
+        sample->bus = handle->bus;
+        sample->family = handle->family;
+    }
+
+    unlock = sht_buslock_release(lock, handle->bus);
+    return ret != STATUS_OK ? ret : unlock;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Advisory bus locking between cooperating Linux processes
+ *
+ * Without a central daemon, independent processes using the library on the
+ * same /dev/i2c-N would interleave their transactions: a measure of one
+ * process may be followed by a read of another, and a process may find a
+ * multiplexer channel switched behind its back. The bus lock serializes them
+ * with an advisory flock() on one lock file per bus, named
+ * "<dir>/sht-i2c-<bus>.lock". The lock is held for a whole measure, wait and
+ * read sequence, or for a whole sweep. The outermost release closes the
+ * multiplexer path selected on the bus before dropping the lock, see
+ * sht_mux_close(), so the next process finds all channels disabled.
+ *
+ * The lock file also holds a generation counter incremented on every
+ * release. Finding a counter value other than the one written by the last
+ * release of this process means that another process used the bus in
+ * between; the multiplexers of the handles about to be accessed are then
+ * invalidated, see sht_mux_invalidate(), so their channels are rewritten.
+ *
+ * Locks are taken in ascending bus order, so processes sweeping several
+ * buses cannot deadlock, and may be nested within a process. All cooperating
+ * processes must map bus indices to the same adapters and use the same lock
+ * directory. Per bus contention statistics record how often and how long a
+ * process waited for another one.
+ *
+ * The module is only built on Linux.
+ */
+
+#ifndef SHT_BUSLOCK_H
+#define SHT_BUSLOCK_H
+
+#ifdef __linux__
+
+#include "sht_mux.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_IO (-9)
+
+/**
+ * @brief Lock directory used when no directory is given
+ */
+#ifndef SHT_BUSLOCK_DEFAULT_DIR
+#define SHT_BUSLOCK_DEFAULT_DIR "/run/lock"
+#endif
+
+/**
+ * @brief Number of lockable buses, at most 32
+ */
+#ifndef SHT_BUSLOCK_MAX_BUSES
+#define SHT_BUSLOCK_MAX_BUSES 8
+#endif
+
+/**
+ * @brief Lock state and contention statistics of one bus
+ */
+typedef struct _sht_buslock_bus {
+    int fd;                 /* lock file, -1 until first used */
+    uint16_t depth;         /* nesting depth of the acquisitions */
+    uint32_t generation;    /* counter value written by the last release */
+    uint32_t acquisitions;  /* outermost acquisitions */
+    uint32_t contended;     /* acquisitions that waited for another process */
+    uint32_t foreign;       /* acquisitions after another process' use */
+    uint32_t max_wait_usec; /* longest wait */
+    uint64_t wait_usec;     /* total wait */
+} sht_buslock_bus_t;
+
+typedef struct _sht_buslock {
+    const char* dir;
+    sht_buslock_bus_t buses[SHT_BUSLOCK_MAX_BUSES];
+} sht_buslock_t;
+
+/**
+ * @brief Initialize the bus locks, the lock files are opened on first use
+ *
+ * @param[out] lock the bus locks
+ * @param[in]  dir  the lock directory, NULL for SHT_BUSLOCK_DEFAULT_DIR; the
+ *                  string must outlive the locks
+ */
+void sht_buslock_init(sht_buslock_t* lock, const char* dir);
+
+/**
+ * @brief Close the lock files, releasing all held locks
+ *
+ * @param[in] lock the bus locks
+ */
+void sht_buslock_close(sht_buslock_t* lock);
+
+/**
+ * @brief Acquire the lock of a bus, waiting for other processes
+ *
+ * @param[in]  lock    the bus locks
+ * @param[in]  bus     the bus index
+ * @param[out] foreign set to 1 if another process used the bus since the
+ *                     last release of this process, may be NULL
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_buslock_acquire(sht_buslock_t* lock, uint8_t bus,
+                            uint8_t* foreign);
+
+/**
+ * @brief Release the lock of a bus, closing its multiplexer path on the
+ * outermost release
+ *
+ * @param[in] lock the bus locks
+ * @param[in] bus  the bus index
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_buslock_release(sht_buslock_t* lock, uint8_t bus);
+
+/**
+ * @brief Run sht_mux_sweep() holding the locks of all swept buses
+ *
+ * @param[in]  lock        the bus locks
+ * @param[in]  handles     the sensors
+ * @param[in]  order       the sweep order from sht_mux_plan()
+ * @param[in]  num_handles the number of sensors
+ * @param[in]  now_ms      the timestamp of the samples
+ * @param[out] samples     num_handles samples, in sweep order
+ * @param[out] failed      the number of failed reads or triggers
+ *
+ * @return 0 if the sweep ran, else the error code of the locking
+ */
+int16_t sht_buslock_sweep(sht_buslock_t* lock, sht_handle_t* handles,
+                          const uint16_t* order, uint16_t num_handles,
+                          uint32_t now_ms, sht_raw_sample_t* samples,
+                          uint16_t* failed);
+
+/**
+ * @brief Measure, wait for the conversion and read out one sensor holding
+ * the lock of its bus
+ *
+ * @param[in]  lock   the bus locks
+ * @param[in]  handle the sensor
+ * @param[in]  now_ms the timestamp of the sample
+ * @param[out] sample the sample, also filled in on error
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_buslock_read_sample(sht_buslock_t* lock, sht_handle_t* handle,
+                                uint32_t now_ms, sht_raw_sample_t* sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __linux__ */
+
+#endif /* SHT_BUSLOCK_H */
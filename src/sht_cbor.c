@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Preallocated CBOR encoding implementation
+ */
+
+#include "sht_cbor.h"
+
+#include <string.h>
+
+#define SHT_CBOR_UINT 0x00U
+#define SHT_CBOR_NEGINT 0x20U
+#define SHT_CBOR_ARRAY 0x80U
+/* additional information of fixed width arguments */
+#define SHT_CBOR_UINT8 24U
+#define SHT_CBOR_UINT16 25U
+#define SHT_CBOR_UINT32 26U
+
+/* offsets of the patched fields */
+#define SHT_CBOR_SERIAL_OFFSET 9
+#define SHT_CBOR_UNITS_OFFSET 20
+#define SHT_CBOR_COUNT_OFFSET 30
+
+static const uint8_t SHT_CBOR_HEADER[SHT_CBOR_HEADER_SIZE] = {
+    0xA3,                                     /* map(3) */
+    0x66, 's', 'e', 'r', 'i', 'a', 'l',       /* "serial" */
+    0x1A, 0x00, 0x00, 0x00, 0x00,             /* uint32 */
+    0x65, 'u', 'n', 'i', 't', 's',            /* "units" */
+    0x61, 'm',                                /* "m" */
+    0x67, 's', 'a', 'm', 'p', 'l', 'e', 's',  /* "samples" */
+    0x99, 0x00, 0x00                          /* array(uint16) */
+};
+
+static void sht_cbor_put16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+static void sht_cbor_put32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)(value >> 24);
+    p[1] = (uint8_t)(value >> 16);
+    p[2] = (uint8_t)(value >> 8);
+    p[3] = (uint8_t)value;
+}
+
+/* patch a fixed width 32 bit signed integer: type byte and argument */
+static void sht_cbor_put_int32(uint8_t* p, int32_t value) {
+    if (value < 0) {
+        p[0] = SHT_CBOR_NEGINT | SHT_CBOR_UINT32;
+        sht_cbor_put32(&p[1], (uint32_t)(-1 - value));
+    } else {
+        p[0] = SHT_CBOR_UINT | SHT_CBOR_UINT32;
+        sht_cbor_put32(&p[1], (uint32_t)value);
+    }
+}
+
+static uint8_t* sht_cbor_entry(const sht_cbor_batch_t* batch, uint16_t i) {
+    return &batch->buf[SHT_CBOR_HEADER_SIZE +
+                       (uint32_t)i * SHT_CBOR_ENTRY_SIZE(batch->units)];
+}
+
+int16_t sht_cbor_batch_init(sht_cbor_batch_t* batch, uint8_t* buf,
+                            uint16_t size, uint16_t capacity, uint8_t units) {
+    uint8_t entry[SHT_CBOR_ENTRY_SIZE(SHT_CBOR_MILLI)];
+    uint8_t value_size = units == SHT_CBOR_TICKS ? 3 : 5;
+    uint8_t value_type =
+        units == SHT_CBOR_TICKS ? SHT_CBOR_UINT16 : SHT_CBOR_UINT32;
+    uint16_t i;
+
+    if ((uint32_t)size < SHT_CBOR_BATCH_SIZE((uint32_t)capacity, units))
+        return STATUS_ERR_NO_SPACE;
+
+    batch->buf = buf;
+    batch->capacity = capacity;
+    batch->count = 0;
+    batch->units = units;
+
+    memcpy(buf, SHT_CBOR_HEADER, SHT_CBOR_HEADER_SIZE);
+    if (units == SHT_CBOR_TICKS)
+        buf[SHT_CBOR_UNITS_OFFSET] = 't';
+
+    /* [ts, t, rh, q] with zeroed arguments */
+    memset(entry, 0, sizeof(entry));
+    entry[0] = SHT_CBOR_ARRAY | 4;
+    entry[1] = SHT_CBOR_UINT32;
+    entry[6] = value_type;
+    entry[6 + value_size] = value_type;
+    entry[6 + 2 * value_size] = SHT_CBOR_UINT8;
+    for (i = 0; i < capacity; ++i)
+        memcpy(sht_cbor_entry(batch, i), entry, SHT_CBOR_ENTRY_SIZE(units));
+    return STATUS_OK;
+}
+
+void sht_cbor_batch_set_serial(sht_cbor_batch_t* batch, uint32_t serial) {
+    sht_cbor_put32(&batch->buf[SHT_CBOR_SERIAL_OFFSET], serial);
+}
+
+int16_t sht_cbor_batch_add(sht_cbor_batch_t* batch,
+                           const sht_raw_sample_t* sample, uint8_t flags) {
+    uint8_t* p;
+    int32_t temperature;
+    int32_t humidity;
+
+    if (batch->count == batch->capacity)
+        return STATUS_ERR_NO_SPACE;
+
+    p = sht_cbor_entry(batch, batch->count++);
+    if (sample->status != STATUS_OK)
+        flags |= SHT_CBOR_FLAG_READ_ERROR;
+
+    sht_cbor_put32(&p[2], sample->timestamp_ms);
+    if (batch->units == SHT_CBOR_TICKS) {
+        sht_cbor_put16(&p[7], sample->t_ticks);
+        sht_cbor_put16(&p[10], sample->rh_ticks);
+        p[13] = flags;
+    } else {
+        sht_raw_sample_convert(sample, &temperature, &humidity);
+        sht_cbor_put_int32(&p[6], temperature);
+        sht_cbor_put_int32(&p[11], humidity);
+        p[17] = flags;
+    }
+    return STATUS_OK;
+}
+
+uint16_t sht_cbor_batch_finish(sht_cbor_batch_t* batch) {
+    sht_cbor_put16(&batch->buf[SHT_CBOR_COUNT_OFFSET], batch->count);
+    return (uint16_t)(SHT_CBOR_HEADER_SIZE +
+                      batch->count * SHT_CBOR_ENTRY_SIZE(batch->units));
+}
+
+void sht_cbor_batch_reset(sht_cbor_batch_t* batch) {
+    batch->count = 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Preallocated CBOR encoding of sample batches
+ *
+ * A batch holds samples of one sensor and is encoded as the CBOR map
+ *
+ *     {"serial": uint, "units": "m" or "t", "samples": [[ts, t, rh, q], ...]}
+ *
+ * with the timestamp in ms, temperature and humidity in milli units ("m") or
+ * raw ticks ("t") and q the quality flags. Every integer is written with a
+ * fixed width encoding, so the whole batch is laid out once by
+ * sht_cbor_batch_init(): the map, the keys and the array headers are
+ * precomputed in the caller's buffer and encoding a sample only patches its
+ * integer fields in place. Finishing a batch patches the array length; the
+ * encoded batch is the prefix of the buffer up to the last sample.
+ *
+ * The fixed widths cost a few bytes per sample compared to the shortest
+ * encoding but are valid CBOR for any decoder.
+ */
+
+#ifndef SHT_CBOR_H
+#define SHT_CBOR_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Unit of the temperature and humidity fields
+ */
+typedef enum _sht_cbor_units {
+    SHT_CBOR_MILLI, /* milli degree Celsius and milli percent */
+    SHT_CBOR_TICKS  /* raw ticks */
+} sht_cbor_units_t;
+
+/**
+ * @brief Quality flag set for samples whose read failed
+ */
+#define SHT_CBOR_FLAG_READ_ERROR 0x01U
+
+/* map header, keys, serial, units value and samples array header */
+#define SHT_CBOR_HEADER_SIZE 32
+/* array header, timestamp, two uint32 or uint16 values, flags */
+#define SHT_CBOR_ENTRY_SIZE(units) ((units) == SHT_CBOR_TICKS ? 14 : 18)
+
+/**
+ * @brief Buffer size of a batch of up to n samples
+ */
+#define SHT_CBOR_BATCH_SIZE(n, units) \
+    (SHT_CBOR_HEADER_SIZE + (n)*SHT_CBOR_ENTRY_SIZE(units))
+
+typedef struct _sht_cbor_batch {
+    uint8_t* buf;
+    uint16_t capacity; /* samples */
+    uint16_t count;
+    uint8_t units; /* sht_cbor_units_t */
+} sht_cbor_batch_t;
+
+/**
+ * @brief Lay out the template of a batch in a buffer
+ *
+ * @param[out] batch    the batch
+ * @param[in]  buf      the buffer
+ * @param[in]  size     the size of buf
+ * @param[in]  capacity the maximum number of samples, at most 65535
+ * @param[in]  units    the sht_cbor_units_t of the values
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if buf is smaller than
+ * SHT_CBOR_BATCH_SIZE(capacity, units)
+ */
+int16_t sht_cbor_batch_init(sht_cbor_batch_t* batch, uint8_t* buf,
+                            uint16_t size, uint16_t capacity, uint8_t units);
+
+/**
+ * @brief Set the sensor serial of the batch, e.g. from sht3x_read_serial()
+ *
+ * @param[in] batch  the batch
+ * @param[in] serial the serial number
+ */
+void sht_cbor_batch_set_serial(sht_cbor_batch_t* batch, uint32_t serial);
+
+/**
+ * @brief Append a sample to the batch
+ *
+ * @param[in] batch  the batch
+ * @param[in] sample the sample
+ * @param[in] flags  application quality flags, SHT_CBOR_FLAG_READ_ERROR is
+ *                   added for a sample with an error status
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the batch is full
+ */
+int16_t sht_cbor_batch_add(sht_cbor_batch_t* batch,
+                           const sht_raw_sample_t* sample, uint8_t flags);
+
+/**
+ * @brief Complete the batch
+ *
+ * @param[in] batch the batch
+ *
+ * @return the length of the encoded batch at the start of the buffer
+ */
+uint16_t sht_cbor_batch_finish(sht_cbor_batch_t* batch);
+
+/**
+ * @brief Empty the batch for the next samples, keeping template and serial
+ *
+ * @param[in] batch the batch
+ */
+void sht_cbor_batch_reset(sht_cbor_batch_t* batch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_CBOR_H */
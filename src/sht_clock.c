@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus clock selection implementation
+ */
+
+#include "sht_clock.h"
+
+#include <stddef.h>
+
+/* clock of each bus as last set, 0 if unknown */
+static uint16_t sht_clock_current[SHT_MUX_MAX_BUSES];
+/* highest clock of the unmanaged devices of each bus, 0 for the default */
+static uint16_t sht_clock_bus_limit[SHT_MUX_MAX_BUSES];
+static sht_clock_set_fn sht_clock_set = NULL;
+static void* sht_clock_user_data = NULL;
+
+static uint16_t sht_clock_min(uint16_t a, uint16_t b) {
+    return (b && b < a) ? b : a;
+}
+
+void sht_clock_set_backend(sht_clock_set_fn set, void* user_data) {
+    uint8_t i;
+
+    sht_clock_set = set;
+    sht_clock_user_data = user_data;
+    for (i = 0; i < SHT_MUX_MAX_BUSES; ++i)
+        sht_clock_current[i] = 0;
+}
+
+void sht_clock_set_bus_limit(uint8_t bus, uint16_t clock_khz) {
+    if (bus < SHT_MUX_MAX_BUSES)
+        sht_clock_bus_limit[bus] = clock_khz;
+}
+
+uint16_t sht_clock_handle_khz(const sht_handle_t* handle) {
+    const sht_mux_t* m;
+    uint16_t khz = handle->clock_khz ? handle->clock_khz
+                                     : SHT_CLOCK_DEFAULT_KHZ;
+    uint8_t depth = 0;
+
+    for (m = handle->mux; m && depth < SHT_MUX_MAX_DEPTH; m = m->parent) {
+        khz = sht_clock_min(khz, m->clock_khz);
+        depth++;
+    }
+    if (handle->bus < SHT_MUX_MAX_BUSES)
+        khz = sht_clock_min(khz, sht_clock_bus_limit[handle->bus]
+                                     ? sht_clock_bus_limit[handle->bus]
+                                     : SHT_CLOCK_DEFAULT_KHZ);
+    return khz;
+}
+
+int16_t sht_clock_select(uint8_t bus, uint16_t clock_khz) {
+    int16_t ret;
+
+    if (!sht_clock_set || bus >= SHT_MUX_MAX_BUSES ||
+        sht_clock_current[bus] == clock_khz)
+        return STATUS_OK;
+
+    ret = sht_clock_set(sht_clock_user_data, bus, clock_khz);
+    sht_clock_current[bus] = ret == STATUS_OK ? clock_khz : 0;
+    return ret;
+}
+
+int16_t sht_clock_limit(uint8_t bus, uint16_t clock_khz) {
+    /* an unknown clock may be anything, set it */
+    if (bus < SHT_MUX_MAX_BUSES && sht_clock_current[bus] &&
+        sht_clock_current[bus] <= clock_khz)
+        return STATUS_OK;
+    return sht_clock_select(bus, clock_khz);
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Per-sensor bus clock selection
+ *
+ * SHT3x and SHT4x support Fast-mode Plus (1 MHz) while other devices sharing
+ * a bus often only support Fast-mode (400 kHz) or Standard-mode (100 kHz).
+ * A transaction may run at the highest clock every device that sees it
+ * supports: the sensor (sht_handle_t.clock_khz), each multiplexer on its path
+ * (sht_mux_t.clock_khz) and the devices on the bus segment itself that the
+ * library does not manage (the bus limit).
+ *
+ * Clock changes go through a backend callback, since the HAL has no clock
+ * API; without a callback the clock is never changed. The current clock of
+ * every bus is cached so the backend is only called when it changes, and
+ * sht_mux_plan() orders the handles by clock so a sweep switches the clock
+ * at most once per distinct clock and bus.
+ *
+ * When the multiplexer path changes, the previously enabled segments still
+ * see the control register writes. The clock is therefore lowered before the
+ * path is switched but only raised once the new path is enabled.
+ *
+ * Devices on an enabled segment see all transactions on it, addressed to
+ * them or not. The clock_khz of a mux must therefore also cover unmanaged
+ * devices on the segment the mux hangs on, and sensors sharing a segment
+ * should be given the clock of the slowest of them.
+ */
+
+#ifndef SHT_CLOCK_H
+#define SHT_CLOCK_H
+
+#include "sht_mux.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_CLOCK_STANDARD_KHZ 100
+#define SHT_CLOCK_FAST_KHZ 400
+#define SHT_CLOCK_FAST_PLUS_KHZ 1000
+
+/**
+ * @brief Clock of handles and buses without clock information
+ */
+#ifndef SHT_CLOCK_DEFAULT_KHZ
+#define SHT_CLOCK_DEFAULT_KHZ SHT_CLOCK_STANDARD_KHZ
+#endif
+
+/**
+ * @brief Backend callback setting the SCL frequency of a bus
+ *
+ * @return 0 on success, else an error code
+ */
+typedef int16_t (*sht_clock_set_fn)(void* user_data, uint8_t bus,
+                                    uint16_t clock_khz);
+
+/**
+ * @brief Install the backend clock callback; the clock of every bus is
+ * unknown afterwards
+ *
+ * @param[in] set       the callback, NULL if the backend has a fixed clock
+ * @param[in] user_data passed to the callback
+ */
+void sht_clock_set_backend(sht_clock_set_fn set, void* user_data);
+
+/**
+ * @brief Set the highest clock the unmanaged devices of a bus support
+ *
+ * @param[in] bus       the bus index, below SHT_MUX_MAX_BUSES
+ * @param[in] clock_khz the limit, 0 for SHT_CLOCK_DEFAULT_KHZ
+ */
+void sht_clock_set_bus_limit(uint8_t bus, uint16_t clock_khz);
+
+/**
+ * @brief Return the highest clock usable for transactions with a sensor
+ *
+ * @param[in] handle the sensor
+ *
+ * @return the clock in kHz
+ */
+uint16_t sht_clock_handle_khz(const sht_handle_t* handle);
+
+/**
+ * @brief Set the clock of a bus, calling the backend only if it changes
+ *
+ * @param[in] bus       the bus index
+ * @param[in] clock_khz the clock
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_clock_select(uint8_t bus, uint16_t clock_khz);
+
+/**
+ * @brief Lower the clock of a bus if it is above clock_khz
+ *
+ * @param[in] bus       the bus index
+ * @param[in] clock_khz the highest allowed clock
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_clock_limit(uint8_t bus, uint16_t clock_khz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_CLOCK_H */
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief COBS framed sample stream implementation
+ */
+
+#include "sht_cobs.h"
+
+#include <stddef.h>
+
+#define SHT_COBS_MAX_CODE 0xFF
+/* room for the COBS code a sample may start and for the delimiter */
+#define SHT_COBS_ENCODE_RESERVE 2
+
+/* CRC-16/CCITT, one nibble at a time */
+static const uint16_t SHT_COBS_CRC_TABLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+uint16_t sht_cobs_crc16(uint16_t crc, const uint8_t* data, uint16_t count) {
+    uint16_t i;
+
+    for (i = 0; i < count; ++i) {
+        crc = (uint16_t)((crc << 4) ^
+                         SHT_COBS_CRC_TABLE[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^
+                         SHT_COBS_CRC_TABLE[(crc >> 12) ^ (data[i] & 0x0F)]);
+    }
+    return crc;
+}
+
+static void sht_cobs_put(sht_cobs_encoder_t* enc, uint8_t byte) {
+    enc->crc = sht_cobs_crc16(enc->crc, &byte, 1);
+    if (byte) {
+        enc->buf[enc->pos++] = byte;
+        if (++enc->code != SHT_COBS_MAX_CODE)
+            return;
+    }
+    /* close the block and open the next one */
+    enc->buf[enc->code_pos] = enc->code;
+    enc->code_pos = enc->pos++;
+    enc->code = 1;
+}
+
+static void sht_cobs_put16(sht_cobs_encoder_t* enc, uint16_t value) {
+    sht_cobs_put(enc, (uint8_t)(value >> 8));
+    sht_cobs_put(enc, (uint8_t)value);
+}
+
+static uint16_t sht_cobs_get16(const uint8_t* data) {
+    return (uint16_t)((data[0] << 8) | data[1]);
+}
+
+void sht_cobs_encoder_begin(sht_cobs_encoder_t* enc, uint8_t* buf,
+                            uint16_t size) {
+    enc->buf = buf;
+    enc->size = size;
+    enc->pos = 1;
+    enc->code_pos = 0;
+    enc->code = 1;
+    enc->crc = 0xFFFF;
+    enc->samples = 0;
+    enc->base_ms = 0;
+}
+
+int16_t sht_cobs_encoder_add(sht_cobs_encoder_t* enc,
+                             const sht_raw_sample_t* sample) {
+    uint32_t offset;
+    uint16_t need = SHT_COBS_SAMPLE_SIZE + SHT_COBS_CRC_SIZE +
+                    SHT_COBS_ENCODE_RESERVE;
+    int16_t status = sample->status;
+
+    if (!enc->samples) {
+        need += SHT_COBS_HEADER_SIZE;
+        offset = 0;
+    } else {
+        offset = sample->timestamp_ms - enc->base_ms;
+    }
+    if (enc->samples == SHT_COBS_MAX_SAMPLES || offset > UINT16_MAX ||
+        enc->pos + need > enc->size)
+        return STATUS_ERR_NO_SPACE;
+
+    if (!enc->samples) {
+        enc->base_ms = sample->timestamp_ms;
+        sht_cobs_put(enc, SHT_COBS_VERSION);
+        sht_cobs_put16(enc, (uint16_t)(enc->base_ms >> 16));
+        sht_cobs_put16(enc, (uint16_t)enc->base_ms);
+    }
+
+    /* status codes are small negative numbers */
+    if (status < INT8_MIN)
+        status = INT8_MIN;
+    sht_cobs_put16(enc, (uint16_t)offset);
+    sht_cobs_put16(enc, sample->sensor_id);
+    sht_cobs_put16(enc, sample->seq);
+    sht_cobs_put16(enc, sample->t_ticks);
+    sht_cobs_put16(enc, sample->rh_ticks);
+    sht_cobs_put(enc, (uint8_t)(int8_t)status);
+    sht_cobs_put(enc, (uint8_t)((sample->bus << 2) | (sample->family & 0x03)));
+    enc->samples++;
+    return STATUS_OK;
+}
+
+uint16_t sht_cobs_encoder_finish(sht_cobs_encoder_t* enc) {
+    uint16_t crc = enc->crc;
+
+    if (!enc->samples)
+        return 0;
+    sht_cobs_put16(enc, crc);
+    enc->buf[enc->code_pos] = enc->code;
+    enc->buf[enc->pos++] = 0;
+    return enc->pos;
+}
+
+void sht_cobs_decoder_init(sht_cobs_decoder_t* dec, uint8_t* buf,
+                           uint16_t size) {
+    dec->buf = buf;
+    dec->size = size;
+    dec->len = 0;
+    dec->code = SHT_COBS_MAX_CODE;
+    dec->remaining = 0;
+    dec->discard = 0;
+    dec->complete = 0;
+    dec->frames = 0;
+    dec->errors = 0;
+}
+
+static uint16_t sht_cobs_decoder_end(sht_cobs_decoder_t* dec) {
+    uint16_t len = dec->len;
+    uint16_t samples;
+
+    if (dec->discard || dec->remaining || len < SHT_COBS_PAYLOAD_SIZE(1) ||
+        (len - SHT_COBS_PAYLOAD_SIZE(0)) % SHT_COBS_SAMPLE_SIZE ||
+        dec->buf[0] != SHT_COBS_VERSION ||
+        sht_cobs_crc16(0xFFFF, dec->buf, len - SHT_COBS_CRC_SIZE) !=
+            sht_cobs_get16(&dec->buf[len - SHT_COBS_CRC_SIZE])) {
+        /* back-to-back delimiters are no error */
+        if (len || dec->discard || dec->remaining)
+            dec->errors++;
+        return 0;
+    }
+    samples = (len - SHT_COBS_PAYLOAD_SIZE(0)) / SHT_COBS_SAMPLE_SIZE;
+    dec->frames++;
+    return samples;
+}
+
+uint16_t sht_cobs_decoder_push(sht_cobs_decoder_t* dec, uint8_t byte) {
+    uint16_t samples;
+
+    if (!byte) {
+        /* the frame in buf was delivered by the previous delimiter */
+        if (dec->complete) {
+            dec->len = 0;
+            return 0;
+        }
+        samples = sht_cobs_decoder_end(dec);
+        /* keep the payload until the next byte, the samples are read from
+         * the buffer */
+        dec->complete = 1;
+        dec->code = SHT_COBS_MAX_CODE;
+        dec->remaining = 0;
+        dec->discard = 0;
+        return samples;
+    }
+    if (dec->complete) {
+        dec->len = 0;
+        dec->complete = 0;
+    }
+    if (dec->discard)
+        return 0;
+
+    if (dec->remaining == 0) {
+        /* a block shorter than the maximum stands for a zero byte, unless
+         * the frame ends after it */
+        if (dec->code != SHT_COBS_MAX_CODE) {
+            if (dec->len == dec->size) {
+                dec->discard = 1;
+                return 0;
+            }
+            dec->buf[dec->len++] = 0;
+        }
+        dec->code = byte;
+        dec->remaining = (uint8_t)(byte - 1);
+        return 0;
+    }
+
+    if (dec->len == dec->size) {
+        dec->discard = 1;
+        return 0;
+    }
+    dec->buf[dec->len++] = byte;
+    dec->remaining--;
+    return 0;
+}
+
+void sht_cobs_decoder_sample(const sht_cobs_decoder_t* dec, uint16_t index,
+                             sht_raw_sample_t* sample) {
+    const uint8_t* p =
+        &dec->buf[SHT_COBS_HEADER_SIZE + index * SHT_COBS_SAMPLE_SIZE];
+    uint32_t base = ((uint32_t)sht_cobs_get16(&dec->buf[1]) << 16) |
+                    sht_cobs_get16(&dec->buf[3]);
+
+    sample->timestamp_ms = base + sht_cobs_get16(&p[0]);
+    sample->sensor_id = sht_cobs_get16(&p[2]);
+    sample->seq = sht_cobs_get16(&p[4]);
+    sample->t_ticks = sht_cobs_get16(&p[6]);
+    sample->rh_ticks = sht_cobs_get16(&p[8]);
+    sample->status = (int8_t)p[10];
+    sample->bus = p[11] >> 2;
+    sample->family = p[11] & 0x03;
+}
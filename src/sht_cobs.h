@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief COBS framed binary sample stream
+ *
+ * Raw samples are packed into binary frames for byte oriented links such as
+ * a UART. A frame carries a version byte, the timestamp of its first sample
+ * and up to SHT_COBS_MAX_SAMPLES samples of 12 bytes each (timestamp offset,
+ * sensor id, sequence number, ticks, status, family and bus), all big-endian,
+ * followed by a CRC-16/CCITT over the payload. The frame is COBS encoded, so
+ * it contains no zero byte, and terminated by a zero byte.
+ *
+ * A sample takes about 12.3 bytes on the wire in full frames, against
+ * some 40 characters for the same information as a CSV line.
+ *
+ * Encoder and decoder work incrementally on caller provided buffers. The
+ * encoder COBS encodes each sample as it is added and backpatches the block
+ * codes, the decoder consumes one received byte at a time. Any zero byte
+ * ends a frame, so after a corrupted or truncated frame the decoder is back
+ * in sync with the next frame; corrupted frames fail the CRC and are
+ * dropped.
+ */
+
+#ifndef SHT_COBS_H
+#define SHT_COBS_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_COBS_VERSION 1
+
+/* version, base timestamp */
+#define SHT_COBS_HEADER_SIZE 5
+/* timestamp offset, id, seq, t, rh, status, family and bus */
+#define SHT_COBS_SAMPLE_SIZE 12
+#define SHT_COBS_CRC_SIZE 2
+
+/**
+ * @brief Largest number of samples of a frame
+ */
+#ifndef SHT_COBS_MAX_SAMPLES
+#define SHT_COBS_MAX_SAMPLES 32
+#endif
+
+/**
+ * @brief Payload size of a frame of n samples
+ */
+#define SHT_COBS_PAYLOAD_SIZE(n) \
+    (SHT_COBS_HEADER_SIZE + (n)*SHT_COBS_SAMPLE_SIZE + SHT_COBS_CRC_SIZE)
+
+/**
+ * @brief Buffer size for an encoded frame of n samples: payload, one COBS
+ * code per started 254 bytes block plus one, and the delimiter
+ */
+#define SHT_COBS_FRAME_SIZE(n) \
+    (SHT_COBS_PAYLOAD_SIZE(n) + SHT_COBS_PAYLOAD_SIZE(n) / 254 + 2)
+
+/**
+ * @brief Frame being encoded
+ */
+typedef struct _sht_cobs_encoder {
+    uint8_t* buf;
+    uint16_t size;
+    uint16_t pos;      /* next byte to write */
+    uint16_t code_pos; /* position of the open block code */
+    uint8_t code;      /* code of the open block */
+    uint16_t crc;
+    uint16_t samples;
+    uint32_t base_ms; /* timestamp of the first sample */
+} sht_cobs_encoder_t;
+
+/**
+ * @brief Frame being decoded
+ */
+typedef struct _sht_cobs_decoder {
+    uint8_t* buf; /* decoded payload */
+    uint16_t size;
+    uint16_t len;
+    uint8_t code;      /* code of the current block */
+    uint8_t remaining; /* bytes left in the current block */
+    uint8_t discard;   /* drop bytes until the next delimiter */
+    uint8_t complete;  /* a delimiter ended the frame in buf */
+    uint32_t frames;   /* valid frames received */
+    uint32_t errors;   /* frames dropped */
+} sht_cobs_decoder_t;
+
+/**
+ * @brief Compute the CRC-16/CCITT (polynomial 0x1021, init 0xFFFF)
+ *
+ * @param[in] crc   the CRC of the preceding data, 0xFFFF to start
+ * @param[in] data  the data
+ * @param[in] count the number of bytes
+ *
+ * @return the CRC
+ */
+uint16_t sht_cobs_crc16(uint16_t crc, const uint8_t* data, uint16_t count);
+
+/**
+ * @brief Start a frame
+ *
+ * @param[out] enc  the encoder
+ * @param[in]  buf  the frame buffer, see SHT_COBS_FRAME_SIZE()
+ * @param[in]  size the size of buf
+ */
+void sht_cobs_encoder_begin(sht_cobs_encoder_t* enc, uint8_t* buf,
+                            uint16_t size);
+
+/**
+ * @brief Append a sample to the frame
+ *
+ * @param[in] enc    the encoder
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the frame is full or the
+ * sample is more than 65535 ms after the first one; finish the frame and
+ * add the sample to the next one
+ */
+int16_t sht_cobs_encoder_add(sht_cobs_encoder_t* enc,
+                             const sht_raw_sample_t* sample);
+
+/**
+ * @brief Complete the frame with its CRC and delimiter
+ *
+ * @param[in] enc the encoder
+ *
+ * @return the number of bytes of the frame to send, 0 if it has no sample
+ */
+uint16_t sht_cobs_encoder_finish(sht_cobs_encoder_t* enc);
+
+/**
+ * @brief Initialize a decoder
+ *
+ * @param[out] dec  the decoder
+ * @param[in]  buf  the payload buffer
+ * @param[in]  size the size of buf, SHT_COBS_PAYLOAD_SIZE() of the largest
+ *                  expected frame
+ */
+void sht_cobs_decoder_init(sht_cobs_decoder_t* dec, uint8_t* buf,
+                           uint16_t size);
+
+/**
+ * @brief Feed one received byte to the decoder
+ *
+ * @param[in] dec  the decoder
+ * @param[in] byte the byte
+ *
+ * @return the number of samples once a valid frame is complete, else 0. The
+ * samples can be retrieved with sht_cobs_decoder_sample() until the next
+ * byte is fed.
+ */
+uint16_t sht_cobs_decoder_push(sht_cobs_decoder_t* dec, uint8_t byte);
+
+/**
+ * @brief Retrieve a sample of the frame completed last
+ *
+ * @param[in]  dec    the decoder
+ * @param[in]  index  the sample index
+ * @param[out] sample the sample
+ */
+void sht_cobs_decoder_sample(const sht_cobs_decoder_t* dec, uint16_t index,
+                             sht_raw_sample_t* sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_COBS_H */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Work-stealing executor implementation
+ */
+
+#include "sht_executor.h"
+
+#include <stddef.h>
+
+#define SHT_EXECUTOR_NO_STRAND 0xFFFFU
+
+static void sht_executor_lock(sht_executor_t* exec, uint16_t lock_id) {
+    if (exec->lock)
+        exec->lock(exec->user_data, lock_id);
+}
+
+static void sht_executor_unlock(sht_executor_t* exec, uint16_t lock_id) {
+    if (exec->unlock)
+        exec->unlock(exec->user_data, lock_id);
+}
+
+static void sht_executor_push(sht_executor_t* exec, uint8_t worker,
+                              uint16_t strand) {
+    sht_executor_worker_t* w = &exec->workers[worker];
+    uint16_t tail;
+
+    /* a strand is queued at most once, so a queue never overflows */
+    sht_executor_lock(exec, SHT_EXECUTOR_WORKER_LOCK(worker));
+    tail = (uint16_t)((w->head + w->count) % exec->num_strands);
+    w->slots[tail] = strand;
+    w->count++;
+    sht_executor_unlock(exec, SHT_EXECUTOR_WORKER_LOCK(worker));
+}
+
+/* the owner takes the oldest strand, thieves take the newest one */
+static uint16_t sht_executor_pop(sht_executor_t* exec, uint8_t worker,
+                                 uint8_t steal) {
+    sht_executor_worker_t* w = &exec->workers[worker];
+    uint16_t strand = SHT_EXECUTOR_NO_STRAND;
+
+    sht_executor_lock(exec, SHT_EXECUTOR_WORKER_LOCK(worker));
+    if (w->count) {
+        w->count--;
+        if (steal) {
+            strand = w->slots[(w->head + w->count) % exec->num_strands];
+        } else {
+            strand = w->slots[w->head];
+            w->head = (uint16_t)((w->head + 1) % exec->num_strands);
+        }
+    }
+    sht_executor_unlock(exec, SHT_EXECUTOR_WORKER_LOCK(worker));
+    return strand;
+}
+
+int16_t sht_executor_init(sht_executor_t* exec, sht_executor_worker_t* workers,
+                          uint8_t num_workers, sht_executor_strand_t* strands,
+                          uint16_t num_strands, uint16_t* slot_storage,
+                          sht_raw_sample_t* sample_storage,
+                          uint16_t strand_depth, sht_executor_lock_fn lock,
+                          sht_executor_lock_fn unlock,
+                          sht_executor_process_fn process, void* user_data) {
+    uint16_t i;
+
+    if (!num_workers || !num_strands || !strand_depth || !process ||
+        num_strands == SHT_EXECUTOR_NO_STRAND)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    for (i = 0; i < num_workers; ++i) {
+        workers[i].slots = &slot_storage[(uint32_t)i * num_strands];
+        workers[i].head = 0;
+        workers[i].count = 0;
+        workers[i].processed = 0;
+        workers[i].stolen = 0;
+    }
+    for (i = 0; i < num_strands; ++i) {
+        strands[i].samples = &sample_storage[(uint32_t)i * strand_depth];
+        strands[i].head = 0;
+        strands[i].count = 0;
+        strands[i].runnable = 0;
+    }
+    exec->workers = workers;
+    exec->strands = strands;
+    exec->num_workers = num_workers;
+    exec->num_strands = num_strands;
+    exec->strand_depth = strand_depth;
+    exec->lock = lock;
+    exec->unlock = unlock;
+    exec->process = process;
+    exec->user_data = user_data;
+    return STATUS_OK;
+}
+
+int16_t sht_executor_submit(sht_executor_t* exec,
+                            const sht_raw_sample_t* sample) {
+    sht_executor_strand_t* s;
+    uint16_t id = sample->sensor_id;
+    uint8_t wake;
+
+    if (id >= exec->num_strands)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    s = &exec->strands[id];
+    sht_executor_lock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, id));
+    if (s->count == exec->strand_depth) {
+        sht_executor_unlock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, id));
+        return STATUS_ERR_NO_SPACE;
+    }
+    s->samples[(s->head + s->count) % exec->strand_depth] = *sample;
+    s->count++;
+    wake = !s->runnable;
+    s->runnable = 1;
+    sht_executor_unlock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, id));
+
+    if (wake)
+        sht_executor_push(exec, (uint8_t)(sample->bus % exec->num_workers),
+                          id);
+    return STATUS_OK;
+}
+
+uint16_t sht_executor_run_once(sht_executor_t* exec, uint8_t worker) {
+    sht_executor_strand_t* s;
+    sht_raw_sample_t sample;
+    uint16_t strand;
+    uint16_t done = 0;
+    uint8_t more;
+    uint8_t i;
+
+    strand = sht_executor_pop(exec, worker, 0);
+    for (i = 1; strand == SHT_EXECUTOR_NO_STRAND && i < exec->num_workers;
+         ++i) {
+        strand = sht_executor_pop(
+            exec, (uint8_t)((worker + i) % exec->num_workers), 1);
+        if (strand != SHT_EXECUTOR_NO_STRAND)
+            exec->workers[worker].stolen++;
+    }
+    if (strand == SHT_EXECUTOR_NO_STRAND)
+        return 0;
+
+    /* the strand stays flagged runnable while it is processed here, so no
+     * other worker can pick it up and reorder its samples */
+    s = &exec->strands[strand];
+    do {
+        sht_executor_lock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, strand));
+        sample = s->samples[s->head];
+        s->head = (uint16_t)((s->head + 1) % exec->strand_depth);
+        s->count--;
+        sht_executor_unlock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, strand));
+
+        exec->process(exec->user_data, worker, &sample);
+        done++;
+
+        sht_executor_lock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, strand));
+        more = s->count != 0;
+        if (!more)
+            s->runnable = 0;
+        sht_executor_unlock(exec, SHT_EXECUTOR_STRAND_LOCK(exec, strand));
+    } while (more && done < SHT_EXECUTOR_STRAND_BATCH);
+
+    /* yield to the other strands, keep the remainder on this worker */
+    if (more)
+        sht_executor_push(exec, worker, strand);
+
+    exec->workers[worker].processed += done;
+    return done;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Work-stealing executor for raw sample post-processing
+ *
+ * Sampler threads (typically one per bus) submit completed raw samples and a
+ * set of worker threads run the processing callback on them. Samples are
+ * grouped in one strand per sensor: a strand is only ever processed by one
+ * worker at a time, so samples of the same sensor are processed in submission
+ * order while different sensors are processed in parallel.
+ *
+ * Each worker owns a queue of runnable strands, seeded with the strands of the
+ * buses mapped to it. An idle worker steals runnable strands from the other
+ * workers, so the load follows the available cores instead of the busiest bus.
+ *
+ * The executor neither creates threads nor allocates memory: the application
+ * provides all storage and the lock callbacks, and calls
+ * sht_executor_run_once() from its worker threads. Lock ids are never nested,
+ * so the application may map them onto a smaller set of mutexes.
+ */
+
+#ifndef SHT_EXECUTOR_H
+#define SHT_EXECUTOR_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of lock ids used by an executor
+ */
+#define SHT_EXECUTOR_LOCK_COUNT(num_workers, num_strands) \
+    ((num_workers) + (num_strands))
+
+/**
+ * @brief Lock id guarding the strand queue of a worker
+ */
+#define SHT_EXECUTOR_WORKER_LOCK(worker) (worker)
+
+/**
+ * @brief Lock id guarding the sample queue of a strand
+ */
+#define SHT_EXECUTOR_STRAND_LOCK(exec, strand) ((exec)->num_workers + (strand))
+
+/**
+ * @brief Maximum number of samples of one strand processed before the worker
+ * moves on to the next runnable strand
+ */
+#ifndef SHT_EXECUTOR_STRAND_BATCH
+#define SHT_EXECUTOR_STRAND_BATCH 8
+#endif
+
+typedef void (*sht_executor_lock_fn)(void* user_data, uint16_t lock_id);
+
+typedef void (*sht_executor_process_fn)(void* user_data, uint8_t worker,
+                                        const sht_raw_sample_t* sample);
+
+/**
+ * @brief Pending samples of one sensor
+ */
+typedef struct _sht_executor_strand {
+    sht_raw_sample_t* samples; /* ring of strand_depth samples */
+    uint16_t head;
+    uint16_t count;
+    uint8_t runnable; /* queued on a worker or being processed */
+} sht_executor_strand_t;
+
+/**
+ * @brief Runnable strands of one worker
+ */
+typedef struct _sht_executor_worker {
+    uint16_t* slots; /* ring of num_strands strand indices */
+    uint16_t head;
+    uint16_t count;
+    uint32_t processed; /* samples processed by this worker */
+    uint32_t stolen;    /* strands taken from other workers */
+} sht_executor_worker_t;
+
+typedef struct _sht_executor {
+    sht_executor_worker_t* workers;
+    sht_executor_strand_t* strands;
+    uint8_t num_workers;
+    uint16_t num_strands;
+    uint16_t strand_depth;
+    sht_executor_lock_fn lock;
+    sht_executor_lock_fn unlock;
+    sht_executor_process_fn process;
+    void* user_data;
+} sht_executor_t;
+
+/**
+ * @brief Initialize an executor on caller provided storage
+ *
+ * @param[out] exec          the executor
+ * @param[in]  workers       storage for num_workers workers
+ * @param[in]  num_workers   number of worker threads
+ * @param[in]  strands       storage for num_strands strands, one per sensor id
+ * @param[in]  num_strands   number of sensors
+ * @param[in]  slot_storage  storage for num_workers * num_strands indices
+ * @param[in]  sample_storage storage for num_strands * strand_depth samples
+ * @param[in]  strand_depth  maximum number of pending samples per sensor
+ * @param[in]  lock          callback acquiring a lock id, may be NULL when
+ *                           the executor is used from a single thread
+ * @param[in]  unlock        callback releasing a lock id, may be NULL
+ * @param[in]  process       the processing pipeline
+ * @param[in]  user_data     passed to the callbacks
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_executor_init(sht_executor_t* exec, sht_executor_worker_t* workers,
+                          uint8_t num_workers, sht_executor_strand_t* strands,
+                          uint16_t num_strands, uint16_t* slot_storage,
+                          sht_raw_sample_t* sample_storage,
+                          uint16_t strand_depth, sht_executor_lock_fn lock,
+                          sht_executor_lock_fn unlock,
+                          sht_executor_process_fn process, void* user_data);
+
+/**
+ * @brief Submit a raw sample for processing. The sample is queued on the
+ * strand of sample->sensor_id; if the strand was idle it becomes runnable on
+ * the worker owning sample->bus.
+ *
+ * @param[in] exec   the executor
+ * @param[in] sample the sample, copied into the executor
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the strand is full, else an
+ * error code
+ */
+int16_t sht_executor_submit(sht_executor_t* exec,
+                            const sht_raw_sample_t* sample);
+
+/**
+ * @brief Process up to SHT_EXECUTOR_STRAND_BATCH samples of one runnable
+ * strand, stealing a strand from another worker if the own queue is empty.
+ *
+ * @param[in] exec   the executor
+ * @param[in] worker index of the calling worker
+ *
+ * @return the number of samples processed, 0 if no work was found
+ */
+uint16_t sht_executor_run_once(sht_executor_t* exec, uint8_t worker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_EXECUTOR_H */
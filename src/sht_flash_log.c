@@ -0,0 +1,661 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Wear-leveled sample log implementation
+ */
+
+#include "sht_flash_log.h"
+#include "sht_cobs.h"
+
+#define SHT_FLASH_LOG_MAGIC 0x534CU
+#define SHT_FLASH_LOG_CHECKPOINT_MAGIC 0x434BU
+/* bytes read per callback while checking a page */
+#define SHT_FLASH_LOG_CHUNK 32
+
+typedef enum _sht_flash_log_page {
+    SHT_FLASH_LOG_PAGE_VALID,
+    SHT_FLASH_LOG_PAGE_BLANK,
+    SHT_FLASH_LOG_PAGE_CORRUPT
+} sht_flash_log_page_t;
+
+static uint32_t sht_flash_log_addr(const sht_flash_log_t* log,
+                                   uint32_t page) {
+    return log->base + page * log->page_size;
+}
+
+static uint32_t sht_flash_log_next(const sht_flash_log_t* log,
+                                   uint32_t page) {
+    return page + 1 == log->num_pages ? 0 : page + 1;
+}
+
+static uint32_t sht_flash_log_get32(const uint8_t* p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 |
+           p[3];
+}
+
+static void sht_flash_log_put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/* CRC of a page image: the header up to the CRC field and the records */
+static uint16_t sht_flash_log_crc(const uint8_t* page, uint16_t len) {
+    uint16_t crc = sht_cobs_crc16(0xFFFF, page, SHT_FLASH_LOG_HEADER_SIZE - 2);
+    return sht_cobs_crc16(crc, &page[SHT_FLASH_LOG_HEADER_SIZE],
+                          (uint16_t)(len - SHT_FLASH_LOG_HEADER_SIZE));
+}
+
+static int16_t sht_flash_log_io(sht_flash_log_t* log, int16_t ret) {
+    if (ret != STATUS_OK)
+        log->stats.flash_errors++;
+    return ret;
+}
+
+/* classify a page; a valid page's sequence number and count are returned */
+static int16_t sht_flash_log_check(sht_flash_log_t* log, uint32_t page,
+                                   uint32_t* seq, uint16_t* count) {
+    uint8_t buf[SHT_FLASH_LOG_CHUNK];
+    uint32_t addr = sht_flash_log_addr(log, page);
+    uint16_t len;
+    uint16_t pos;
+    uint16_t n;
+    uint16_t crc;
+    uint16_t calc;
+    uint16_t i;
+    uint8_t blank = 1;
+    int16_t ret;
+
+    ret = sht_flash_log_io(
+        log, log->ops->read(log->ctx, addr, buf, SHT_FLASH_LOG_HEADER_SIZE));
+    if (ret != STATUS_OK)
+        return ret;
+    for (i = 0; i < SHT_FLASH_LOG_HEADER_SIZE; ++i)
+        blank &= buf[i] == 0xFF;
+
+    if (blank) {
+        /* a page whose program was cut short may still have a blank
+         * header, so the whole page has to be blank */
+        for (pos = SHT_FLASH_LOG_HEADER_SIZE; pos < log->page_size;
+             pos = (uint16_t)(pos + n)) {
+            n = (uint16_t)(log->page_size - pos);
+            if (n > SHT_FLASH_LOG_CHUNK)
+                n = SHT_FLASH_LOG_CHUNK;
+            ret = sht_flash_log_io(
+                log, log->ops->read(log->ctx, addr + pos, buf, n));
+            if (ret != STATUS_OK)
+                return ret;
+            for (i = 0; i < n; ++i) {
+                if (buf[i] != 0xFF)
+                    return SHT_FLASH_LOG_PAGE_CORRUPT;
+            }
+        }
+        return SHT_FLASH_LOG_PAGE_BLANK;
+    }
+
+    if (((uint16_t)buf[0] << 8 | buf[1]) != SHT_FLASH_LOG_MAGIC ||
+        buf[6] > log->records_per_page)
+        return SHT_FLASH_LOG_PAGE_CORRUPT;
+    *seq = sht_flash_log_get32(&buf[2]);
+    *count = buf[6];
+    crc = (uint16_t)((uint16_t)buf[8] << 8 | buf[9]);
+
+    len = (uint16_t)(SHT_FLASH_LOG_HEADER_SIZE +
+                     *count * SHT_FLASH_LOG_RECORD_SIZE);
+    calc = sht_cobs_crc16(0xFFFF, buf, SHT_FLASH_LOG_HEADER_SIZE - 2);
+    for (pos = SHT_FLASH_LOG_HEADER_SIZE; pos < len;
+         pos = (uint16_t)(pos + n)) {
+        n = (uint16_t)(len - pos);
+        if (n > SHT_FLASH_LOG_CHUNK)
+            n = SHT_FLASH_LOG_CHUNK;
+        ret = sht_flash_log_io(
+            log, log->ops->read(log->ctx, addr + pos, buf, n));
+        if (ret != STATUS_OK)
+            return ret;
+        calc = sht_cobs_crc16(calc, buf, n);
+    }
+    return calc == crc ? SHT_FLASH_LOG_PAGE_VALID : SHT_FLASH_LOG_PAGE_CORRUPT;
+}
+
+static void sht_flash_log_encode(uint8_t* p, const sht_raw_sample_t* s) {
+    sht_flash_log_put32(p, s->timestamp_ms);
+    p[4] = (uint8_t)(s->sensor_id >> 8);
+    p[5] = (uint8_t)s->sensor_id;
+    p[6] = (uint8_t)(s->seq >> 8);
+    p[7] = (uint8_t)s->seq;
+    p[8] = (uint8_t)(s->t_ticks >> 8);
+    p[9] = (uint8_t)s->t_ticks;
+    p[10] = (uint8_t)(s->rh_ticks >> 8);
+    p[11] = (uint8_t)s->rh_ticks;
+    p[12] = (uint8_t)(int8_t)s->status;
+    p[13] = (uint8_t)(s->bus << 2 | (s->family & 0x03));
+}
+
+static void sht_flash_log_decode(const uint8_t* p, sht_raw_sample_t* s) {
+    s->timestamp_ms = sht_flash_log_get32(p);
+    s->sensor_id = (uint16_t)((uint16_t)p[4] << 8 | p[5]);
+    s->seq = (uint16_t)((uint16_t)p[6] << 8 | p[7]);
+    s->t_ticks = (uint16_t)((uint16_t)p[8] << 8 | p[9]);
+    s->rh_ticks = (uint16_t)((uint16_t)p[10] << 8 | p[11]);
+    s->status = (int8_t)p[12];
+    s->bus = (uint8_t)(p[13] >> 2);
+    s->family = (uint8_t)(p[13] & 0x03);
+}
+
+static void sht_flash_log_seek(sht_flash_log_t* log, uint32_t page) {
+    log->read_page = page;
+    log->read_index = 0;
+    log->read_checked = 0;
+}
+
+/* drop the pages of the sector starting at page, entered by the head; if
+ * the ring is full, the sector holds the oldest pages. Tail and head are
+ * equal both in an empty and in a full ring, so the caller tells. */
+static void sht_flash_log_drop(sht_flash_log_t* log, uint32_t page,
+                               uint8_t empty) {
+    uint32_t end = page + log->pages_per_sector;
+
+    if (!empty && log->tail >= page && log->tail < end) {
+        if (log->read_page != log->head && log->read_page >= page &&
+            log->read_page < end) {
+            log->stats.pages_overwritten += end - log->read_page;
+            sht_flash_log_seek(log, end % log->num_pages);
+        }
+        log->tail = end % log->num_pages;
+    }
+}
+
+static int16_t sht_flash_log_erase(sht_flash_log_t* log, uint32_t page,
+                                   uint8_t empty) {
+    sht_flash_log_drop(log, page, empty);
+    log->stats.sectors_erased++;
+    return sht_flash_log_io(
+        log, log->ops->erase(log->ctx, sht_flash_log_addr(log, page)));
+}
+
+static int16_t sht_flash_log_read_entry(sht_flash_log_t* log, uint8_t sector,
+                                        uint16_t index, uint8_t* entry) {
+    return sht_flash_log_io(
+        log, log->ops->read(log->ctx,
+                            log->dir_base + sector * log->sector_size +
+                                (uint32_t)index *
+                                    SHT_FLASH_LOG_CHECKPOINT_SIZE,
+                            entry, SHT_FLASH_LOG_CHECKPOINT_SIZE));
+}
+
+static uint8_t sht_flash_log_entry_blank(const uint8_t* entry) {
+    uint8_t i;
+
+    for (i = 0; i < SHT_FLASH_LOG_CHECKPOINT_SIZE; ++i) {
+        if (entry[i] != 0xFF)
+            return 0;
+    }
+    return 1;
+}
+
+static uint8_t sht_flash_log_entry_valid(const uint8_t* entry) {
+    uint16_t crc = sht_cobs_crc16(0xFFFF, entry,
+                                  SHT_FLASH_LOG_CHECKPOINT_SIZE - 2);
+
+    return ((uint16_t)entry[0] << 8 | entry[1]) ==
+               SHT_FLASH_LOG_CHECKPOINT_MAGIC &&
+           crc == ((uint16_t)entry[14] << 8 | entry[15]);
+}
+
+/* append the position of head and tail to the checkpoint directory,
+ * switching to the other directory sector when the current one is full */
+static int16_t sht_flash_log_checkpoint(sht_flash_log_t* log) {
+    uint8_t entry[SHT_FLASH_LOG_CHECKPOINT_SIZE];
+    uint32_t addr;
+    uint16_t crc;
+    int16_t ret;
+
+    if (!log->dir_entries)
+        return STATUS_OK;
+
+    if (log->dir_index == log->dir_entries) {
+        log->dir_sector ^= 1;
+        log->dir_index = 0;
+        addr = log->dir_base + log->dir_sector * log->sector_size;
+        ret = sht_flash_log_io(log, log->ops->erase(log->ctx, addr));
+        if (ret != STATUS_OK)
+            return ret;
+    }
+
+    entry[0] = (uint8_t)(SHT_FLASH_LOG_CHECKPOINT_MAGIC >> 8);
+    entry[1] = (uint8_t)SHT_FLASH_LOG_CHECKPOINT_MAGIC;
+    sht_flash_log_put32(&entry[2], log->head);
+    sht_flash_log_put32(&entry[6], log->tail);
+    sht_flash_log_put32(&entry[10], log->next_seq);
+    crc = sht_cobs_crc16(0xFFFF, entry, SHT_FLASH_LOG_CHECKPOINT_SIZE - 2);
+    entry[14] = (uint8_t)(crc >> 8);
+    entry[15] = (uint8_t)crc;
+
+    ret = sht_flash_log_io(
+        log, log->ops->program(log->ctx,
+                               log->dir_base +
+                                   log->dir_sector * log->sector_size +
+                                   (uint32_t)log->dir_index *
+                                       SHT_FLASH_LOG_CHECKPOINT_SIZE,
+                               entry, SHT_FLASH_LOG_CHECKPOINT_SIZE));
+    /* a torn entry fails its CRC, the next one goes to the next slot */
+    log->dir_index++;
+    log->stats.checkpoints++;
+    return ret;
+}
+
+/* find the newest valid entry of a directory sector: entries are appended,
+ * so the used slots are found by bisection */
+static int16_t sht_flash_log_dir_last(sht_flash_log_t* log, uint8_t sector,
+                                      uint16_t* used, uint8_t* entry,
+                                      uint8_t* found) {
+    uint16_t lo = 0;
+    uint16_t hi = log->dir_entries;
+    uint16_t mid;
+    int16_t ret;
+
+    while (lo < hi) {
+        mid = (uint16_t)(lo + (hi - lo) / 2);
+        ret = sht_flash_log_read_entry(log, sector, mid, entry);
+        if (ret != STATUS_OK)
+            return ret;
+        if (sht_flash_log_entry_blank(entry))
+            hi = mid;
+        else
+            lo = (uint16_t)(mid + 1);
+    }
+    *used = lo;
+    *found = 0;
+    while (lo-- > 0 && !*found) {
+        ret = sht_flash_log_read_entry(log, sector, lo, entry);
+        if (ret != STATUS_OK)
+            return ret;
+        *found = sht_flash_log_entry_valid(entry);
+    }
+    return STATUS_OK;
+}
+
+/* position head and tail from the newest checkpoint and the pages
+ * programmed after it */
+static int16_t sht_flash_log_recover(sht_flash_log_t* log, uint8_t* found) {
+    uint8_t entry[2][SHT_FLASH_LOG_CHECKPOINT_SIZE];
+    uint16_t used[2];
+    uint8_t valid[2];
+    uint32_t seq;
+    uint32_t next;
+    uint32_t walked;
+    uint16_t count;
+    uint8_t s;
+    int16_t ret;
+
+    for (s = 0; s < 2; ++s) {
+        ret = sht_flash_log_dir_last(log, s, &used[s], entry[s], &valid[s]);
+        if (ret != STATUS_OK)
+            return ret;
+    }
+    if (valid[0] && valid[1])
+        s = sht_flash_log_get32(&entry[1][10]) >
+                    sht_flash_log_get32(&entry[0][10])
+                ? 1
+                : 0;
+    else
+        s = valid[1];
+    *found = valid[s];
+    if (!*found)
+        return STATUS_OK;
+
+    log->dir_sector = s;
+    log->dir_index = used[s];
+    log->head = sht_flash_log_get32(&entry[s][2]) % log->num_pages;
+    log->tail = sht_flash_log_get32(&entry[s][6]) % log->num_pages;
+    log->next_seq = sht_flash_log_get32(&entry[s][10]);
+
+    /* follow the pages programmed since, skipping a page torn by a power
+     * loss if the next one continues the sequence */
+    for (walked = 0; walked < log->num_pages; ++walked) {
+        ret = sht_flash_log_check(log, log->head, &seq, &count);
+        log->stats.mount_pages++;
+        if (ret < 0)
+            return ret;
+        if (ret == SHT_FLASH_LOG_PAGE_CORRUPT) {
+            next = sht_flash_log_next(log, log->head);
+            ret = sht_flash_log_check(log, next, &seq, &count);
+            log->stats.mount_pages++;
+            if (ret < 0)
+                return ret;
+            if (ret != SHT_FLASH_LOG_PAGE_VALID || seq != log->next_seq)
+                break;
+            log->stats.corrupt_pages++;
+            log->head = next;
+            if (log->head % log->pages_per_sector == 0)
+                sht_flash_log_drop(log, log->head, 0);
+        } else if (ret != SHT_FLASH_LOG_PAGE_VALID || seq != log->next_seq) {
+            break;
+        }
+        log->next_seq++;
+        log->head = sht_flash_log_next(log, log->head);
+        if (log->head % log->pages_per_sector == 0)
+            sht_flash_log_drop(log, log->head, 0);
+    }
+    return STATUS_OK;
+}
+
+/* program the page buffer at the head and advance the head, erasing the
+ * next sector when entering it */
+static int16_t sht_flash_log_program(sht_flash_log_t* log) {
+    uint8_t* buf = log->page_buf;
+    uint16_t len = (uint16_t)(SHT_FLASH_LOG_HEADER_SIZE +
+                              log->fill * SHT_FLASH_LOG_RECORD_SIZE);
+    uint16_t crc;
+    int16_t ret;
+    int16_t erase_ret = STATUS_OK;
+
+    buf[0] = (uint8_t)(SHT_FLASH_LOG_MAGIC >> 8);
+    buf[1] = (uint8_t)SHT_FLASH_LOG_MAGIC;
+    sht_flash_log_put32(&buf[2], log->next_seq);
+    buf[6] = (uint8_t)log->fill;
+    buf[7] = 0xFF;
+    crc = sht_flash_log_crc(buf, len);
+    buf[8] = (uint8_t)(crc >> 8);
+    buf[9] = (uint8_t)crc;
+
+    ret = sht_flash_log_io(
+        log, log->ops->program(log->ctx, sht_flash_log_addr(log, log->head),
+                               buf, len));
+    log->stats.pages_programmed++;
+    log->stats.bytes_programmed += len;
+    /* a failed program leaves the page undefined, retry on the next one */
+    log->next_seq++;
+    log->head = sht_flash_log_next(log, log->head);
+    if (ret == STATUS_OK) {
+        log->fill = 0;
+        log->read_checked = 0;
+    }
+    if (log->head % log->pages_per_sector == 0) {
+        erase_ret = sht_flash_log_erase(log, log->head, 0);
+        if (erase_ret == STATUS_OK)
+            erase_ret = sht_flash_log_checkpoint(log);
+    }
+    return ret != STATUS_OK ? ret : erase_ret;
+}
+
+int16_t sht_flash_log_init(sht_flash_log_t* log, const sht_flash_ops_t* ops,
+                           void* ctx, uint8_t* page_buf, uint32_t base,
+                           uint16_t page_size, uint32_t sector_size,
+                           uint16_t num_sectors) {
+    uint16_t records;
+
+    if (page_size < SHT_FLASH_LOG_HEADER_SIZE + SHT_FLASH_LOG_RECORD_SIZE ||
+        sector_size % page_size || sector_size / page_size > UINT16_MAX ||
+        num_sectors < 2)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    records = (uint16_t)((page_size - SHT_FLASH_LOG_HEADER_SIZE) /
+                         SHT_FLASH_LOG_RECORD_SIZE);
+    log->ops = ops;
+    log->ctx = ctx;
+    log->page_buf = page_buf;
+    log->base = base;
+    log->page_size = page_size;
+    log->sector_size = sector_size;
+    log->pages_per_sector = (uint16_t)(sector_size / page_size);
+    log->num_pages = (uint32_t)log->pages_per_sector * num_sectors;
+    log->records_per_page = records > UINT8_MAX ? UINT8_MAX : records;
+    log->head = 0;
+    log->tail = 0;
+    log->next_seq = 0;
+    log->fill = 0;
+    sht_flash_log_seek(log, 0);
+    log->dir_base = 0;
+    log->dir_entries = 0;
+    log->dir_sector = 0;
+    log->dir_index = 0;
+    log->stats.records = 0;
+    log->stats.pages_programmed = 0;
+    log->stats.bytes_programmed = 0;
+    log->stats.sectors_erased = 0;
+    log->stats.pages_overwritten = 0;
+    log->stats.corrupt_pages = 0;
+    log->stats.flash_errors = 0;
+    log->stats.checkpoints = 0;
+    log->stats.mount_pages = 0;
+    return STATUS_OK;
+}
+
+int16_t sht_flash_log_format(sht_flash_log_t* log) {
+    uint32_t page;
+    int16_t ret;
+
+    log->head = 0;
+    log->tail = 0;
+    log->next_seq = 0;
+    log->fill = 0;
+    sht_flash_log_seek(log, 0);
+    for (page = 0; page < log->num_pages; page += log->pages_per_sector) {
+        ret = sht_flash_log_erase(log, page, 1);
+        if (ret != STATUS_OK)
+            return ret;
+    }
+    if (!log->dir_entries)
+        return STATUS_OK;
+
+    /* the checkpoint goes to sector 0 after switching from sector 1 */
+    ret = sht_flash_log_io(
+        log, log->ops->erase(log->ctx, log->dir_base + log->sector_size));
+    if (ret != STATUS_OK)
+        return ret;
+    log->dir_sector = 1;
+    log->dir_index = log->dir_entries;
+    return sht_flash_log_checkpoint(log);
+}
+
+int16_t sht_flash_log_set_directory(sht_flash_log_t* log, uint32_t dir_base) {
+    uint32_t entries = log->sector_size / SHT_FLASH_LOG_CHECKPOINT_SIZE;
+
+    log->dir_base = dir_base;
+    log->dir_entries = entries > UINT16_MAX ? UINT16_MAX : (uint16_t)entries;
+    log->dir_sector = 0;
+    log->dir_index = 0;
+    return STATUS_OK;
+}
+
+/* find head and tail by scanning all pages */
+static int16_t sht_flash_log_scan(sht_flash_log_t* log) {
+    uint32_t newest = 0;
+    uint32_t oldest = 0;
+    uint32_t max_seq = 0;
+    uint32_t min_seq = 0;
+    uint32_t seq;
+    uint32_t page;
+    uint16_t count;
+    uint8_t found = 0;
+    int16_t ret;
+
+    for (page = 0; page < log->num_pages; ++page) {
+        ret = sht_flash_log_check(log, page, &seq, &count);
+        log->stats.mount_pages++;
+        if (ret < 0)
+            return ret;
+        if (ret == SHT_FLASH_LOG_PAGE_CORRUPT)
+            log->stats.corrupt_pages++;
+        if (ret != SHT_FLASH_LOG_PAGE_VALID)
+            continue;
+        if (!found || seq > max_seq) {
+            max_seq = seq;
+            newest = page;
+        }
+        if (!found || seq < min_seq) {
+            min_seq = seq;
+            oldest = page;
+        }
+        found = 1;
+    }
+
+    if (found) {
+        log->head = sht_flash_log_next(log, newest);
+        log->tail = oldest;
+        log->next_seq = max_seq + 1;
+        /* the ring was full and the oldest pages are in the sector the head
+         * is about to erase */
+        if (log->tail == log->head)
+            log->tail = (log->head - log->head % log->pages_per_sector +
+                         log->pages_per_sector) %
+                        log->num_pages;
+    } else {
+        log->head = 0;
+        log->tail = 0;
+        log->next_seq = 0;
+    }
+    return STATUS_OK;
+}
+
+/* resume at a blank page: a sector entered by the head must be erased
+ * completely, within a sector skip a page torn by the power loss */
+static int16_t sht_flash_log_resume(sht_flash_log_t* log) {
+    uint32_t seq;
+    uint32_t page;
+    uint16_t count;
+    uint8_t dirty;
+    uint8_t empty;
+    int16_t ret;
+
+    for (;;) {
+        if (log->head % log->pages_per_sector == 0) {
+            empty = log->tail == log->head;
+            sht_flash_log_drop(log, log->head, empty);
+            dirty = 0;
+            for (page = log->head;
+                 !dirty && page < log->head + log->pages_per_sector; ++page) {
+                ret = sht_flash_log_check(log, page, &seq, &count);
+                log->stats.mount_pages++;
+                if (ret < 0)
+                    return ret;
+                dirty = ret != SHT_FLASH_LOG_PAGE_BLANK;
+            }
+            return dirty ? sht_flash_log_erase(log, log->head, empty)
+                         : STATUS_OK;
+        }
+        ret = sht_flash_log_check(log, log->head, &seq, &count);
+        log->stats.mount_pages++;
+        if (ret < 0)
+            return ret;
+        if (ret == SHT_FLASH_LOG_PAGE_BLANK)
+            return STATUS_OK;
+        log->head = sht_flash_log_next(log, log->head);
+    }
+}
+
+int16_t sht_flash_log_mount(sht_flash_log_t* log) {
+    uint8_t found = 0;
+    int16_t ret = STATUS_OK;
+
+    log->fill = 0;
+    log->stats.mount_pages = 0;
+    if (log->dir_entries)
+        ret = sht_flash_log_recover(log, &found);
+    if (ret == STATUS_OK && !found)
+        ret = sht_flash_log_scan(log);
+    if (ret == STATUS_OK)
+        ret = sht_flash_log_resume(log);
+    sht_flash_log_seek(log, log->tail);
+    if (ret == STATUS_OK)
+        ret = sht_flash_log_checkpoint(log);
+    return ret;
+}
+
+int16_t sht_flash_log_append(sht_flash_log_t* log,
+                             const sht_raw_sample_t* sample) {
+    sht_flash_log_encode(&log->page_buf[SHT_FLASH_LOG_HEADER_SIZE +
+                                        log->fill * SHT_FLASH_LOG_RECORD_SIZE],
+                         sample);
+    log->fill++;
+    log->stats.records++;
+    if (log->fill < log->records_per_page)
+        return STATUS_OK;
+    return sht_flash_log_program(log);
+}
+
+int16_t sht_flash_log_flush(sht_flash_log_t* log) {
+    if (!log->fill)
+        return STATUS_OK;
+    return sht_flash_log_program(log);
+}
+
+uint16_t sht_flash_log_read(sht_flash_log_t* log, sht_raw_sample_t* samples,
+                            uint16_t max_samples) {
+    uint8_t rec[SHT_FLASH_LOG_RECORD_SIZE];
+    uint32_t seq;
+    uint16_t count;
+    uint16_t n = 0;
+    int16_t ret;
+
+    while (n < max_samples) {
+        if (log->read_page == log->head) {
+            if (log->read_index >= log->fill)
+                break;
+            sht_flash_log_decode(
+                &log->page_buf[SHT_FLASH_LOG_HEADER_SIZE +
+                               log->read_index * SHT_FLASH_LOG_RECORD_SIZE],
+                &samples[n++]);
+            log->read_index++;
+            continue;
+        }
+        if (!log->read_checked) {
+            ret = sht_flash_log_check(log, log->read_page, &seq, &count);
+            if (ret < 0)
+                break;
+            if (ret == SHT_FLASH_LOG_PAGE_CORRUPT)
+                log->stats.corrupt_pages++;
+            log->read_count = ret == SHT_FLASH_LOG_PAGE_VALID ? count : 0;
+            log->read_checked = 1;
+        }
+        if (log->read_index >= log->read_count) {
+            sht_flash_log_seek(log, sht_flash_log_next(log, log->read_page));
+            continue;
+        }
+        ret = sht_flash_log_io(
+            log, log->ops->read(log->ctx,
+                                sht_flash_log_addr(log, log->read_page) +
+                                    SHT_FLASH_LOG_HEADER_SIZE +
+                                    (uint32_t)log->read_index *
+                                        SHT_FLASH_LOG_RECORD_SIZE,
+                                rec, SHT_FLASH_LOG_RECORD_SIZE));
+        if (ret != STATUS_OK)
+            break;
+        sht_flash_log_decode(rec, &samples[n++]);
+        log->read_index++;
+    }
+    return n;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Wear-leveled sample log in flash
+ *
+ * The log keeps raw samples in a ring of flash pages, e.g. to bridge radio
+ * outages. Appended samples are collected in a RAM page buffer and programmed
+ * a full page at a time; sht_flash_log_flush() programs a partial page, e.g.
+ * on a brown-out warning, wasting the rest of the page.
+ *
+ * Each page starts with a header carrying a magic number, a sequence number
+ * that increases with every programmed page, the record count and a
+ * CRC-16/CCITT over header and records. Records are 14 bytes, big-endian.
+ *
+ * The write position moves through all sectors of the log region in turn
+ * and erases each sector as it enters it, dropping its oldest pages, so all
+ * sectors see the same number of erase cycles.
+ *
+ * After a power loss sht_flash_log_mount() finds the newest valid page by
+ * its sequence number. A page torn by the power loss fails its CRC and is
+ * skipped, as are pages that are not blank where writing resumes. Samples
+ * still in the RAM buffer are lost.
+ *
+ * Scanning every page makes the mount time grow with the log size. With a
+ * checkpoint directory, see sht_flash_log_set_directory(), the log appends
+ * the head and tail position to the directory whenever the head enters a
+ * sector and at every mount. A mount then bisects the directory for the
+ * newest intact checkpoint and only follows the pages programmed after it,
+ * at most one sector's worth plus the pages damaged by a power loss. The
+ * directory alternates between two sectors and wears out far slower than the
+ * log itself.
+ *
+ * Flash access goes through the callbacks of sht_flash_ops_t. Pages are
+ * programmed once after their sector was erased; a program never spans more
+ * than one page.
+ */
+
+#ifndef SHT_FLASH_LOG_H
+#define SHT_FLASH_LOG_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+
+#define SHT_FLASH_LOG_HEADER_SIZE 10
+#define SHT_FLASH_LOG_RECORD_SIZE 14
+#define SHT_FLASH_LOG_CHECKPOINT_SIZE 16
+
+/**
+ * @brief Flash access callbacks, returning 0 on success
+ */
+typedef struct _sht_flash_ops {
+    int16_t (*read)(void* ctx, uint32_t addr, uint8_t* data, uint16_t len);
+    int16_t (*program)(void* ctx, uint32_t addr, const uint8_t* data,
+                       uint16_t len);
+    /* erase the sector starting at addr */
+    int16_t (*erase)(void* ctx, uint32_t addr);
+} sht_flash_ops_t;
+
+typedef struct _sht_flash_log_stats {
+    uint32_t records; /* records appended */
+    uint32_t pages_programmed;
+    uint32_t bytes_programmed;
+    uint32_t sectors_erased;
+    uint32_t pages_overwritten; /* unread pages lost to an erase */
+    uint32_t corrupt_pages;     /* pages skipped by mount and read */
+    uint32_t flash_errors;
+    uint32_t checkpoints;
+    uint32_t mount_pages; /* pages checked by the last mount */
+} sht_flash_log_stats_t;
+
+typedef struct _sht_flash_log {
+    const sht_flash_ops_t* ops;
+    void* ctx;
+    uint8_t* page_buf;
+    uint32_t base; /* address of the log region */
+    uint32_t sector_size;
+    uint32_t num_pages;
+    uint32_t head;     /* page programmed next */
+    uint32_t tail;     /* oldest page */
+    uint32_t next_seq; /* sequence number of the head page */
+    uint32_t read_page;
+    uint16_t page_size;
+    uint16_t pages_per_sector;
+    uint16_t records_per_page;
+    uint16_t fill;       /* records in page_buf */
+    uint16_t read_index; /* next record of read_page */
+    uint16_t read_count; /* records of read_page, valid if read_checked */
+    uint8_t read_checked;
+    uint32_t dir_base;    /* address of the checkpoint directory */
+    uint16_t dir_entries; /* checkpoints per directory sector, 0 if none */
+    uint16_t dir_index;   /* next checkpoint slot */
+    uint8_t dir_sector;   /* directory sector in use */
+    sht_flash_log_stats_t stats;
+} sht_flash_log_t;
+
+/**
+ * @brief Initialize a log over a flash region; format or mount it next
+ *
+ * @param[out] log         the log
+ * @param[in]  ops         the flash callbacks
+ * @param[in]  ctx         passed to the callbacks
+ * @param[in]  page_buf    storage for one page
+ * @param[in]  base        the address of the region, sector aligned
+ * @param[in]  page_size   the program page size
+ * @param[in]  sector_size the erase sector size, a multiple of page_size
+ * @param[in]  num_sectors the number of sectors of the region, at least 2
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_flash_log_init(sht_flash_log_t* log, const sht_flash_ops_t* ops,
+                           void* ctx, uint8_t* page_buf, uint32_t base,
+                           uint16_t page_size, uint32_t sector_size,
+                           uint16_t num_sectors);
+
+/**
+ * @brief Keep a checkpoint directory in the two sectors at dir_base, outside
+ * of the log region. Call after sht_flash_log_init() and before format or
+ * mount.
+ *
+ * @param[in] log      the log
+ * @param[in] dir_base the address of the directory, sector aligned
+ *
+ * @return 0 on success
+ */
+int16_t sht_flash_log_set_directory(sht_flash_log_t* log, uint32_t dir_base);
+
+/**
+ * @brief Erase the region and start an empty log
+ *
+ * @param[in] log the log
+ *
+ * @return 0 on success, else the error of the flash callback
+ */
+int16_t sht_flash_log_format(sht_flash_log_t* log);
+
+/**
+ * @brief Recover the log from flash, e.g. after a reset or power loss. Without
+ * a usable checkpoint, all pages are scanned.
+ *
+ * @param[in] log the log
+ *
+ * @return 0 on success, else the error of the flash callback
+ */
+int16_t sht_flash_log_mount(sht_flash_log_t* log);
+
+/**
+ * @brief Append a sample, programming the page buffer when it is full
+ *
+ * @param[in] log    the log
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, else the error of the flash callback
+ */
+int16_t sht_flash_log_append(sht_flash_log_t* log,
+                             const sht_raw_sample_t* sample);
+
+/**
+ * @brief Program the samples of the page buffer, even if it is not full
+ *
+ * @param[in] log the log
+ *
+ * @return 0 on success, else the error of the flash callback
+ */
+int16_t sht_flash_log_flush(sht_flash_log_t* log);
+
+/**
+ * @brief Read the oldest unread samples, including those still buffered.
+ * The read position is kept in RAM and restarts at the oldest page after a
+ * mount.
+ *
+ * @param[in]  log         the log
+ * @param[out] samples     the address for the samples
+ * @param[in]  max_samples the maximum number of samples to read
+ *
+ * @return the number of samples read
+ */
+uint16_t sht_flash_log_read(sht_flash_log_t* log, sht_raw_sample_t* samples,
+                            uint16_t max_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_FLASH_LOG_H */
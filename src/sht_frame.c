@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Fused CRC check and word unpacking implementation
+ */
+
+#include "sht_frame.h"
+
+#if SHT_FRAME_CRC_TABLE
+/* CRC contribution of the MSB of a word, including the 0xFF init value */
+static const uint8_t SHT_FRAME_CRC_HI[256] = {
+    0x81, 0x75, 0x58, 0xAC, 0x02, 0xF6, 0xDB, 0x2F, 0xB6, 0x42, 0x6F, 0x9B,
+    0x35, 0xC1, 0xEC, 0x18, 0xEF, 0x1B, 0x36, 0xC2, 0x6C, 0x98, 0xB5, 0x41,
+    0xD8, 0x2C, 0x01, 0xF5, 0x5B, 0xAF, 0x82, 0x76, 0x5D, 0xA9, 0x84, 0x70,
+    0xDE, 0x2A, 0x07, 0xF3, 0x6A, 0x9E, 0xB3, 0x47, 0xE9, 0x1D, 0x30, 0xC4,
+    0x33, 0xC7, 0xEA, 0x1E, 0xB0, 0x44, 0x69, 0x9D, 0x04, 0xF0, 0xDD, 0x29,
+    0x87, 0x73, 0x5E, 0xAA, 0x08, 0xFC, 0xD1, 0x25, 0x8B, 0x7F, 0x52, 0xA6,
+    0x3F, 0xCB, 0xE6, 0x12, 0xBC, 0x48, 0x65, 0x91, 0x66, 0x92, 0xBF, 0x4B,
+    0xE5, 0x11, 0x3C, 0xC8, 0x51, 0xA5, 0x88, 0x7C, 0xD2, 0x26, 0x0B, 0xFF,
+    0xD4, 0x20, 0x0D, 0xF9, 0x57, 0xA3, 0x8E, 0x7A, 0xE3, 0x17, 0x3A, 0xCE,
+    0x60, 0x94, 0xB9, 0x4D, 0xBA, 0x4E, 0x63, 0x97, 0x39, 0xCD, 0xE0, 0x14,
+    0x8D, 0x79, 0x54, 0xA0, 0x0E, 0xFA, 0xD7, 0x23, 0xA2, 0x56, 0x7B, 0x8F,
+    0x21, 0xD5, 0xF8, 0x0C, 0x95, 0x61, 0x4C, 0xB8, 0x16, 0xE2, 0xCF, 0x3B,
+    0xCC, 0x38, 0x15, 0xE1, 0x4F, 0xBB, 0x96, 0x62, 0xFB, 0x0F, 0x22, 0xD6,
+    0x78, 0x8C, 0xA1, 0x55, 0x7E, 0x8A, 0xA7, 0x53, 0xFD, 0x09, 0x24, 0xD0,
+    0x49, 0xBD, 0x90, 0x64, 0xCA, 0x3E, 0x13, 0xE7, 0x10, 0xE4, 0xC9, 0x3D,
+    0x93, 0x67, 0x4A, 0xBE, 0x27, 0xD3, 0xFE, 0x0A, 0xA4, 0x50, 0x7D, 0x89,
+    0x2B, 0xDF, 0xF2, 0x06, 0xA8, 0x5C, 0x71, 0x85, 0x1C, 0xE8, 0xC5, 0x31,
+    0x9F, 0x6B, 0x46, 0xB2, 0x45, 0xB1, 0x9C, 0x68, 0xC6, 0x32, 0x1F, 0xEB,
+    0x72, 0x86, 0xAB, 0x5F, 0xF1, 0x05, 0x28, 0xDC, 0xF7, 0x03, 0x2E, 0xDA,
+    0x74, 0x80, 0xAD, 0x59, 0xC0, 0x34, 0x19, 0xED, 0x43, 0xB7, 0x9A, 0x6E,
+    0x99, 0x6D, 0x40, 0xB4, 0x1A, 0xEE, 0xC3, 0x37, 0xAE, 0x5A, 0x77, 0x83,
+    0x2D, 0xD9, 0xF4, 0x00};
+/* CRC contribution of the LSB of a word */
+static const uint8_t SHT_FRAME_CRC_LO[256] = {
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA,
+    0x7D, 0x4C, 0x1F, 0x2E, 0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4,
+    0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D, 0x86, 0xB7, 0xE4, 0xD5,
+    0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F,
+    0xB8, 0x89, 0xDA, 0xEB, 0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA,
+    0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13, 0x7E, 0x4F, 0x1C, 0x2D,
+    0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51,
+    0xC6, 0xF7, 0xA4, 0x95, 0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F,
+    0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6, 0x7A, 0x4B, 0x18, 0x29,
+    0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3,
+    0x44, 0x75, 0x26, 0x17, 0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B,
+    0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2, 0xBF, 0x8E, 0xDD, 0xEC,
+    0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD,
+    0x3A, 0x0B, 0x58, 0x69, 0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93,
+    0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A, 0xC1, 0xF0, 0xA3, 0x92,
+    0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68,
+    0xFF, 0xCE, 0x9D, 0xAC};
+#define SHT_FRAME_CRC2(msb, lsb) \
+    ((uint8_t)(SHT_FRAME_CRC_HI[(msb)] ^ SHT_FRAME_CRC_LO[(lsb)]))
+
+#else /* SHT_FRAME_CRC_TABLE */
+
+static uint8_t sht_frame_crc_bitwise(uint8_t msb, uint8_t lsb) {
+    uint8_t crc = (uint8_t)(0xFF ^ msb);
+    uint8_t bit;
+
+    for (bit = 0; bit < 16; ++bit) {
+        if (bit == 8)
+            crc ^= lsb;
+        if (crc & 0x80)
+            crc = (uint8_t)((crc << 1) ^ 0x31);
+        else
+            crc = (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+#define SHT_FRAME_CRC2(msb, lsb) sht_frame_crc_bitwise((msb), (lsb))
+
+#endif /* SHT_FRAME_CRC_TABLE */
+
+#define SHT_FRAME_WORD(p) ((uint16_t)(((uint16_t)(p)[0] << 8) | (p)[1]))
+/* zero iff the CRC of the word at p matches */
+#define SHT_FRAME_CRC_DIFF(p) \
+    ((uint8_t)(SHT_FRAME_CRC2((p)[0], (p)[1]) ^ (p)[2]))
+
+uint8_t sht_frame_crc(const uint8_t* data) {
+    return SHT_FRAME_CRC2(data[0], data[1]);
+}
+
+int16_t sht_frame_unpack_words(const uint8_t* data, uint16_t* words,
+                               uint16_t num_words) {
+    uint8_t diff = 0;
+    uint16_t i;
+
+    for (i = 0; i < num_words; ++i, data += SHT_FRAME_WORD_SIZE) {
+        diff |= SHT_FRAME_CRC_DIFF(data);
+        words[i] = SHT_FRAME_WORD(data);
+    }
+    return diff ? STATUS_CRC_FAIL : STATUS_OK;
+}
+
+int16_t sht_frame_unpack_ticks(const uint8_t* data, uint16_t* t_ticks,
+                               uint16_t* rh_ticks) {
+    if (SHT_FRAME_CRC_DIFF(data) | SHT_FRAME_CRC_DIFF(data + 3))
+        return STATUS_CRC_FAIL;
+
+    *t_ticks = SHT_FRAME_WORD(data);
+    *rh_ticks = SHT_FRAME_WORD(data + 3);
+    return STATUS_OK;
+}
+
+uint16_t sht_frame_unpack_measurements(const uint8_t* data,
+                                       uint16_t num_frames, uint16_t* t_ticks,
+                                       uint16_t* rh_ticks) {
+    const uint8_t* p = data;
+    uint16_t i = 0;
+
+    /* four independent CRC chains per iteration; the slow path below
+     * locates the failing frame */
+    for (; i + 1 < num_frames; i += 2, p += 2 * SHT_FRAME_MEASUREMENT_SIZE) {
+        if (SHT_FRAME_CRC_DIFF(p) | SHT_FRAME_CRC_DIFF(p + 3) |
+            SHT_FRAME_CRC_DIFF(p + 6) | SHT_FRAME_CRC_DIFF(p + 9))
+            break;
+        t_ticks[i] = SHT_FRAME_WORD(p);
+        rh_ticks[i] = SHT_FRAME_WORD(p + 3);
+        t_ticks[i + 1] = SHT_FRAME_WORD(p + 6);
+        rh_ticks[i + 1] = SHT_FRAME_WORD(p + 9);
+    }
+    for (; i < num_frames; ++i, p += SHT_FRAME_MEASUREMENT_SIZE) {
+        if (sht_frame_unpack_ticks(p, &t_ticks[i], &rh_ticks[i]) != STATUS_OK)
+            break;
+    }
+    return i;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Fused CRC check and word unpacking of sensor read frames
+ *
+ * The sensors answer with 16-bit big-endian words, each followed by its CRC-8
+ * (polynomial 0x31, init 0xFF). The functions of this module verify the CRC
+ * and assemble the words in a single pass over the received bytes, so the
+ * drivers read the raw bytes and unpack them straight into ticks without an
+ * intermediate word buffer.
+ *
+ * By default the CRC is computed from two 256 byte lookup tables, one for the
+ * MSB and one for the LSB of a word. The two lookups are independent, which
+ * removes the serial dependency of the per-bit algorithm. On AVR the tables
+ * would be placed in RAM, so the bitwise algorithm is used there unless
+ * SHT_FRAME_CRC_TABLE is defined to 1.
+ */
+
+#ifndef SHT_FRAME_H
+#define SHT_FRAME_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_CRC_FAIL (-2)
+
+#ifndef SHT_FRAME_CRC_TABLE
+#ifdef __AVR__
+#define SHT_FRAME_CRC_TABLE 0
+#else
+#define SHT_FRAME_CRC_TABLE 1
+#endif
+#endif /* SHT_FRAME_CRC_TABLE */
+
+/* number of bytes of a word and its CRC on the wire */
+#define SHT_FRAME_WORD_SIZE 3
+/* number of bytes of a measurement: T (CRC) RH (CRC) */
+#define SHT_FRAME_MEASUREMENT_SIZE (2 * SHT_FRAME_WORD_SIZE)
+
+/**
+ * @brief Compute the CRC-8 of a 16-bit word as sent by the sensor
+ *
+ * @param[in] data the two bytes of the word, MSB first
+ *
+ * @return the CRC
+ */
+uint8_t sht_frame_crc(const uint8_t* data);
+
+/**
+ * @brief Verify and unpack words from received bytes
+ *
+ * @param[in]  data      num_words groups of MSB, LSB, CRC
+ * @param[out] words     the address for the unpacked words
+ * @param[in]  num_words the number of words to unpack
+ *
+ * @return 0 if all CRCs matched, else STATUS_CRC_FAIL
+ */
+int16_t sht_frame_unpack_words(const uint8_t* data, uint16_t* words,
+                               uint16_t num_words);
+
+/**
+ * @brief Verify and unpack a measurement frame
+ *
+ * @param[in]  data     SHT_FRAME_MEASUREMENT_SIZE received bytes
+ * @param[out] t_ticks  the address for the temperature ticks
+ * @param[out] rh_ticks the address for the humidity ticks
+ *
+ * @return 0 if both CRCs matched, else STATUS_CRC_FAIL
+ */
+int16_t sht_frame_unpack_ticks(const uint8_t* data, uint16_t* t_ticks,
+                               uint16_t* rh_ticks);
+
+/**
+ * @brief Verify and unpack consecutive measurement frames, e.g. a buffer of
+ * frames collected from many reads. Two frames are checked per iteration with
+ * their CRCs combined into a single branch.
+ *
+ * @param[in]  data       num_frames * SHT_FRAME_MEASUREMENT_SIZE bytes
+ * @param[in]  num_frames the number of frames
+ * @param[out] t_ticks    the address for num_frames temperature ticks
+ * @param[out] rh_ticks   the address for num_frames humidity ticks
+ *
+ * @return the number of frames unpacked before the first CRC mismatch, i.e.
+ * num_frames if all frames are valid
+ */
+uint16_t sht_frame_unpack_measurements(const uint8_t* data,
+                                       uint16_t num_frames, uint16_t* t_ticks,
+                                       uint16_t* rh_ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_FRAME_H */
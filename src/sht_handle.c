@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensor handle implementation
+ */
+
+#include "sht_handle.h"
+#include "sensirion_i2c.h"
+#include "sht3x.h"
+#include "sht4x.h"
+#include "sht_frame.h"
+#include "shtc1.h"
+
+/* delay between a command and its read out, the same for all families */
+#define SHT_HANDLE_CMD_DURATION_USEC 1000
+
+int16_t sht_handle_probe(const sht_handle_t* handle) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_probe((sht3x_i2c_addr_t)handle->addr);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_probe();
+        case SHT_FAMILY_SHTC1:
+            return shtc1_probe();
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+int16_t sht_handle_read_serial(const sht_handle_t* handle, uint32_t* serial) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_read_serial((sht3x_i2c_addr_t)handle->addr, serial);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_read_serial(serial);
+        case SHT_FAMILY_SHTC1:
+            return shtc1_read_serial(serial);
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+int16_t sht_handle_sleep(const sht_handle_t* handle) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+        case SHT_FAMILY_SHT4X:
+            return STATUS_OK;
+        case SHT_FAMILY_SHTC1:
+            return shtc1_sleep();
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+int16_t sht_handle_wake_up(const sht_handle_t* handle) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+        case SHT_FAMILY_SHT4X:
+            return STATUS_OK;
+        case SHT_FAMILY_SHTC1:
+            return shtc1_wake_up();
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+int16_t sht_handle_measure(const sht_handle_t* handle) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_measure((sht3x_i2c_addr_t)handle->addr);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_measure();
+        case SHT_FAMILY_SHTC1:
+            return shtc1_measure();
+        default:
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+}
+
+int16_t sht_handle_read_ticks(const sht_handle_t* handle, uint16_t* t_ticks,
+                              uint16_t* rh_ticks) {
+    /* all families answer with T (CRC) RH (CRC) */
+    uint8_t data[SHT_FRAME_MEASUREMENT_SIZE];
+    int16_t ret = sensirion_i2c_read(handle->addr, data, sizeof(data));
+    if (ret != STATUS_OK)
+        return ret;
+
+    return sht_frame_unpack_ticks(data, t_ticks, rh_ticks);
+}
+
+int16_t sht_handle_read_sample(sht_handle_t* handle, uint32_t now_ms,
+                               sht_raw_sample_t* sample) {
+    sample->t_ticks = 0;
+    sample->rh_ticks = 0;
+    sample->status =
+        sht_handle_read_ticks(handle, &sample->t_ticks, &sample->rh_ticks);
+    sample->timestamp_ms = now_ms;
+    sample->sensor_id = handle->id;
+    sample->seq = handle->seq++;
+    sample->bus = handle->bus;
+    sample->family = handle->family;
+    return sample->status;
+}
+
+uint32_t sht_handle_measurement_duration_usec(const sht_handle_t* handle) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+            return SHT3X_MEASUREMENT_DURATION_USEC;
+        case SHT_FAMILY_SHT4X:
+            return SHT4X_MEASUREMENT_DURATION_USEC;
+        case SHT_FAMILY_SHTC1:
+            return SHTC1_MEASUREMENT_DURATION_USEC;
+        default:
+            return 0;
+    }
+}
+
+uint32_t sht_handle_serial_duration_usec(const sht_handle_t* handle,
+                                         uint16_t clock_khz) {
+    switch (handle->family) {
+        case SHT_FAMILY_SHT3X:
+            /* 16 bit command, two words */
+            return SHT_HANDLE_TRANSFER_USEC(2, clock_khz) +
+                   SHT_HANDLE_CMD_DURATION_USEC +
+                   SHT_HANDLE_TRANSFER_USEC(6, clock_khz);
+        case SHT_FAMILY_SHT4X:
+            /* 8 bit command, two words */
+            return SHT_HANDLE_TRANSFER_USEC(1, clock_khz) +
+                   SHT_HANDLE_CMD_DURATION_USEC +
+                   SHT_HANDLE_TRANSFER_USEC(6, clock_khz);
+        case SHT_FAMILY_SHTC1:
+            /* wake-up, id register address with its argument, then one
+             * command and one word per half of the serial number */
+            return SHT_HANDLE_TRANSFER_USEC(2, clock_khz) +
+                   SHT_HANDLE_TRANSFER_USEC(5, clock_khz) +
+                   SHT_HANDLE_CMD_DURATION_USEC +
+                   2 * (SHT_HANDLE_TRANSFER_USEC(2, clock_khz) +
+                        SHT_HANDLE_CMD_DURATION_USEC +
+                        SHT_HANDLE_TRANSFER_USEC(3, clock_khz));
+        default:
+            return 0;
+    }
+}
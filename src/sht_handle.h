@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensor handles
+ *
+ * A handle describes where a sensor is attached: bus, optional multiplexer
+ * path and channel, and I2C address, together with its family. The handle
+ * functions dispatch to the family drivers; they do not select the bus or the
+ * multiplexer channel, see sht_mux_select_handle() for that.
+ *
+ * The SHT4x and SHTC1 drivers use a fixed address: for these families the
+ * handle address must match sht4x_get_configured_address() respectively
+ * shtc1_get_configured_address().
+ */
+
+#ifndef SHT_HANDLE_H
+#define SHT_HANDLE_H
+
+#include "sht_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct _sht_mux;
+
+/**
+ * @brief Bus time of a transfer of n bytes after the address byte at
+ * clock_khz: 9 clocks per byte and 2 for start and stop, rounded up
+ */
+#define SHT_HANDLE_TRANSFER_USEC(n, clock_khz) \
+    ((((uint32_t)(n) + 1) * 9 + 2) * 1000 / (clock_khz) + 1)
+
+/**
+ * @brief Location and family of one sensor
+ */
+typedef struct _sht_handle {
+    struct _sht_mux* mux; /* multiplexer in front of the sensor, or NULL */
+    uint16_t id;          /* sensor id reported in the samples */
+    uint16_t seq;         /* sequence number of the next sample */
+    uint16_t clock_khz;   /* highest SCL frequency, 0 for the bus default */
+    uint8_t bus;          /* bus index, see sensirion_i2c_select_bus() */
+    uint8_t channel;      /* multiplexer channel, ignored without mux */
+    uint8_t addr;         /* 7-bit I2C address */
+    uint8_t family;       /* sht_family_t */
+} sht_handle_t;
+
+/**
+ * @brief Check that the sensor responds
+ *
+ * @param[in] handle the sensor
+ *
+ * @return 0 if the sensor answered, else an error code
+ */
+int16_t sht_handle_probe(const sht_handle_t* handle);
+
+/**
+ * @brief Read out the serial number of the sensor
+ *
+ * @param[in]  handle the sensor
+ * @param[out] serial the address for the serial number
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_read_serial(const sht_handle_t* handle, uint32_t* serial);
+
+/**
+ * @brief Put the sensor to sleep. Only the SHTC1 family has a sleep command,
+ * the other families idle automatically between measurements.
+ *
+ * @param[in] handle the sensor
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_sleep(const sht_handle_t* handle);
+
+/**
+ * @brief Wake the sensor up from sleep, see sht_handle_sleep()
+ *
+ * @param[in] handle the sensor
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_wake_up(const sht_handle_t* handle);
+
+/**
+ * @brief Start a measurement with the current mode of the family driver
+ *
+ * @param[in] handle the sensor
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_measure(const sht_handle_t* handle);
+
+/**
+ * @brief Read out the raw ticks of a measurement started by
+ * sht_handle_measure()
+ *
+ * @param[in]  handle   the sensor
+ * @param[out] t_ticks  the address for the temperature ticks
+ * @param[out] rh_ticks the address for the humidity ticks
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_read_ticks(const sht_handle_t* handle, uint16_t* t_ticks,
+                              uint16_t* rh_ticks);
+
+/**
+ * @brief Read out a measurement into a raw sample, stamping it with the
+ * handle's id, bus, family and next sequence number
+ *
+ * @param[in]  handle the sensor
+ * @param[in]  now_ms the timestamp of the sample
+ * @param[out] sample the sample, also filled in on error
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_handle_read_sample(sht_handle_t* handle, uint32_t now_ms,
+                               sht_raw_sample_t* sample);
+
+/**
+ * @brief Return the time to wait between sht_handle_measure() and
+ * sht_handle_read_ticks(). The high repeatability duration is returned, which
+ * also covers the faster low power modes.
+ *
+ * @param[in] handle the sensor
+ *
+ * @return the measurement duration in microseconds
+ */
+uint32_t sht_handle_measurement_duration_usec(const sht_handle_t* handle);
+
+/**
+ * @brief Return the time sht_handle_wake_up() and sht_handle_read_serial()
+ * take together: the transfers at clock_khz and the command delays
+ *
+ * @param[in] handle    the sensor
+ * @param[in] clock_khz the SCL frequency
+ *
+ * @return the duration in microseconds, 0 for an unknown family
+ */
+uint32_t sht_handle_serial_duration_usec(const sht_handle_t* handle,
+                                         uint16_t clock_khz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_HANDLE_H */
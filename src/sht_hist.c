@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Latency histogram implementation
+ */
+
+#include "sht_hist.h"
+
+#include <stddef.h>
+
+#define SHT_HIST_HALF (SHT_HIST_SUB_BUCKETS / 2)
+#define SHT_HIST_LIMIT ((1UL << SHT_HIST_MAX_BITS) - 1)
+
+/* position of the highest set bit, v must not be 0 */
+static uint8_t sht_hist_msb(uint32_t v) {
+#if defined(__GNUC__)
+    return (uint8_t)(sizeof(unsigned long) * 8 - 1 -
+                     (unsigned)__builtin_clzl((unsigned long)v));
+#else
+    uint8_t h = 0;
+
+    while (v >>= 1)
+        h++;
+    return h;
+#endif
+}
+
+/* values below SHT_HIST_SUB_BUCKETS map to themselves; above, the value is
+ * shifted down to SHT_HIST_SUB_BITS significant bits, whose top bit is set,
+ * and every shift adds SHT_HIST_HALF buckets */
+static uint16_t sht_hist_index(uint32_t value) {
+    uint8_t h;
+    uint8_t shift;
+
+    if (value > SHT_HIST_LIMIT)
+        value = SHT_HIST_LIMIT;
+    h = sht_hist_msb(value | 1);
+    shift = h >= SHT_HIST_SUB_BITS ? (uint8_t)(h - SHT_HIST_SUB_BITS + 1) : 0;
+    return (uint16_t)(shift * SHT_HIST_HALF + (value >> shift));
+}
+
+/* largest value of a bucket */
+static uint32_t sht_hist_upper(uint16_t index) {
+    uint8_t shift;
+    uint32_t sub;
+
+    if (index < SHT_HIST_SUB_BUCKETS)
+        return index;
+    shift = (uint8_t)(index / SHT_HIST_HALF - 1);
+    sub = index - (uint32_t)shift * SHT_HIST_HALF;
+    return ((sub + 1) << shift) - 1;
+}
+
+void sht_hist_reset(sht_hist_t* hist) {
+    uint16_t i;
+
+    for (i = 0; i < SHT_HIST_NUM_BUCKETS; ++i)
+        hist->counts[i] = 0;
+    hist->count = 0;
+    hist->min = UINT32_MAX;
+    hist->max = 0;
+}
+
+void sht_hist_record(sht_hist_t* hist, uint32_t value) {
+    hist->counts[sht_hist_index(value)]++;
+    hist->count++;
+    if (value < hist->min)
+        hist->min = value;
+    if (value > hist->max)
+        hist->max = value;
+}
+
+void sht_hist_merge(sht_hist_t* dst, const sht_hist_t* src) {
+    uint16_t i;
+
+    for (i = 0; i < SHT_HIST_NUM_BUCKETS; ++i)
+        dst->counts[i] += src->counts[i];
+    dst->count += src->count;
+    if (src->min < dst->min)
+        dst->min = src->min;
+    if (src->max > dst->max)
+        dst->max = src->max;
+}
+
+uint32_t sht_hist_percentile(const sht_hist_t* hist, uint16_t percent_x100) {
+    uint32_t target;
+    uint32_t seen = 0;
+    uint32_t upper;
+    uint16_t i;
+
+    if (!hist->count)
+        return 0;
+    if (percent_x100 > 10000)
+        percent_x100 = 10000;
+    /* rank of the value, rounded up, at least the first one */
+    target = (uint32_t)(((uint64_t)hist->count * percent_x100 + 9999) / 10000);
+    if (!target)
+        target = 1;
+
+    for (i = 0; i < SHT_HIST_NUM_BUCKETS; ++i) {
+        seen += hist->counts[i];
+        if (seen >= target)
+            break;
+    }
+    if (i >= SHT_HIST_NUM_BUCKETS)
+        i = SHT_HIST_NUM_BUCKETS - 1;
+    upper = sht_hist_upper(i);
+    /* the last bucket is open ended, values beyond the range are only bounded
+     * by the max */
+    if (i == SHT_HIST_NUM_BUCKETS - 1 && hist->max > upper)
+        upper = hist->max;
+    if (upper > hist->max)
+        upper = hist->max;
+    if (upper < hist->min)
+        upper = hist->min;
+    return upper;
+}
+
+void sht_hist_recorder_init(sht_hist_recorder_t* recorder, sht_hist_t* ops,
+                            sht_hist_t* sensors, uint16_t num_sensors,
+                            sht_hist_clock_fn now_usec, void* user_data) {
+    uint32_t i;
+
+    recorder->ops = ops;
+    recorder->sensors = sensors;
+    recorder->num_sensors = sensors ? num_sensors : 0;
+    recorder->now_usec = now_usec;
+    recorder->user_data = user_data;
+
+    for (i = 0; i < SHT_HIST_NUM_OPS; ++i)
+        sht_hist_reset(&ops[i]);
+    for (i = 0; i < (uint32_t)recorder->num_sensors * SHT_HIST_NUM_OPS; ++i)
+        sht_hist_reset(&sensors[i]);
+}
+
+sht_hist_t* sht_hist_recorder_sensor(const sht_hist_recorder_t* recorder,
+                                     uint16_t sensor_id, uint8_t op) {
+    if (sensor_id >= recorder->num_sensors || op >= SHT_HIST_NUM_OPS)
+        return NULL;
+    return &recorder->sensors[(uint32_t)sensor_id * SHT_HIST_NUM_OPS + op];
+}
+
+void sht_hist_recorder_add(sht_hist_recorder_t* recorder, uint16_t sensor_id,
+                           uint8_t op, uint32_t usec) {
+    sht_hist_t* hist;
+
+    if (op >= SHT_HIST_NUM_OPS)
+        return;
+    sht_hist_record(&recorder->ops[op], usec);
+    hist = sht_hist_recorder_sensor(recorder, sensor_id, op);
+    if (hist)
+        sht_hist_record(hist, usec);
+}
+
+/* time the call between start and the end of the statement */
+#define SHT_HIST_TIMED(recorder, handle, op, call)                    \
+    do {                                                              \
+        uint32_t start = (recorder)->now_usec((recorder)->user_data); \
+        ret = (call);                                                 \
+        sht_hist_recorder_add(                                        \
+            recorder, (handle)->id, op,                               \
+            (recorder)->now_usec((recorder)->user_data) - start);     \
+    } while (0)
+
+int16_t sht_hist_measure(sht_hist_recorder_t* recorder,
+                         const sht_handle_t* handle) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_MEASURE,
+                   sht_handle_measure(handle));
+    return ret;
+}
+
+int16_t sht_hist_read_sample(sht_hist_recorder_t* recorder,
+                             sht_handle_t* handle, uint32_t now_ms,
+                             sht_raw_sample_t* sample) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_READ,
+                   sht_handle_read_sample(handle, now_ms, sample));
+    return ret;
+}
+
+int16_t sht_hist_probe(sht_hist_recorder_t* recorder,
+                       const sht_handle_t* handle) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_STATUS,
+                   sht_handle_probe(handle));
+    return ret;
+}
+
+int16_t sht_hist_read_serial(sht_hist_recorder_t* recorder,
+                             const sht_handle_t* handle, uint32_t* serial) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_SERIAL,
+                   sht_handle_read_serial(handle, serial));
+    return ret;
+}
+
+int16_t sht_hist_sleep(sht_hist_recorder_t* recorder,
+                       const sht_handle_t* handle) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_SLEEP,
+                   sht_handle_sleep(handle));
+    return ret;
+}
+
+int16_t sht_hist_wake_up(sht_hist_recorder_t* recorder,
+                         const sht_handle_t* handle) {
+    int16_t ret;
+
+    SHT_HIST_TIMED(recorder, handle, SHT_HIST_OP_WAKE_UP,
+                   sht_handle_wake_up(handle));
+    return ret;
+}
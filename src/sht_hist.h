@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief High dynamic range latency histograms of driver operations
+ *
+ * Tuning schedules needs the tails of the operation latencies, not only their
+ * mean. The histograms of this module are log-linear: values below
+ * 2^SHT_HIST_SUB_BITS have a bucket each, larger values fall into buckets
+ * whose width doubles with every power of two, each power of two split into
+ * 2^(SHT_HIST_SUB_BITS - 1) buckets. The relative error of a reported value
+ * is therefore below 2^-(SHT_HIST_SUB_BITS - 1), 12.5% with the default, over
+ * the whole range up to 2^SHT_HIST_MAX_BITS microseconds; larger values are
+ * counted in the last bucket. Recording a value costs a count leading zeros,
+ * a shift and an increment; histograms of several sensors or time windows are
+ * combined by adding their buckets.
+ *
+ * The recorder times the handle operations with an application supplied
+ * microsecond clock and records every call, failed ones included, in one
+ * histogram per operation and optionally in one histogram per sensor and
+ * operation. Histograms are only kept for the operations issued through the
+ * recorder, applications not using it pay nothing.
+ */
+
+#ifndef SHT_HIST_H
+#define SHT_HIST_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sub-bucket resolution, 2^(SHT_HIST_SUB_BITS - 1) buckets per power
+ * of two
+ */
+#ifndef SHT_HIST_SUB_BITS
+#define SHT_HIST_SUB_BITS 4
+#endif
+
+/**
+ * @brief Values from 2^SHT_HIST_MAX_BITS on are counted in the last bucket
+ */
+#ifndef SHT_HIST_MAX_BITS
+#define SHT_HIST_MAX_BITS 24
+#endif
+
+#define SHT_HIST_SUB_BUCKETS (1UL << SHT_HIST_SUB_BITS)
+#define SHT_HIST_NUM_BUCKETS \
+    (SHT_HIST_SUB_BUCKETS / 2 * (SHT_HIST_MAX_BITS - SHT_HIST_SUB_BITS + 2))
+
+/**
+ * @brief Timed operations
+ */
+typedef enum _sht_hist_op {
+    SHT_HIST_OP_MEASURE, /* measure command */
+    SHT_HIST_OP_READ,    /* measurement read out */
+    SHT_HIST_OP_STATUS,  /* probe, reading the status where available */
+    SHT_HIST_OP_SERIAL,  /* serial number read out */
+    SHT_HIST_OP_SLEEP,
+    SHT_HIST_OP_WAKE_UP,
+    SHT_HIST_NUM_OPS
+} sht_hist_op_t;
+
+typedef struct _sht_hist {
+    uint32_t counts[SHT_HIST_NUM_BUCKETS];
+    uint32_t count; /* recorded values */
+    uint32_t min;   /* smallest recorded value, UINT32_MAX if none */
+    uint32_t max;   /* largest recorded value */
+} sht_hist_t;
+
+/**
+ * @brief Return the current time in microseconds of a free running clock
+ */
+typedef uint32_t (*sht_hist_clock_fn)(void* user_data);
+
+typedef struct _sht_hist_recorder {
+    sht_hist_t* ops;     /* SHT_HIST_NUM_OPS histograms */
+    sht_hist_t* sensors; /* num_sensors * SHT_HIST_NUM_OPS histograms */
+    uint16_t num_sensors;
+    sht_hist_clock_fn now_usec;
+    void* user_data; /* passed to now_usec */
+} sht_hist_recorder_t;
+
+/**
+ * @brief Empty a histogram
+ *
+ * @param[out] hist the histogram
+ */
+void sht_hist_reset(sht_hist_t* hist);
+
+/**
+ * @brief Record a value
+ *
+ * @param[in] hist  the histogram
+ * @param[in] value the value, e.g. a latency in microseconds
+ */
+void sht_hist_record(sht_hist_t* hist, uint32_t value);
+
+/**
+ * @brief Add the values of a histogram to another one, e.g. to combine
+ * sensors or time windows
+ *
+ * @param[in] dst the histogram added to
+ * @param[in] src the histogram added
+ */
+void sht_hist_merge(sht_hist_t* dst, const sht_hist_t* src);
+
+/**
+ * @brief Return the value below or at which a share of the recorded values
+ * lies, as the upper bound of its bucket
+ *
+ * @param[in] hist          the histogram
+ * @param[in] percent_x100  the share in hundredths of a percent, e.g. 9990
+ *                          for the 99.9th percentile
+ *
+ * @return the value, 0 if the histogram is empty
+ */
+uint32_t sht_hist_percentile(const sht_hist_t* hist, uint16_t percent_x100);
+
+/**
+ * @brief Initialize a recorder and empty its histograms
+ *
+ * @param[out] recorder    the recorder
+ * @param[in]  ops         storage for SHT_HIST_NUM_OPS histograms
+ * @param[in]  sensors     storage for num_sensors * SHT_HIST_NUM_OPS
+ *                         histograms, indexed by sensor id, or NULL
+ * @param[in]  num_sensors the number of sensor ids with histograms
+ * @param[in]  now_usec    the clock
+ * @param[in]  user_data   passed to now_usec
+ */
+void sht_hist_recorder_init(sht_hist_recorder_t* recorder, sht_hist_t* ops,
+                            sht_hist_t* sensors, uint16_t num_sensors,
+                            sht_hist_clock_fn now_usec, void* user_data);
+
+/**
+ * @brief Return the histogram of an operation of a sensor
+ *
+ * @param[in] recorder  the recorder
+ * @param[in] sensor_id the sensor id
+ * @param[in] op        the sht_hist_op_t
+ *
+ * @return the histogram, NULL if the sensor has none
+ */
+sht_hist_t* sht_hist_recorder_sensor(const sht_hist_recorder_t* recorder,
+                                     uint16_t sensor_id, uint8_t op);
+
+/**
+ * @brief Record the latency of an operation timed by the application
+ *
+ * @param[in] recorder  the recorder
+ * @param[in] sensor_id the sensor id
+ * @param[in] op        the sht_hist_op_t
+ * @param[in] usec      the latency
+ */
+void sht_hist_recorder_add(sht_hist_recorder_t* recorder, uint16_t sensor_id,
+                           uint8_t op, uint32_t usec);
+
+/**
+ * @brief sht_handle_measure(), timed
+ */
+int16_t sht_hist_measure(sht_hist_recorder_t* recorder,
+                         const sht_handle_t* handle);
+
+/**
+ * @brief sht_handle_read_sample(), timed
+ */
+int16_t sht_hist_read_sample(sht_hist_recorder_t* recorder,
+                             sht_handle_t* handle, uint32_t now_ms,
+                             sht_raw_sample_t* sample);
+
+/**
+ * @brief sht_handle_probe(), timed as SHT_HIST_OP_STATUS
+ */
+int16_t sht_hist_probe(sht_hist_recorder_t* recorder,
+                       const sht_handle_t* handle);
+
+/**
+ * @brief sht_handle_read_serial(), timed
+ */
+int16_t sht_hist_read_serial(sht_hist_recorder_t* recorder,
+                             const sht_handle_t* handle, uint32_t* serial);
+
+/**
+ * @brief sht_handle_sleep(), timed
+ */
+int16_t sht_hist_sleep(sht_hist_recorder_t* recorder,
+                       const sht_handle_t* handle);
+
+/**
+ * @brief sht_handle_wake_up(), timed
+ */
+int16_t sht_hist_wake_up(sht_hist_recorder_t* recorder,
+                         const sht_handle_t* handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_HIST_H */
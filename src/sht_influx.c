@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Batched InfluxDB line protocol encoding implementation
+ */
+
+#include "sht_influx.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* " temperature=-2147483.648,humidity=-2147483.648 " and a 20 digit
+ * timestamp with the newline */
+#define SHT_INFLUX_FIELDS_MAX 72
+
+static const char SHT_INFLUX_DIGITS[] = "00010203040506070809"
+                                        "10111213141516171819"
+                                        "20212223242526272829"
+                                        "30313233343536373839"
+                                        "40414243444546474849"
+                                        "50515253545556575859"
+                                        "60616263646566676869"
+                                        "70717273747576777879"
+                                        "80818283848586878889"
+                                        "90919293949596979899";
+
+/* write the decimal digits of value right-aligned, ending before end,
+ * return the position of the first digit */
+static char* sht_influx_digits(char* end, uint32_t value) {
+    uint32_t pair;
+
+    while (value >= 100) {
+        pair = (value % 100) * 2;
+        value /= 100;
+        *--end = SHT_INFLUX_DIGITS[pair + 1];
+        *--end = SHT_INFLUX_DIGITS[pair];
+    }
+    if (value >= 10) {
+        *--end = SHT_INFLUX_DIGITS[value * 2 + 1];
+        *--end = SHT_INFLUX_DIGITS[value * 2];
+    } else {
+        *--end = (char)('0' + value);
+    }
+    return end;
+}
+
+static uint8_t sht_influx_format_u32(char* out, uint32_t value) {
+    char tmp[10];
+    char* first = sht_influx_digits(tmp + sizeof(tmp), value);
+    uint8_t n = (uint8_t)(tmp + sizeof(tmp) - first);
+
+    memcpy(out, first, n);
+    return n;
+}
+
+static uint8_t sht_influx_format_u64(char* out, uint64_t value) {
+    char tmp[20];
+    char* end = tmp + sizeof(tmp);
+    char* first;
+    uint32_t low;
+
+    /* nine digits per 32 bit division */
+    while (value >= 1000000000U) {
+        low = (uint32_t)(value % 1000000000U);
+        value /= 1000000000U;
+        first = sht_influx_digits(end, low);
+        while (first > end - 9)
+            *--first = '0';
+        end = first;
+    }
+    first = sht_influx_digits(end, (uint32_t)value);
+    memcpy(out, first, (size_t)(tmp + sizeof(tmp) - first));
+    return (uint8_t)(tmp + sizeof(tmp) - first);
+}
+
+uint8_t sht_influx_format_milli(char* out, int32_t milli) {
+    uint32_t v = milli < 0 ? (uint32_t)0 - (uint32_t)milli : (uint32_t)milli;
+    uint32_t frac = v % 1000;
+    uint8_t n = 0;
+
+    if (milli < 0)
+        out[n++] = '-';
+    n += sht_influx_format_u32(&out[n], v / 1000);
+    out[n++] = '.';
+    out[n++] = (char)('0' + frac / 100);
+    out[n++] = SHT_INFLUX_DIGITS[(frac % 100) * 2];
+    out[n++] = SHT_INFLUX_DIGITS[(frac % 100) * 2 + 1];
+    return n;
+}
+
+/* append text to the prefix, escaping the characters special in names */
+static int16_t sht_influx_prefix_append(sht_influx_prefix_t* prefix,
+                                        const char* text, uint8_t escape) {
+    for (; *text; ++text) {
+        if (escape && (*text == ',' || *text == ' ' || *text == '=')) {
+            if (prefix->len + 1 >= SHT_INFLUX_PREFIX_MAX)
+                return STATUS_ERR_NO_SPACE;
+            prefix->text[prefix->len++] = '\\';
+        }
+        if (prefix->len + 1 >= SHT_INFLUX_PREFIX_MAX)
+            return STATUS_ERR_NO_SPACE;
+        prefix->text[prefix->len++] = *text;
+    }
+    return STATUS_OK;
+}
+
+int16_t sht_influx_prefix_init(sht_influx_prefix_t* prefix,
+                               const char* measurement,
+                               const sht_handle_t* handle,
+                               const char* extra_tags) {
+    char tags[32];
+    uint8_t n = 0;
+    int16_t ret;
+
+    memcpy(&tags[n], ",sensor=", 8);
+    n += 8;
+    n += sht_influx_format_u32(&tags[n], handle->id);
+    memcpy(&tags[n], ",bus=", 5);
+    n += 5;
+    n += sht_influx_format_u32(&tags[n], handle->bus);
+    tags[n] = '\0';
+
+    prefix->len = 0;
+    ret = sht_influx_prefix_append(prefix, measurement, 1);
+    if (ret == STATUS_OK)
+        ret = sht_influx_prefix_append(prefix, tags, 0);
+    if (ret == STATUS_OK && extra_tags && *extra_tags) {
+        ret = sht_influx_prefix_append(prefix, ",", 0);
+        if (ret == STATUS_OK)
+            ret = sht_influx_prefix_append(prefix, extra_tags, 0);
+    }
+    if (ret == STATUS_OK)
+        ret = sht_influx_prefix_append(prefix, " ", 0);
+    return ret;
+}
+
+void sht_influx_batch_init(sht_influx_batch_t* batch, char* buf,
+                           uint16_t size, uint64_t epoch_ms) {
+    batch->buf = buf;
+    batch->size = size;
+    batch->epoch_ms = epoch_ms;
+    sht_influx_batch_reset(batch);
+}
+
+int16_t sht_influx_batch_add(sht_influx_batch_t* batch,
+                             const sht_influx_prefix_t* prefix,
+                             const sht_raw_sample_t* sample) {
+    char fields[SHT_INFLUX_FIELDS_MAX];
+    int32_t temperature;
+    int32_t humidity;
+    uint8_t n = 0;
+
+    if (sample->status == STATUS_OK) {
+        sht_raw_sample_convert(sample, &temperature, &humidity);
+        memcpy(&fields[n], "temperature=", 12);
+        n += 12;
+        n += sht_influx_format_milli(&fields[n], temperature);
+        memcpy(&fields[n], ",humidity=", 10);
+        n += 10;
+        n += sht_influx_format_milli(&fields[n], humidity);
+    } else {
+        memcpy(&fields[n], "status=", 7);
+        n += 7;
+        if (sample->status < 0)
+            fields[n++] = '-';
+        n += sht_influx_format_u32(
+            &fields[n], (uint32_t)(sample->status < 0 ? -sample->status
+                                                      : sample->status));
+        fields[n++] = 'i';
+    }
+    fields[n++] = ' ';
+    n += sht_influx_format_u64(&fields[n],
+                               batch->epoch_ms + sample->timestamp_ms);
+    fields[n++] = '\n';
+
+    if ((uint32_t)batch->len + prefix->len + n > batch->size)
+        return STATUS_ERR_NO_SPACE;
+    memcpy(&batch->buf[batch->len], prefix->text, prefix->len);
+    memcpy(&batch->buf[batch->len + prefix->len], fields, n);
+    batch->len = (uint16_t)(batch->len + prefix->len + n);
+    batch->lines++;
+    return STATUS_OK;
+}
+
+void sht_influx_batch_reset(sht_influx_batch_t* batch) {
+    batch->len = 0;
+    batch->lines = 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Batched InfluxDB line protocol encoding
+ *
+ * Samples are written as one line each,
+ *
+ *     sht,sensor=12,bus=0 temperature=23.456,humidity=45.678 1700000000123
+ *
+ * into a caller provided buffer sized for the body of a single HTTP POST to
+ * the write endpoint with precision=ms. Lines of failed reads carry the
+ * status as integer field instead of the values.
+ *
+ * The measurement name and the tags of a sensor do not change, so they are
+ * escaped and formatted once into a per-handle prefix that every line starts
+ * with. Values are formatted from milli units as fixed-point decimals and
+ * timestamps as integers, two digits per division, without printf or
+ * floating point.
+ *
+ * Sample timestamps are milliseconds of the local clock; the batch adds the
+ * Unix time in milliseconds at which that clock was 0.
+ */
+
+#ifndef SHT_INFLUX_H
+#define SHT_INFLUX_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Maximum length of a line prefix
+ */
+#ifndef SHT_INFLUX_PREFIX_MAX
+#define SHT_INFLUX_PREFIX_MAX 96
+#endif
+
+/**
+ * @brief Measurement and tags of one sensor, formatted once
+ */
+typedef struct _sht_influx_prefix {
+    char text[SHT_INFLUX_PREFIX_MAX]; /* "measurement,tag=value,... " */
+    uint8_t len;
+} sht_influx_prefix_t;
+
+/**
+ * @brief Line protocol payload being built
+ */
+typedef struct _sht_influx_batch {
+    char* buf;
+    uint16_t size;
+    uint16_t len;
+    uint16_t lines;
+    uint64_t epoch_ms; /* Unix time of sample timestamp 0 */
+} sht_influx_batch_t;
+
+/**
+ * @brief Format the prefix of a sensor's lines: the measurement and the
+ * sensor and bus tags of the handle, plus optional extra tags
+ *
+ * @param[out] prefix      the prefix
+ * @param[in]  measurement the measurement name, escaped as needed
+ * @param[in]  handle      the sensor
+ * @param[in]  extra_tags  further tags as "key=value,key=value", already in
+ *                         line protocol syntax, or NULL
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the prefix is too long
+ */
+int16_t sht_influx_prefix_init(sht_influx_prefix_t* prefix,
+                               const char* measurement,
+                               const sht_handle_t* handle,
+                               const char* extra_tags);
+
+/**
+ * @brief Start a batch
+ *
+ * @param[out] batch    the batch
+ * @param[in]  buf      the payload buffer
+ * @param[in]  size     the size of buf, the maximum POST body size
+ * @param[in]  epoch_ms the Unix time in ms of sample timestamp 0
+ */
+void sht_influx_batch_init(sht_influx_batch_t* batch, char* buf,
+                           uint16_t size, uint64_t epoch_ms);
+
+/**
+ * @brief Append the line of a sample
+ *
+ * @param[in] batch  the batch
+ * @param[in] prefix the prefix of the sample's sensor
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the line does not fit; send
+ * the batch and add the sample to the next one
+ */
+int16_t sht_influx_batch_add(sht_influx_batch_t* batch,
+                             const sht_influx_prefix_t* prefix,
+                             const sht_raw_sample_t* sample);
+
+/**
+ * @brief Empty the batch after it was sent
+ *
+ * @param[in] batch the batch
+ */
+void sht_influx_batch_reset(sht_influx_batch_t* batch);
+
+/**
+ * @brief Format milli units as a decimal with three fractional digits
+ *
+ * @param[out] out   at least 13 characters
+ * @param[in]  milli the value multiplied by 1000
+ *
+ * @return the number of characters written, without terminator
+ */
+uint8_t sht_influx_format_milli(char* out, int32_t milli);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_INFLUX_H */
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Batched MQTT publishing implementation
+ */
+
+#include "sht_mqtt.h"
+
+#include <stddef.h>
+
+int16_t sht_mqtt_init(sht_mqtt_t* pub, uint8_t num_topics,
+                      sht_raw_sample_t* queue, uint16_t queue_capacity,
+                      sht_mqtt_msg_t* window, uint8_t window_size,
+                      uint8_t* payload_storage, uint16_t payload_size,
+                      const sht_mqtt_ops_t* ops, void* user_data) {
+    uint16_t capacity;
+    uint8_t i;
+
+    if (!num_topics || num_topics > SHT_MQTT_MAX_TOPICS || !queue_capacity ||
+        !window_size || payload_size < SHT_CBOR_BATCH_SIZE(1, SHT_CBOR_MILLI))
+        return STATUS_ERR_INVALID_PARAMS;
+
+    capacity = (uint16_t)((payload_size - SHT_CBOR_HEADER_SIZE) /
+                          SHT_CBOR_ENTRY_SIZE(SHT_CBOR_MILLI));
+    for (i = 0; i < window_size; ++i) {
+        window[i].payload = &payload_storage[(uint32_t)i * payload_size];
+        window[i].state = SHT_MQTT_MSG_FREE;
+    }
+    for (i = 0; i < SHT_MQTT_MAX_TOPICS; ++i)
+        pub->pending[i] = 0;
+    pub->ops = ops;
+    pub->user_data = user_data;
+    pub->serials = NULL;
+    pub->queue = queue;
+    pub->window = window;
+    pub->max_age_ms = SHT_MQTT_DEFAULT_MAX_AGE_MS;
+    pub->retry_ms = SHT_MQTT_DEFAULT_RETRY_MS;
+    pub->queue_capacity = queue_capacity;
+    pub->head = 0;
+    pub->count = 0;
+    pub->payload_size = payload_size;
+    pub->capacity = capacity;
+    pub->batch_samples = capacity;
+    pub->next_packet_id = 1;
+    pub->num_topics = num_topics;
+    pub->window_size = window_size;
+    pub->units = SHT_CBOR_MILLI;
+    pub->connected = 0;
+    pub->stats.published = 0;
+    pub->stats.samples = 0;
+    pub->stats.acked = 0;
+    pub->stats.resent = 0;
+    pub->stats.dropped = 0;
+    pub->stats.max_queued = 0;
+    return STATUS_OK;
+}
+
+/* timestamp of the oldest queued sample of a topic that has one */
+static uint32_t sht_mqtt_oldest(const sht_mqtt_t* pub, uint8_t topic) {
+    const sht_raw_sample_t* s;
+    uint16_t r = pub->head;
+    uint16_t i;
+
+    for (i = 0; i < pub->count; ++i) {
+        s = &pub->queue[r];
+        if (pub->ops->topic_of(pub->user_data, s) == topic)
+            return s->timestamp_ms;
+        r = (uint16_t)((r + 1) % pub->queue_capacity);
+    }
+    return 0;
+}
+
+int16_t sht_mqtt_submit(sht_mqtt_t* pub, const sht_raw_sample_t* sample) {
+    uint8_t topic = pub->ops->topic_of(pub->user_data, sample);
+    uint8_t dropped;
+
+    if (topic >= pub->num_topics)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    if (pub->count == pub->queue_capacity) {
+        dropped = pub->ops->topic_of(pub->user_data, &pub->queue[pub->head]);
+        pub->head = (uint16_t)((pub->head + 1) % pub->queue_capacity);
+        pub->count--;
+        pub->stats.dropped++;
+        /* the age of the topic now starts at its next queued sample */
+        if (--pub->pending[dropped])
+            pub->oldest_ms[dropped] = sht_mqtt_oldest(pub, dropped);
+    }
+    pub->queue[(pub->head + pub->count) % pub->queue_capacity] = *sample;
+    pub->count++;
+    if (pub->count > pub->stats.max_queued)
+        pub->stats.max_queued = pub->count;
+    if (!pub->pending[topic]++)
+        pub->oldest_ms[topic] = sample->timestamp_ms;
+    return STATUS_OK;
+}
+
+void sht_mqtt_set_connected(sht_mqtt_t* pub, uint8_t connected) {
+    uint8_t i;
+
+    pub->connected = connected;
+    if (!connected)
+        return;
+    /* the session was resumed or restarted: publish the unacknowledged
+     * batches again before the new ones */
+    for (i = 0; i < pub->window_size; ++i) {
+        if (pub->window[i].state == SHT_MQTT_MSG_IN_FLIGHT)
+            pub->window[i].state = SHT_MQTT_MSG_RESEND;
+    }
+}
+
+int16_t sht_mqtt_puback(sht_mqtt_t* pub, uint16_t packet_id) {
+    uint8_t i;
+
+    for (i = 0; i < pub->window_size; ++i) {
+        if (pub->window[i].state != SHT_MQTT_MSG_FREE &&
+            pub->window[i].packet_id == packet_id) {
+            pub->window[i].state = SHT_MQTT_MSG_FREE;
+            pub->stats.acked++;
+            return STATUS_OK;
+        }
+    }
+    return STATUS_ERR_INVALID_PARAMS;
+}
+
+static uint8_t sht_mqtt_send(sht_mqtt_t* pub, sht_mqtt_msg_t* msg,
+                             uint32_t now_ms) {
+    uint8_t dup = msg->state != SHT_MQTT_MSG_READY;
+
+    if (pub->ops->publish(pub->user_data, msg->topic, msg->payload, msg->len,
+                          msg->packet_id, dup) != STATUS_OK) {
+        if (dup)
+            msg->state = SHT_MQTT_MSG_RESEND;
+        pub->connected = 0;
+        return 0;
+    }
+    msg->state = SHT_MQTT_MSG_IN_FLIGHT;
+    msg->sent_ms = now_ms;
+    return 1;
+}
+
+/* move the queued samples of a topic into the payload of msg, compacting the
+ * queue around them */
+static void sht_mqtt_build(sht_mqtt_t* pub, sht_mqtt_msg_t* msg,
+                           uint8_t topic) {
+    sht_cbor_batch_t batch;
+    sht_raw_sample_t* s;
+    uint16_t r = pub->head;
+    uint16_t w = pub->head;
+    uint16_t kept = 0;
+    uint16_t i;
+    uint8_t first = 1;
+
+    sht_cbor_batch_init(&batch, msg->payload, pub->payload_size,
+                        pub->capacity, pub->units);
+    sht_cbor_batch_set_serial(&batch, pub->serials ? pub->serials[topic] : 0);
+
+    for (i = 0; i < pub->count; ++i) {
+        s = &pub->queue[r];
+        if (batch.count < batch.capacity &&
+            pub->ops->topic_of(pub->user_data, s) == topic) {
+            sht_cbor_batch_add(&batch, s, 0);
+        } else {
+            if (first && pub->ops->topic_of(pub->user_data, s) == topic) {
+                pub->oldest_ms[topic] = s->timestamp_ms;
+                first = 0;
+            }
+            if (w != r)
+                pub->queue[w] = *s;
+            w = (uint16_t)((w + 1) % pub->queue_capacity);
+            kept++;
+        }
+        r = (uint16_t)((r + 1) % pub->queue_capacity);
+    }
+    pub->count = kept;
+    pub->pending[topic] = (uint16_t)(pub->pending[topic] - batch.count);
+
+    msg->len = sht_cbor_batch_finish(&batch);
+    msg->samples = batch.count;
+    msg->topic = topic;
+    msg->state = SHT_MQTT_MSG_READY;
+    msg->packet_id = pub->next_packet_id;
+    pub->next_packet_id = (uint16_t)(pub->next_packet_id + 1);
+    if (!pub->next_packet_id)
+        pub->next_packet_id = 1;
+    pub->stats.published++;
+    pub->stats.samples += batch.count;
+}
+
+static uint8_t sht_mqtt_due(const sht_mqtt_t* pub, uint8_t topic,
+                            uint32_t now_ms) {
+    if (!pub->pending[topic])
+        return 0;
+    return pub->pending[topic] >= pub->batch_samples ||
+           (uint32_t)(now_ms - pub->oldest_ms[topic]) >= pub->max_age_ms;
+}
+
+uint16_t sht_mqtt_poll(sht_mqtt_t* pub, uint32_t now_ms) {
+    sht_mqtt_msg_t* msg;
+    uint16_t sent = 0;
+    uint8_t topic = 0;
+    uint8_t idle = 0;
+    uint8_t i;
+
+    if (!pub->connected)
+        return 0;
+
+    for (i = 0; i < pub->window_size; ++i) {
+        msg = &pub->window[i];
+        if (msg->state == SHT_MQTT_MSG_READY ||
+            msg->state == SHT_MQTT_MSG_RESEND ||
+            (msg->state == SHT_MQTT_MSG_IN_FLIGHT &&
+             (uint32_t)(now_ms - msg->sent_ms) >= pub->retry_ms)) {
+            if (msg->state != SHT_MQTT_MSG_READY)
+                pub->stats.resent++;
+            if (!sht_mqtt_send(pub, msg, now_ms))
+                return sent;
+            sent++;
+        }
+    }
+
+    /* round robin over the topics until a full pass finds none due */
+    for (i = 0; i < pub->window_size && idle < pub->num_topics; ++i) {
+        msg = &pub->window[i];
+        if (msg->state != SHT_MQTT_MSG_FREE)
+            continue;
+        while (idle < pub->num_topics && !sht_mqtt_due(pub, topic, now_ms)) {
+            topic = (uint8_t)((topic + 1) % pub->num_topics);
+            idle++;
+        }
+        if (idle == pub->num_topics)
+            break;
+        sht_mqtt_build(pub, msg, topic);
+        topic = (uint8_t)((topic + 1) % pub->num_topics);
+        idle = 0;
+        if (!sht_mqtt_send(pub, msg, now_ms))
+            return sent;
+        sent++;
+    }
+    return sent;
+}
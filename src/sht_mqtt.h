@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Batched MQTT publishing with offline queueing
+ *
+ * Publishing every sample on its own costs a PUBLISH and a PUBACK per sample
+ * at the broker. The publisher instead queues the samples and publishes one
+ * CBOR batch (see sht_cbor.h) per topic once batch_samples samples of the
+ * topic are queued or the oldest of them is max_age_ms old.
+ *
+ * Batches are published with QoS 1. Up to window_size batches are in flight,
+ * each kept in its payload slot until the broker acknowledges it, and
+ * retransmitted with the DUP flag after retry_ms or after a reconnect.
+ *
+ * While the broker is unreachable the samples stay in the queue, which then
+ * works as spill buffer; when it is full the oldest sample is dropped. After
+ * the reconnect the backlog is drained in batches as large as the payload
+ * slots allow.
+ *
+ * The publisher does not implement MQTT itself: the application maps samples
+ * to topics and hands the batches to its MQTT client through callbacks, and
+ * reports connection changes and PUBACKs. All storage is provided by the
+ * application. Sample timestamps and now_ms must come from the same clock.
+ */
+
+#ifndef SHT_MQTT_H
+#define SHT_MQTT_H
+
+#include "sht_cbor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Maximum number of topics of a publisher
+ */
+#ifndef SHT_MQTT_MAX_TOPICS
+#define SHT_MQTT_MAX_TOPICS 16
+#endif
+
+#ifndef SHT_MQTT_DEFAULT_MAX_AGE_MS
+#define SHT_MQTT_DEFAULT_MAX_AGE_MS 10000
+#endif
+
+#ifndef SHT_MQTT_DEFAULT_RETRY_MS
+#define SHT_MQTT_DEFAULT_RETRY_MS 5000
+#endif
+
+typedef struct _sht_mqtt_ops {
+    /* return the topic index of a sample, below num_topics */
+    uint8_t (*topic_of)(void* user_data, const sht_raw_sample_t* sample);
+    /* hand a QoS 1 PUBLISH to the MQTT client, return 0 if it was sent */
+    int16_t (*publish)(void* user_data, uint8_t topic, const uint8_t* payload,
+                       uint16_t len, uint16_t packet_id, uint8_t dup);
+} sht_mqtt_ops_t;
+
+/**
+ * @brief State of a payload slot
+ */
+typedef enum _sht_mqtt_msg_state {
+    SHT_MQTT_MSG_FREE,
+    SHT_MQTT_MSG_READY,     /* built, the first publish failed */
+    SHT_MQTT_MSG_IN_FLIGHT, /* published, waiting for the PUBACK */
+    SHT_MQTT_MSG_RESEND     /* to be published again with DUP */
+} sht_mqtt_msg_state_t;
+
+/**
+ * @brief Payload slot of one batch
+ */
+typedef struct _sht_mqtt_msg {
+    uint8_t* payload;
+    uint32_t sent_ms;
+    uint16_t len;
+    uint16_t packet_id;
+    uint16_t samples;
+    uint8_t topic;
+    uint8_t state; /* sht_mqtt_msg_state_t */
+} sht_mqtt_msg_t;
+
+typedef struct _sht_mqtt_stats {
+    uint32_t published; /* batches built */
+    uint32_t samples;   /* samples in published batches */
+    uint32_t acked;     /* batches acknowledged */
+    uint32_t resent;    /* retransmissions */
+    uint32_t dropped;   /* samples dropped from the full queue */
+    uint16_t max_queued;
+} sht_mqtt_stats_t;
+
+typedef struct _sht_mqtt {
+    const sht_mqtt_ops_t* ops;
+    void* user_data;
+    const uint32_t* serials; /* CBOR serial per topic, or NULL */
+    sht_raw_sample_t* queue; /* ring of queue_capacity samples */
+    sht_mqtt_msg_t* window;
+    uint32_t max_age_ms;
+    uint32_t retry_ms;
+    uint32_t oldest_ms[SHT_MQTT_MAX_TOPICS]; /* oldest queued sample */
+    uint16_t pending[SHT_MQTT_MAX_TOPICS];   /* queued samples per topic */
+    uint16_t queue_capacity;
+    uint16_t head;
+    uint16_t count;
+    uint16_t payload_size;
+    uint16_t capacity;      /* samples per payload */
+    uint16_t batch_samples; /* samples that trigger a batch */
+    uint16_t next_packet_id;
+    uint8_t num_topics;
+    uint8_t window_size;
+    uint8_t units; /* sht_cbor_units_t */
+    uint8_t connected;
+    sht_mqtt_stats_t stats;
+} sht_mqtt_t;
+
+/**
+ * @brief Initialize a publisher on caller provided storage
+ *
+ * batch_samples defaults to the payload capacity, max_age_ms and retry_ms to
+ * SHT_MQTT_DEFAULT_MAX_AGE_MS and SHT_MQTT_DEFAULT_RETRY_MS and the units to
+ * SHT_CBOR_MILLI; the fields may be changed after the initialization. The
+ * publisher starts disconnected.
+ *
+ * @param[out] pub             the publisher
+ * @param[in]  num_topics      the number of topics
+ * @param[in]  queue           storage for queue_capacity samples
+ * @param[in]  queue_capacity  the number of samples kept while offline
+ * @param[in]  window          storage for window_size payload slots
+ * @param[in]  window_size     the maximum number of batches in flight
+ * @param[in]  payload_storage storage for window_size * payload_size bytes
+ * @param[in]  payload_size    the maximum payload size of a batch
+ * @param[in]  ops             the callbacks
+ * @param[in]  user_data       passed to the callbacks
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_mqtt_init(sht_mqtt_t* pub, uint8_t num_topics,
+                      sht_raw_sample_t* queue, uint16_t queue_capacity,
+                      sht_mqtt_msg_t* window, uint8_t window_size,
+                      uint8_t* payload_storage, uint16_t payload_size,
+                      const sht_mqtt_ops_t* ops, void* user_data);
+
+/**
+ * @brief Queue a sample, dropping the oldest queued one if the queue is full
+ *
+ * @param[in] pub    the publisher
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, STATUS_ERR_INVALID_PARAMS for an invalid topic
+ */
+int16_t sht_mqtt_submit(sht_mqtt_t* pub, const sht_raw_sample_t* sample);
+
+/**
+ * @brief Report a connection change of the MQTT client. On connect, the
+ * batches in flight are published again.
+ *
+ * @param[in] pub       the publisher
+ * @param[in] connected 1 when the session is established, 0 when it is lost
+ */
+void sht_mqtt_set_connected(sht_mqtt_t* pub, uint8_t connected);
+
+/**
+ * @brief Report a PUBACK
+ *
+ * @param[in] pub       the publisher
+ * @param[in] packet_id the acknowledged packet id
+ *
+ * @return 0 on success, STATUS_ERR_INVALID_PARAMS for an unknown packet id
+ */
+int16_t sht_mqtt_puback(sht_mqtt_t* pub, uint16_t packet_id);
+
+/**
+ * @brief Retransmit overdue batches and publish the due ones while the window
+ * has room. A failing publish callback marks the publisher disconnected.
+ *
+ * @param[in] pub    the publisher
+ * @param[in] now_ms the current time
+ *
+ * @return the number of batches published, including retransmissions
+ */
+uint16_t sht_mqtt_poll(sht_mqtt_t* pub, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_MQTT_H */
@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief I2C multiplexer implementation
+ */
+
+#include "sht_mux.h"
+#include "sensirion_i2c.h"
+#include "sht_clock.h"
+
+/* last selected path per bus: leaf mux (NULL for the bus segment itself) and
+ * the channels enabled on it */
+static sht_mux_t* sht_mux_last_leaf[SHT_MUX_MAX_BUSES];
+static uint8_t sht_mux_last_mask[SHT_MUX_MAX_BUSES];
+static uint8_t sht_mux_current_bus = 0;
+
+/* fill path with the muxes from the root to leaf, return the depth */
+static uint8_t sht_mux_path(sht_mux_t* leaf, sht_mux_t** path) {
+    uint8_t depth = 0;
+    uint8_t i;
+    sht_mux_t* m;
+
+    for (m = leaf; m && depth < SHT_MUX_MAX_DEPTH; m = m->parent)
+        depth++;
+    for (m = leaf, i = depth; i > 0; m = m->parent)
+        path[--i] = m;
+    return depth;
+}
+
+/* channels enabled on path[i] to reach a leaf enabled with leaf_mask */
+static uint8_t sht_mux_path_mask(sht_mux_t** path, uint8_t depth, uint8_t i,
+                                 uint8_t leaf_mask) {
+    return i + 1 < depth ? (uint8_t)(1U << path[i + 1]->parent_channel)
+                         : leaf_mask;
+}
+
+static int16_t sht_mux_write(sht_mux_t* mux, uint8_t mask) {
+    int16_t ret;
+
+    if (mux->known && mux->selected == mask)
+        return STATUS_OK;
+
+    ret = sensirion_i2c_write(mux->addr, &mask, 1);
+    mux->writes++;
+    mux->known = ret == STATUS_OK;
+    mux->selected = mask;
+    return ret;
+}
+
+static int16_t sht_mux_enter(uint8_t bus, sht_mux_t* leaf, uint8_t mask) {
+    sht_mux_t* prev[SHT_MUX_MAX_DEPTH];
+    sht_mux_t* next[SHT_MUX_MAX_DEPTH];
+    uint8_t dp;
+    uint8_t dn;
+    uint8_t keep;
+    uint8_t k;
+    uint8_t i;
+    int16_t ret;
+
+    if (bus >= SHT_MUX_MAX_BUSES)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    if (bus != sht_mux_current_bus) {
+        ret = sensirion_i2c_select_bus(bus);
+        if (ret != STATUS_OK)
+            return ret;
+        sht_mux_current_bus = bus;
+    }
+
+    dp = sht_mux_path(sht_mux_last_leaf[bus], prev);
+    dn = sht_mux_path(leaf, next);
+
+    /* the paths share their muxes and channels up to k */
+    for (k = 0; k < dp && k < dn && prev[k] == next[k] &&
+                sht_mux_path_mask(prev, dp, k, sht_mux_last_mask[bus]) ==
+                    sht_mux_path_mask(next, dn, k, mask);
+         ++k)
+        ;
+    /* a mux shared by both paths is only switched to its new channels */
+    keep = k < dp && k < dn && prev[k] == next[k] ? (uint8_t)(k + 1) : k;
+
+    /* close the rest of the previous path, deepest first while it is still
+     * reachable: a mux left enabled behind a channel that is switched off
+     * would reappear next to its siblings once the channel is enabled again */
+    for (i = dp; i > keep; --i) {
+        ret = sht_mux_write(prev[i - 1], 0);
+        if (ret != STATUS_OK)
+            return ret;
+        sht_mux_last_leaf[bus] = i > 1 ? prev[i - 2] : NULL;
+        sht_mux_last_mask[bus] = (uint8_t)(1U << prev[i - 1]->parent_channel);
+    }
+
+    /* the previous path is closed or partially reused, remember the new one
+     * only once it is fully enabled */
+    sht_mux_last_leaf[bus] = NULL;
+    for (i = 0; i < dn; ++i) {
+        ret = sht_mux_write(next[i], sht_mux_path_mask(next, dn, i, mask));
+        if (ret != STATUS_OK)
+            return ret;
+        sht_mux_last_leaf[bus] = next[i];
+        sht_mux_last_mask[bus] = next[i]->selected;
+    }
+    return STATUS_OK;
+}
+
+/* enter a path at a clock every device on the old and the new path supports,
+ * then raise the clock to the one of the new path */
+static int16_t sht_mux_enter_clocked(uint8_t bus, sht_mux_t* leaf,
+                                     uint8_t mask, uint16_t clock_khz) {
+    int16_t ret = sht_clock_limit(bus, clock_khz);
+
+    if (ret == STATUS_OK)
+        ret = sht_mux_enter(bus, leaf, mask);
+    if (ret == STATUS_OK)
+        ret = sht_clock_select(bus, clock_khz);
+    return ret;
+}
+
+static int sht_mux_compare(const sht_handle_t* a, const sht_handle_t* b) {
+    sht_mux_t* pa[SHT_MUX_MAX_DEPTH];
+    sht_mux_t* pb[SHT_MUX_MAX_DEPTH];
+    uint8_t da;
+    uint8_t db;
+    uint16_t ka;
+    uint16_t kb;
+    uint8_t ca;
+    uint8_t cb;
+    uint8_t i;
+
+    if (a->bus != b->bus)
+        return a->bus < b->bus ? -1 : 1;
+
+    ka = sht_clock_handle_khz(a);
+    kb = sht_clock_handle_khz(b);
+    if (ka != kb)
+        return ka > kb ? -1 : 1;
+
+    da = sht_mux_path(a->mux, pa);
+    db = sht_mux_path(b->mux, pb);
+    for (i = 0; i < da && i < db; ++i) {
+        if (pa[i] != pb[i])
+            return pa[i]->addr < pb[i]->addr ? -1 : 1;
+        ca = i + 1 < da ? pa[i + 1]->parent_channel : a->channel;
+        cb = i + 1 < db ? pb[i + 1]->parent_channel : b->channel;
+        if (ca != cb)
+            return ca < cb ? -1 : 1;
+    }
+    /* sensors on a segment come before the muxes hanging on it */
+    if (da != db)
+        return da < db ? -1 : 1;
+    return 0;
+}
+
+void sht_mux_init(sht_mux_t* mux, uint8_t bus, uint8_t addr, uint8_t flags,
+                  sht_mux_t* parent, uint8_t parent_channel) {
+    mux->parent = parent;
+    mux->parent_channel = parent_channel;
+    mux->bus = bus;
+    mux->addr = addr;
+    mux->flags = flags;
+    mux->selected = 0;
+    mux->known = 0;
+    mux->clock_khz = 0;
+    mux->writes = 0;
+}
+
+int16_t sht_mux_select(sht_mux_t* mux, uint8_t mask) {
+    return sht_mux_enter(mux->bus, mux, mask);
+}
+
+int16_t sht_mux_select_handle(const sht_handle_t* handle) {
+    return sht_mux_enter_clocked(handle->bus, handle->mux,
+                                 (uint8_t)(1U << handle->channel),
+                                 sht_clock_handle_khz(handle));
+}
+
+uint8_t sht_mux_select_writes(const sht_handle_t* handle) {
+    sht_mux_t* path[SHT_MUX_MAX_DEPTH];
+    uint8_t depth;
+
+    if (handle->bus >= SHT_MUX_MAX_BUSES)
+        return 0;
+    depth = sht_mux_path(sht_mux_last_leaf[handle->bus], path);
+    return (uint8_t)(depth + sht_mux_path(handle->mux, path));
+}
+
+int16_t sht_mux_close(uint8_t bus) {
+    /* nothing open, leave the selected bus alone */
+    if (bus >= SHT_MUX_MAX_BUSES || !sht_mux_last_leaf[bus])
+        return STATUS_OK;
+    return sht_mux_enter(bus, NULL, 0);
+}
+
+void sht_mux_invalidate(sht_mux_t* mux) {
+    mux->known = 0;
+    if (mux->bus < SHT_MUX_MAX_BUSES)
+        sht_mux_last_leaf[mux->bus] = NULL;
+}
+
+void sht_mux_plan(const sht_handle_t* handles, uint16_t num_handles,
+                  uint16_t* order) {
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+
+    /* insertion sort, stable: planning is done once per topology */
+    for (i = 0; i < num_handles; ++i) {
+        k = i;
+        for (j = i; j > 0 &&
+                    sht_mux_compare(&handles[order[j - 1]], &handles[k]) > 0;
+             --j)
+            order[j] = order[j - 1];
+        order[j] = k;
+    }
+}
+
+uint16_t sht_mux_sweep_trigger(const sht_handle_t* handles,
+                               const uint16_t* order, uint16_t num_handles) {
+    const sht_handle_t* h;
+    const sht_handle_t* g;
+    uint16_t failed = 0;
+    uint16_t first;
+    uint16_t end;
+    uint16_t i;
+    uint16_t j;
+    uint16_t khz;
+    uint8_t mask;
+    int16_t entered;
+    int16_t ret;
+
+    for (first = 0; first < num_handles; first = end) {
+        g = &handles[order[first]];
+        khz = sht_clock_handle_khz(g);
+        mask = 0;
+        for (end = first; end < num_handles; ++end) {
+            h = &handles[order[end]];
+            if (h->bus != g->bus || h->mux != g->mux ||
+                sht_clock_handle_khz(h) != khz)
+                break;
+            mask |= (uint8_t)(1U << h->channel);
+        }
+
+        if (!g->mux || !(g->mux->flags & SHT_MUX_FLAG_MULTI_CHANNEL)) {
+            for (i = first; i < end; ++i) {
+                h = &handles[order[i]];
+                ret = sht_mux_select_handle(h);
+                if (ret == STATUS_OK)
+                    ret = sht_handle_measure(h);
+                if (ret != STATUS_OK)
+                    failed++;
+            }
+            continue;
+        }
+
+        /* all channels enabled: one write per (family, address) reaches
+         * the sensors of every channel at once */
+        entered = sht_mux_enter_clocked(g->bus, g->mux, mask, khz);
+        for (i = first; i < end; ++i) {
+            h = &handles[order[i]];
+            for (j = first; j < i; ++j) {
+                if (handles[order[j]].addr == h->addr &&
+                    handles[order[j]].family == h->family)
+                    break;
+            }
+            /* triggered, or counted, with the first handle of its kind */
+            if (j < i)
+                continue;
+            ret = entered;
+            if (ret == STATUS_OK)
+                ret = sht_handle_measure(h);
+            if (ret == STATUS_OK)
+                continue;
+            /* the handles sharing the failed write fail with it */
+            for (j = i; j < end; ++j) {
+                if (handles[order[j]].addr == h->addr &&
+                    handles[order[j]].family == h->family)
+                    failed++;
+            }
+        }
+    }
+    return failed;
+}
+
+uint16_t sht_mux_sweep_collect(sht_handle_t* handles, const uint16_t* order,
+                               uint16_t num_handles, uint32_t now_ms,
+                               sht_raw_sample_t* samples) {
+    sht_handle_t* h;
+    uint16_t failed = 0;
+    uint16_t i;
+    int16_t ret;
+
+    for (i = 0; i < num_handles; ++i) {
+        h = &handles[order[i]];
+        ret = sht_mux_select_handle(h);
+        if (ret == STATUS_OK) {
+            ret = sht_handle_read_sample(h, now_ms, &samples[i]);
+        } else {
+            samples[i].timestamp_ms = now_ms;
+            samples[i].sensor_id = h->id;
+            samples[i].seq = h->seq++;
+            samples[i].t_ticks = 0;
+            samples[i].rh_ticks = 0;
+            samples[i].status = ret;
+            samples[i].bus = h->bus;
+            samples[i].family = h->family;
+        }
+        if (ret != STATUS_OK)
+            failed++;
+    }
+    return failed;
+}
+
+uint16_t sht_mux_sweep(sht_handle_t* handles, const uint16_t* order,
+                       uint16_t num_handles, uint32_t now_ms,
+                       sht_raw_sample_t* samples) {
+    uint32_t wait = 0;
+    uint32_t d;
+    uint16_t failed;
+    uint16_t i;
+
+    for (i = 0; i < num_handles; ++i) {
+        d = sht_handle_measurement_duration_usec(&handles[order[i]]);
+        if (d > wait)
+            wait = d;
+    }
+
+    failed = sht_mux_sweep_trigger(handles, order, num_handles);
+    sensirion_sleep_usec(wait);
+    return failed +
+           sht_mux_sweep_collect(handles, order, num_handles, now_ms, samples);
+}
+
+uint16_t sht_mux_order_filter(const uint16_t* order, uint16_t count,
+                              sht_mux_keep_fn keep, void* ctx,
+                              uint32_t now_ms, uint16_t* kept) {
+    uint16_t n = 0;
+    uint16_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (keep(ctx, order[i], now_ms))
+            kept[n++] = order[i];
+    }
+    return n;
+}
+
+void sht_mux_order_report(const uint16_t* order,
+                          const sht_raw_sample_t* samples, uint16_t count,
+                          sht_mux_report_fn report, void* ctx,
+                          uint32_t now_ms) {
+    uint16_t i;
+
+    for (i = 0; i < count; ++i)
+        report(ctx, order[i], samples[i].status, now_ms);
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief I2C multiplexer topology and multiplexer-aware sweeps
+ *
+ * Sensors with a fixed address (SHT4x at 0x44, SHTC1 at 0x70) are deployed in
+ * numbers behind TCA9548A-style multiplexers: a mux is an I2C device whose
+ * one byte control register enables its downstream channels, one bit each.
+ * Muxes may be cascaded; a mux behind another one records its parent and the
+ * parent channel it hangs on.
+ *
+ * Every mux caches its control register, so selecting the channel that is
+ * already enabled costs no transaction. A sweep visits the handles in
+ * topology order, which makes the number of channel switches minimal, and
+ * splits into a trigger and a collect phase: muxes flagged with
+ * SHT_MUX_FLAG_MULTI_CHANNEL get all their used channels enabled at once and
+ * each distinct (family, address) pair is triggered with a single write that
+ * reaches all channels in parallel. Reads are always done one channel at a
+ * time.
+ *
+ * Muxes on the same bus segment are never enabled at the same time: the last
+ * selected path is remembered per bus and, when a different mux on the same
+ * segment is entered, the previous one is closed first. Accessing a mux behind
+ * another code path invalidates this bookkeeping; use sht_mux_invalidate() to
+ * resynchronize. The bus itself is only switched with
+ * sensirion_i2c_select_bus() when it differs from the last selected one, bus 0
+ * being selected initially.
+ *
+ * Selecting a handle also sets the bus clock of the handle, see sht_clock.h.
+ *
+ * Note that the TCA9548A address range 0x70-0x77 overlaps the SHTC1 address,
+ * so an SHTC1 must not share a segment with a mux strapped to 0x70.
+ */
+
+#ifndef SHT_MUX_H
+#define SHT_MUX_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The mux supports enabling several channels at once
+ */
+#define SHT_MUX_FLAG_MULTI_CHANNEL 0x01U
+
+/**
+ * @brief Maximum cascading depth of muxes
+ */
+#ifndef SHT_MUX_MAX_DEPTH
+#define SHT_MUX_MAX_DEPTH 4
+#endif
+
+/**
+ * @brief Number of buses whose selected path is tracked
+ */
+#ifndef SHT_MUX_MAX_BUSES
+#define SHT_MUX_MAX_BUSES 8
+#endif
+
+/**
+ * @brief One multiplexer
+ */
+typedef struct _sht_mux {
+    struct _sht_mux* parent; /* upstream mux, or NULL if on the bus */
+    uint8_t parent_channel;  /* channel of the parent the mux hangs on */
+    uint8_t bus;
+    uint8_t addr;       /* 7-bit I2C address of the mux */
+    uint8_t flags;      /* SHT_MUX_FLAG_* */
+    uint8_t selected;   /* cached control register */
+    uint8_t known;      /* selected matches the device */
+    uint16_t clock_khz; /* highest SCL frequency of the mux, 0 if unlimited */
+    uint32_t writes;    /* control register writes */
+} sht_mux_t;
+
+/**
+ * @brief Initialize a mux; its channel state is unknown until first written.
+ * The mux does not limit the bus clock until clock_khz is set.
+ *
+ * @param[out] mux            the mux
+ * @param[in]  bus            the bus the mux (or its root parent) is on
+ * @param[in]  addr           the mux address
+ * @param[in]  flags          SHT_MUX_FLAG_* of the mux type
+ * @param[in]  parent         upstream mux, or NULL
+ * @param[in]  parent_channel channel of the parent, ignored without parent
+ */
+void sht_mux_init(sht_mux_t* mux, uint8_t bus, uint8_t addr, uint8_t flags,
+                  sht_mux_t* parent, uint8_t parent_channel);
+
+/**
+ * @brief Enable a set of channels of a mux, enabling the path through its
+ * parents first. Nothing is written if the cache shows the mask is enabled.
+ *
+ * @param[in] mux  the mux
+ * @param[in] mask the channels to enable, one bit per channel
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_mux_select(sht_mux_t* mux, uint8_t mask);
+
+/**
+ * @brief Select the bus and the mux path of a handle
+ *
+ * @param[in] handle the sensor
+ *
+ * @return 0 if the command was successful, else an error code
+ */
+int16_t sht_mux_select_handle(const sht_handle_t* handle);
+
+/**
+ * @brief Return the most control register writes sht_mux_select_handle() can
+ * take from the current selection: closing the open path of the bus and
+ * opening the path of the handle
+ *
+ * @param[in] handle the sensor
+ *
+ * @return the number of mux writes
+ */
+uint8_t sht_mux_select_writes(const sht_handle_t* handle);
+
+/**
+ * @brief Disable all channels of the last selected path of a bus, deepest mux
+ * first, e.g. before handing the bus to another process
+ *
+ * @param[in] bus the bus index
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_mux_close(uint8_t bus);
+
+/**
+ * @brief Forget the cached channel state of a mux, e.g. after a bus reset,
+ * and the last selected path of its bus
+ *
+ * @param[in] mux the mux
+ */
+void sht_mux_invalidate(sht_mux_t* mux);
+
+/**
+ * @brief Order handles for sweeping: by bus, then by bus clock, fastest
+ * first, then by mux path and channel, so that each clock is set and each
+ * channel is enabled once per sweep
+ *
+ * @param[in]  handles     the sensors
+ * @param[in]  num_handles the number of sensors
+ * @param[out] order       num_handles indices into handles, in sweep order
+ */
+void sht_mux_plan(const sht_handle_t* handles, uint16_t num_handles,
+                  uint16_t* order);
+
+/**
+ * @brief Trigger a measurement on all sensors, in parallel where the muxes
+ * allow it
+ *
+ * @param[in] handles     the sensors
+ * @param[in] order       the sweep order from sht_mux_plan()
+ * @param[in] num_handles the number of sensors
+ *
+ * @return the number of failed triggers; handles sharing a write with a
+ * failed one count as failed
+ */
+uint16_t sht_mux_sweep_trigger(const sht_handle_t* handles,
+                               const uint16_t* order, uint16_t num_handles);
+
+/**
+ * @brief Read out all sensors triggered by sht_mux_sweep_trigger()
+ *
+ * @param[in]  handles     the sensors
+ * @param[in]  order       the sweep order from sht_mux_plan()
+ * @param[in]  num_handles the number of sensors
+ * @param[in]  now_ms      the timestamp of the samples
+ * @param[out] samples     num_handles samples, in sweep order
+ *
+ * @return the number of failed reads
+ */
+uint16_t sht_mux_sweep_collect(sht_handle_t* handles, const uint16_t* order,
+                               uint16_t num_handles, uint32_t now_ms,
+                               sht_raw_sample_t* samples);
+
+/**
+ * @brief Trigger, wait for the slowest swept sensor and collect all swept
+ * sensors
+ *
+ * @param[in]  handles     the sensors
+ * @param[in]  order       the sweep order from sht_mux_plan(), or a subset of
+ *                         it, e.g. from sht_mux_order_filter()
+ * @param[in]  num_handles the number of indices in order
+ * @param[in]  now_ms      the timestamp of the samples
+ * @param[out] samples     num_handles samples, in sweep order
+ *
+ * @return the number of failed reads or triggers
+ */
+uint16_t sht_mux_sweep(sht_handle_t* handles, const uint16_t* order,
+                       uint16_t num_handles, uint32_t now_ms,
+                       sht_raw_sample_t* samples);
+
+/**
+ * @brief Decide whether the handle at index takes part in the next sweep,
+ * see sht_mux_order_filter()
+ */
+typedef uint8_t (*sht_mux_keep_fn)(void* ctx, uint16_t index,
+                                   uint32_t now_ms);
+
+/**
+ * @brief Take the outcome of the transaction with the handle at index, see
+ * sht_mux_order_report()
+ */
+typedef void (*sht_mux_report_fn)(void* ctx, uint16_t index, int16_t ret,
+                                  uint32_t now_ms);
+
+/**
+ * @brief Copy the handles of a sweep order that keep() accepts, keeping their
+ * order, e.g. to leave out failing sensors
+ *
+ * @param[in]  order  the sweep order, e.g. from sht_mux_plan()
+ * @param[in]  count  the number of indices in order
+ * @param[in]  keep   called once per index, in order
+ * @param[in]  ctx    passed to keep
+ * @param[in]  now_ms passed to keep
+ * @param[out] kept   storage for up to count indices, may equal order
+ *
+ * @return the number of handles kept
+ */
+uint16_t sht_mux_order_filter(const uint16_t* order, uint16_t count,
+                              sht_mux_keep_fn keep, void* ctx,
+                              uint32_t now_ms, uint16_t* kept);
+
+/**
+ * @brief Hand the status of each sample of a sweep to report()
+ *
+ * @param[in] order   the swept handle indices
+ * @param[in] samples the samples, in sweep order
+ * @param[in] count   the number of swept handles
+ * @param[in] report  called once per index, in order
+ * @param[in] ctx     passed to report
+ * @param[in] now_ms  passed to report
+ */
+void sht_mux_order_report(const uint16_t* order,
+                          const sht_raw_sample_t* samples, uint16_t count,
+                          sht_mux_report_fn report, void* ctx,
+                          uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_MUX_H */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Frame-of-reference bit packing implementation
+ */
+
+#include "sht_pack.h"
+
+#include <string.h>
+
+/* lanes whose three byte load stays inside the payload for any width */
+#define SHT_PACK_SAFE_LANES (SHT_PACK_BLOCK_SAMPLES - 16)
+
+/* conversion as in sht_raw_sample_convert(): (scale * ticks >> 13) + offset */
+static const int32_t SHT_PACK_SCALE[] = {21875, 12500, 15625};
+static const int32_t SHT_PACK_OFFSET[] = {-45000, 0, -6000};
+
+/* offset of lane i, loading three bytes */
+#define SHT_PACK_LANE(p, i, w, mask)                                         \
+    ((((uint32_t)(p)[((i) * (w)) >> 3] |                                     \
+       (uint32_t)(p)[(((i) * (w)) >> 3) + 1] << 8 |                          \
+       (uint32_t)(p)[(((i) * (w)) >> 3) + 2] << 16) >>                       \
+      (((i) * (w)) & 7)) &                                                   \
+     (mask))
+
+/* offset of lane i near the end of the payload, loading what exists */
+static uint32_t sht_pack_lane_tail(const uint8_t* p, uint16_t len, uint16_t i,
+                                   uint8_t w, uint32_t mask) {
+    uint16_t byte = (uint16_t)((i * w) >> 3);
+    uint32_t v = p[byte];
+
+    if (byte + 1 < len)
+        v |= (uint32_t)p[byte + 1] << 8;
+    if (byte + 2 < len)
+        v |= (uint32_t)p[byte + 2] << 16;
+    return (v >> ((i * w) & 7)) & mask;
+}
+
+uint16_t sht_pack_encode(const uint16_t* ticks, uint8_t count,
+                         uint8_t* block) {
+    uint16_t min = ticks[0];
+    uint16_t max = ticks[0];
+    uint16_t range;
+    uint8_t* p = &block[SHT_PACK_HEADER_SIZE];
+    uint32_t acc = 0;
+    uint8_t bits = 0;
+    uint8_t width = 0;
+    uint16_t i;
+
+    for (i = 1; i < count; ++i) {
+        if (ticks[i] < min)
+            min = ticks[i];
+        if (ticks[i] > max)
+            max = ticks[i];
+    }
+    for (range = (uint16_t)(max - min); range; range >>= 1)
+        width++;
+
+    block[0] = (uint8_t)min;
+    block[1] = (uint8_t)(min >> 8);
+    block[2] = width;
+    block[3] = count;
+
+    if (width) {
+        for (i = 0; i < count; ++i) {
+            acc |= (uint32_t)(uint16_t)(ticks[i] - min) << bits;
+            bits = (uint8_t)(bits + width);
+            while (bits >= 8) {
+                *p++ = (uint8_t)acc;
+                acc >>= 8;
+                bits = (uint8_t)(bits - 8);
+            }
+        }
+        if (bits)
+            *p++ = (uint8_t)acc;
+        /* zero lanes up to the fixed block size */
+        memset(p, 0, (size_t)(block + SHT_PACK_BLOCK_SIZE(width) - p));
+    }
+    return SHT_PACK_BLOCK_SIZE(width);
+}
+
+uint16_t sht_pack_block_size(const uint8_t* block) {
+    return SHT_PACK_BLOCK_SIZE(block[2]);
+}
+
+uint8_t sht_pack_block_count(const uint8_t* block) {
+    return block[3];
+}
+
+void sht_pack_decode(const uint8_t* block, uint16_t* ticks) {
+    const uint8_t* p = &block[SHT_PACK_HEADER_SIZE];
+    uint16_t base = (uint16_t)(block[0] | (uint16_t)block[1] << 8);
+    uint8_t w = block[2];
+    uint16_t len = (uint16_t)(SHT_PACK_BLOCK_SIZE(w) - SHT_PACK_HEADER_SIZE);
+    uint32_t mask = ((uint32_t)1 << w) - 1;
+    uint16_t i;
+
+    if (!w) {
+        for (i = 0; i < SHT_PACK_BLOCK_SAMPLES; ++i)
+            ticks[i] = base;
+        return;
+    }
+    for (i = 0; i < SHT_PACK_SAFE_LANES; ++i)
+        ticks[i] = (uint16_t)(base + SHT_PACK_LANE(p, i, w, mask));
+    for (; i < SHT_PACK_BLOCK_SAMPLES; ++i)
+        ticks[i] = (uint16_t)(base + sht_pack_lane_tail(p, len, i, w, mask));
+}
+
+void sht_pack_decode_milli(const uint8_t* block, uint8_t quantity,
+                           int32_t* values) {
+    const uint8_t* p = &block[SHT_PACK_HEADER_SIZE];
+    int32_t base = (int32_t)(block[0] | (uint16_t)block[1] << 8);
+    uint8_t w = block[2];
+    uint16_t len = (uint16_t)(SHT_PACK_BLOCK_SIZE(w) - SHT_PACK_HEADER_SIZE);
+    uint32_t mask = ((uint32_t)1 << w) - 1;
+    int32_t scale = SHT_PACK_SCALE[quantity];
+    int32_t offset = SHT_PACK_OFFSET[quantity];
+    int32_t ticks;
+    uint16_t i;
+
+    if (!w) {
+        for (i = 0; i < SHT_PACK_BLOCK_SAMPLES; ++i)
+            values[i] = ((scale * base) >> 13) + offset;
+        return;
+    }
+    for (i = 0; i < SHT_PACK_SAFE_LANES; ++i)
+        values[i] =
+            ((scale * (base + (int32_t)SHT_PACK_LANE(p, i, w, mask))) >> 13) +
+            offset;
+    for (; i < SHT_PACK_BLOCK_SAMPLES; ++i) {
+        ticks = base + (int32_t)sht_pack_lane_tail(p, len, i, w, mask);
+        values[i] = ((scale * ticks) >> 13) + offset;
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Frame-of-reference bit packing of tick columns
+ *
+ * A column of temperature or humidity ticks is stored in blocks of
+ * SHT_PACK_BLOCK_SAMPLES values as the block minimum (the base) and the
+ * offsets from it, packed with the bit width of the largest offset:
+ *
+ *     base (uint16, LE) | width | count | 16 * width bytes of offsets
+ *
+ * Offsets are packed LSB first, value i at bit i * width. A block always
+ * holds SHT_PACK_BLOCK_SAMPLES offsets; the lanes past count are 0, so a
+ * block has a size fixed by its width. Slowly changing climate data packs
+ * into a few bits per value.
+ *
+ * Encoding is a min/max pass and a shift loop, cheap enough for the MCU.
+ * Decoding extracts each lane independently of the others with a three byte
+ * load and a shift, so the loop has no carried dependency and vectorizes on
+ * the host. The fused decoders convert the ticks while unpacking, without an
+ * intermediate tick array.
+ */
+
+#ifndef SHT_PACK_H
+#define SHT_PACK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_PACK_BLOCK_SAMPLES 128
+#define SHT_PACK_HEADER_SIZE 4
+
+/**
+ * @brief Size of a block with the given bit width
+ */
+#define SHT_PACK_BLOCK_SIZE(width) \
+    (SHT_PACK_HEADER_SIZE + (SHT_PACK_BLOCK_SAMPLES / 8) * (width))
+
+/**
+ * @brief Buffer size that holds any block
+ */
+#define SHT_PACK_BLOCK_MAX_SIZE SHT_PACK_BLOCK_SIZE(16)
+
+/**
+ * @brief Quantity of a packed column, selecting the conversion
+ */
+typedef enum _sht_pack_quantity {
+    SHT_PACK_TEMPERATURE,   /* milli degree Celsius */
+    SHT_PACK_HUMIDITY,      /* milli percent, SHT3x and SHTC1 */
+    SHT_PACK_HUMIDITY_SHT4X /* milli percent, SHT4x */
+} sht_pack_quantity_t;
+
+/**
+ * @brief Encode up to SHT_PACK_BLOCK_SAMPLES ticks into a block
+ *
+ * @param[in]  ticks the ticks
+ * @param[in]  count the number of ticks, 1 to SHT_PACK_BLOCK_SAMPLES
+ * @param[out] block at least SHT_PACK_BLOCK_MAX_SIZE bytes
+ *
+ * @return the size of the block
+ */
+uint16_t sht_pack_encode(const uint16_t* ticks, uint8_t count, uint8_t* block);
+
+/**
+ * @brief Return the size of an encoded block
+ *
+ * @param[in] block the block
+ *
+ * @return the size in bytes
+ */
+uint16_t sht_pack_block_size(const uint8_t* block);
+
+/**
+ * @brief Return the number of values of an encoded block
+ *
+ * @param[in] block the block
+ *
+ * @return the count given to sht_pack_encode()
+ */
+uint8_t sht_pack_block_count(const uint8_t* block);
+
+/**
+ * @brief Decode the ticks of a block
+ *
+ * @param[in]  block the block
+ * @param[out] ticks SHT_PACK_BLOCK_SAMPLES ticks, of which the first
+ *                   sht_pack_block_count() are valid
+ */
+void sht_pack_decode(const uint8_t* block, uint16_t* ticks);
+
+/**
+ * @brief Decode a block and convert the ticks in the same pass
+ *
+ * @param[in]  block    the block
+ * @param[in]  quantity the sht_pack_quantity_t of the column
+ * @param[out] values   SHT_PACK_BLOCK_SAMPLES values in milli units, of which
+ *                      the first sht_pack_block_count() are valid
+ */
+void sht_pack_decode_milli(const uint8_t* block, uint8_t quantity,
+                           int32_t* values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_PACK_H */
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Presence tracking implementation
+ */
+
+#include "sht_presence.h"
+#include "sht_clock.h"
+#include "sht_mux.h"
+
+static void sht_presence_quarantine(sht_presence_t* presence,
+                                    sht_presence_entry_t* e, uint32_t now_ms) {
+    e->state = SHT_PRESENCE_QUARANTINED;
+    e->backoff_ms = presence->min_backoff_ms;
+    e->next_probe_ms = now_ms + e->backoff_ms;
+    presence->quarantines++;
+}
+
+static void sht_presence_backoff(sht_presence_t* presence,
+                                 sht_presence_entry_t* e, uint32_t now_ms) {
+    e->next_probe_ms = now_ms + e->backoff_ms;
+    if (e->backoff_ms > presence->max_backoff_ms / 2)
+        e->backoff_ms = presence->max_backoff_ms;
+    else
+        e->backoff_ms *= 2;
+}
+
+int16_t sht_presence_init(sht_presence_t* presence, sht_handle_t* handles,
+                          sht_presence_entry_t* entries, uint16_t num_handles,
+                          uint8_t quarantine_after, uint32_t min_backoff_ms,
+                          uint32_t max_backoff_ms,
+                          sht_presence_online_fn on_online, void* user_data,
+                          uint32_t now_ms) {
+    uint16_t i;
+
+    if (quarantine_after == 0 || min_backoff_ms == 0 ||
+        max_backoff_ms < min_backoff_ms)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    presence->handles = handles;
+    presence->entries = entries;
+    presence->num_handles = num_handles;
+    presence->cursor = 0;
+    presence->quarantine_after = quarantine_after;
+    presence->min_backoff_ms = min_backoff_ms;
+    presence->max_backoff_ms = max_backoff_ms;
+    presence->on_online = on_online;
+    presence->user_data = user_data;
+    presence->quarantines = 0;
+    presence->probes = 0;
+    presence->onlines = 0;
+    presence->replacements = 0;
+
+    for (i = 0; i < num_handles; ++i) {
+        entries[i].serial = 0;
+        entries[i].next_probe_ms = now_ms;
+        entries[i].backoff_ms = min_backoff_ms;
+        entries[i].state = SHT_PRESENCE_QUARANTINED;
+        entries[i].failures = 0;
+        entries[i].has_serial = 0;
+    }
+    return STATUS_OK;
+}
+
+void sht_presence_report(sht_presence_t* presence, uint16_t index,
+                         int16_t ret, uint32_t now_ms) {
+    sht_presence_entry_t* e = &presence->entries[index];
+
+    if (e->state != SHT_PRESENCE_ONLINE)
+        return;
+    if (ret == STATUS_OK) {
+        e->failures = 0;
+        return;
+    }
+    /* a CRC error proves the sensor answered, but a pulled sensor may also
+     * leave garbage on the bus: count every failure */
+    if (++e->failures >= presence->quarantine_after)
+        sht_presence_quarantine(presence, e, now_ms);
+}
+
+static void sht_presence_report_fn(void* ctx, uint16_t index, int16_t ret,
+                                   uint32_t now_ms) {
+    sht_presence_report((sht_presence_t*)ctx, index, ret, now_ms);
+}
+
+void sht_presence_report_samples(sht_presence_t* presence,
+                                 const uint16_t* order,
+                                 const sht_raw_sample_t* samples,
+                                 uint16_t count, uint32_t now_ms) {
+    sht_mux_order_report(order, samples, count, sht_presence_report_fn,
+                         presence, now_ms);
+}
+
+uint8_t sht_presence_is_online(const sht_presence_t* presence,
+                               uint16_t index) {
+    return presence->entries[index].state == SHT_PRESENCE_ONLINE;
+}
+
+static uint8_t sht_presence_keep_fn(void* ctx, uint16_t index,
+                                    uint32_t now_ms) {
+    return sht_presence_is_online((const sht_presence_t*)ctx, index);
+}
+
+uint16_t sht_presence_filter(const sht_presence_t* presence,
+                             const uint16_t* order, uint16_t count,
+                             uint16_t* online) {
+    return sht_mux_order_filter(order, count, sht_presence_keep_fn,
+                                (void*)presence, 0, online);
+}
+
+static int16_t sht_presence_probe(sht_presence_t* presence, uint16_t index) {
+    sht_handle_t* handle = &presence->handles[index];
+    sht_presence_entry_t* e = &presence->entries[index];
+    uint32_t serial;
+    uint8_t replaced;
+    int16_t ret;
+
+    presence->probes++;
+    ret = sht_mux_select_handle(handle);
+    if (ret != STATUS_OK)
+        return ret;
+    /* the serial number read is the probe; wake a sleeping SHTC1 first */
+    (void)sht_handle_wake_up(handle);
+    ret = sht_handle_read_serial(handle, &serial);
+    if (ret != STATUS_OK)
+        return ret;
+
+    replaced = e->has_serial && e->serial != serial;
+    if (presence->on_online) {
+        ret = presence->on_online(presence->user_data, handle, serial,
+                                  replaced);
+        if (ret != STATUS_OK)
+            return ret;
+    }
+    if (replaced)
+        presence->replacements++;
+    e->serial = serial;
+    e->has_serial = 1;
+    return STATUS_OK;
+}
+
+/* bus time of a probe: mux selection and serial number read */
+static uint32_t sht_presence_probe_usec(const sht_handle_t* handle) {
+    uint16_t khz = sht_clock_handle_khz(handle);
+
+    return sht_mux_select_writes(handle) * SHT_HANDLE_TRANSFER_USEC(1, khz) +
+           sht_handle_serial_duration_usec(handle, khz);
+}
+
+uint16_t sht_presence_poll(sht_presence_t* presence, uint32_t now_ms,
+                           uint32_t idle_usec) {
+    uint16_t n = presence->num_handles;
+    uint16_t due = n;
+    uint32_t late = 0;
+    uint32_t l;
+    uint16_t i;
+    uint16_t k;
+    sht_presence_entry_t* e;
+
+    /* most overdue handle; the scan starts after the previous probe so that
+     * equally late handles take turns */
+    for (k = 0, i = presence->cursor; k < n; ++k, i = i + 1 < n ? i + 1 : 0) {
+        e = &presence->entries[i];
+        if (e->state != SHT_PRESENCE_QUARANTINED ||
+            (int32_t)(now_ms - e->next_probe_ms) < 0 ||
+            sht_presence_probe_usec(&presence->handles[i]) > idle_usec)
+            continue;
+        l = now_ms - e->next_probe_ms;
+        if (due == n || l > late) {
+            due = i;
+            late = l;
+        }
+    }
+    if (due == n)
+        return n;
+
+    presence->cursor = due + 1 < n ? due + 1 : 0;
+    e = &presence->entries[due];
+    if (sht_presence_probe(presence, due) != STATUS_OK) {
+        sht_presence_backoff(presence, e, now_ms);
+        return n;
+    }
+    e->state = SHT_PRESENCE_ONLINE;
+    e->failures = 0;
+    presence->onlines++;
+    return due;
+}
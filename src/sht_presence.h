@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Presence tracking and background re-probing of hot-plugged sensors
+ *
+ * A sensor that was unplugged fails every transaction with a NACK or a
+ * timeout, costing bus time on every sweep. The presence manager counts the
+ * consecutive failures of each handle and quarantines a handle after
+ * quarantine_after of them. Quarantined handles are left out of the sweep
+ * order returned by sht_presence_filter(), so healthy sensors are swept
+ * without waiting for them.
+ *
+ * Quarantined handles are re-probed by sht_presence_poll(), which the
+ * application calls whenever the bus is idle, passing the length of the gap.
+ * The probe is the serial number read, so a sensor that answers is
+ * identified in the same transactions. A poll performs at most one probe,
+ * and only if the gap fits it: the mux path selection and
+ * sht_handle_serial_duration_usec() at the clock of the handle, so probing
+ * never delays a sweep. Failed probes back off exponentially from
+ * min_backoff_ms to max_backoff_ms. A sensor that answers is handed to the
+ * on_online callback, which re-applies the application's configuration
+ * (alert thresholds, power mode, ...); a changed serial number tells the
+ * callback that a different sensor was plugged in.
+ *
+ * Handles start quarantined and due, so the sensors present at startup are
+ * brought online by the first polls. All times are milliseconds of a free
+ * running 32 bit clock, wrap-around is handled.
+ */
+
+#ifndef SHT_PRESENCE_H
+#define SHT_PRESENCE_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+
+typedef enum _sht_presence_state {
+    SHT_PRESENCE_QUARANTINED, /* left out of sweeps, re-probed when idle */
+    SHT_PRESENCE_ONLINE       /* swept normally */
+} sht_presence_state_t;
+
+/**
+ * @brief Presence state of one handle
+ */
+typedef struct _sht_presence_entry {
+    uint32_t serial;        /* serial number read when last brought online */
+    uint32_t next_probe_ms; /* quarantined: time of the next probe */
+    uint32_t backoff_ms;    /* quarantined: delay after a failed probe */
+    uint8_t state;          /* sht_presence_state_t */
+    uint8_t failures;       /* consecutive failed transactions */
+    uint8_t has_serial;     /* serial is valid */
+} sht_presence_entry_t;
+
+/**
+ * @brief Called when a sensor comes online, to configure it
+ *
+ * @param[in] user_data the user data of the presence manager
+ * @param[in] handle    the sensor, selected on the bus
+ * @param[in] serial    the serial number of the sensor
+ * @param[in] replaced  1 if the serial number differs from the one seen
+ *                      before, i.e. a different sensor was plugged in
+ *
+ * @return 0 to bring the sensor online, else an error code to keep it
+ * quarantined and retry later
+ */
+typedef int16_t (*sht_presence_online_fn)(void* user_data,
+                                          sht_handle_t* handle,
+                                          uint32_t serial, uint8_t replaced);
+
+typedef struct _sht_presence {
+    sht_handle_t* handles;
+    sht_presence_entry_t* entries; /* one per handle */
+    uint16_t num_handles;
+    uint16_t cursor; /* first handle checked by the next poll */
+    uint8_t quarantine_after;
+    uint32_t min_backoff_ms;
+    uint32_t max_backoff_ms;
+    sht_presence_online_fn on_online;
+    void* user_data;
+    uint32_t quarantines;  /* handles taken offline */
+    uint32_t probes;       /* probes performed */
+    uint32_t onlines;      /* handles brought online */
+    uint32_t replacements; /* onlines with a changed serial number */
+} sht_presence_t;
+
+/**
+ * @brief Initialize the presence manager with all handles quarantined and
+ * due for a probe
+ *
+ * @param[out] presence         the presence manager
+ * @param[in]  handles          the sensors
+ * @param[in]  entries          storage for num_handles entries
+ * @param[in]  num_handles      the number of sensors
+ * @param[in]  quarantine_after the consecutive failures quarantining a handle,
+ *                              at least 1
+ * @param[in]  min_backoff_ms   the delay before the first re-probe
+ * @param[in]  max_backoff_ms   the upper bound of the re-probe delay
+ * @param[in]  on_online        the configuration callback, or NULL
+ * @param[in]  user_data        passed to on_online
+ * @param[in]  now_ms           the current time
+ *
+ * @return 0 on success, STATUS_ERR_INVALID_PARAMS on an invalid
+ * configuration
+ */
+int16_t sht_presence_init(sht_presence_t* presence, sht_handle_t* handles,
+                          sht_presence_entry_t* entries, uint16_t num_handles,
+                          uint8_t quarantine_after, uint32_t min_backoff_ms,
+                          uint32_t max_backoff_ms,
+                          sht_presence_online_fn on_online, void* user_data,
+                          uint32_t now_ms);
+
+/**
+ * @brief Record the outcome of a transaction with an online sensor
+ *
+ * @param[in] presence the presence manager
+ * @param[in] index    the index of the handle
+ * @param[in] ret      the return code of the transaction
+ * @param[in] now_ms   the current time
+ */
+void sht_presence_report(sht_presence_t* presence, uint16_t index,
+                         int16_t ret, uint32_t now_ms);
+
+/**
+ * @brief Record the outcome of a sweep, e.g. from sht_mux_sweep_collect()
+ *
+ * @param[in] presence the presence manager
+ * @param[in] order    the swept handle indices
+ * @param[in] samples  the samples, in sweep order
+ * @param[in] count    the number of swept handles
+ * @param[in] now_ms   the current time
+ */
+void sht_presence_report_samples(sht_presence_t* presence,
+                                 const uint16_t* order,
+                                 const sht_raw_sample_t* samples,
+                                 uint16_t count, uint32_t now_ms);
+
+/**
+ * @brief Return whether a handle is online
+ *
+ * @param[in] presence the presence manager
+ * @param[in] index    the index of the handle
+ *
+ * @return 1 if online, else 0
+ */
+uint8_t sht_presence_is_online(const sht_presence_t* presence,
+                               uint16_t index);
+
+/**
+ * @brief Copy the online handles of a sweep order, keeping their order
+ *
+ * @param[in]  presence the presence manager
+ * @param[in]  order    the sweep order, e.g. from sht_mux_plan()
+ * @param[in]  count    the number of indices in order
+ * @param[out] online   storage for up to count indices, may equal order
+ *
+ * @return the number of online handles
+ */
+uint16_t sht_presence_filter(const sht_presence_t* presence,
+                             const uint16_t* order, uint16_t count,
+                             uint16_t* online);
+
+/**
+ * @brief Probe the most overdue quarantined handle whose probe fits the idle
+ * gap; the on_online callback is not included in the probe time
+ *
+ * @param[in] presence  the presence manager
+ * @param[in] now_ms    the current time
+ * @param[in] idle_usec the time the bus stays idle
+ *
+ * @return the index of the handle brought online, num_handles if none was
+ */
+uint16_t sht_presence_poll(sht_presence_t* presence, uint32_t now_ms,
+                           uint32_t idle_usec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_PRESENCE_H */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Statically sized sensor registry implementation
+ */
+
+#include "sht_registry.h"
+
+#include <stddef.h>
+
+int16_t sht_registry_add(sht_registry_t* reg, const sht_handle_t* handle,
+                         uint8_t filter_shift, uint16_t* index) {
+    sht_registry_entry_t* e;
+
+    if (reg->num_sensors == reg->capacity)
+        return STATUS_ERR_NO_SPACE;
+
+    e = &reg->entries[reg->num_sensors];
+    e->handle = *handle;
+    e->handle.id = reg->num_sensors;
+    e->sched.timer.pprev = NULL;
+    e->filter.shift = filter_shift;
+    e->filter.primed = 0;
+    e->head = 0;
+    e->count = 0;
+    if (index)
+        *index = reg->num_sensors;
+    reg->num_sensors++;
+    return STATUS_OK;
+}
+
+void sht_registry_start(sht_registry_t* reg, sht_wheel_t* wheel,
+                        uint32_t period_ticks, uint32_t retry_ticks,
+                        uint8_t max_retries, uint32_t first_tick) {
+    sht_registry_entry_t* e;
+    uint32_t i = 0;
+
+    SHT_REGISTRY_FOR_EACH(reg, e) {
+        sht_wheel_sensor_start(
+            wheel, &e->sched, &e->handle, period_ticks, retry_ticks,
+            max_retries, first_tick + i++ * period_ticks / reg->num_sensors);
+    }
+}
+
+int16_t sht_registry_push(sht_registry_t* reg,
+                          const sht_raw_sample_t* sample) {
+    sht_registry_entry_t* e;
+    sht_registry_filter_t* f;
+    int32_t temperature;
+    int32_t humidity;
+
+    if (sample->sensor_id >= reg->num_sensors)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    e = &reg->entries[sample->sensor_id];
+    reg->samples[(uint32_t)sample->sensor_id * reg->depth +
+                 (e->head + e->count) % reg->depth] = *sample;
+    if (e->count < reg->depth)
+        e->count++;
+    else
+        e->head = (uint16_t)((e->head + 1) % reg->depth);
+
+    if (sample->status != STATUS_OK)
+        return STATUS_OK;
+    f = &e->filter;
+    sht_raw_sample_convert(sample, &temperature, &humidity);
+    if (!f->primed) {
+        f->temperature = temperature;
+        f->humidity = humidity;
+        f->primed = 1;
+    } else {
+        /* arithmetic shift, rounding towards negative infinity */
+        f->temperature += (temperature - f->temperature) >> f->shift;
+        f->humidity += (humidity - f->humidity) >> f->shift;
+    }
+    return STATUS_OK;
+}
+
+void sht_registry_on_sample(void* reg, const sht_raw_sample_t* sample) {
+    sht_registry_push((sht_registry_t*)reg, sample);
+}
+
+const sht_raw_sample_t* sht_registry_sample(const sht_registry_t* reg,
+                                            uint16_t index, uint16_t age) {
+    const sht_registry_entry_t* e;
+
+    if (index >= reg->num_sensors)
+        return NULL;
+    e = &reg->entries[index];
+    if (age >= e->count)
+        return NULL;
+    return &reg->samples[(uint32_t)index * reg->depth +
+                         (e->head + e->count - 1 - age) % reg->depth];
+}
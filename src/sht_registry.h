@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Statically sized sensor registry
+ *
+ * The registry keeps everything the application holds per sensor in one
+ * contiguous array of entries: the handle, the timing wheel schedule, an
+ * exponential moving average filter and the position of a ring of recent
+ * samples. The sample rings of all sensors share one array next to the
+ * entries.
+ *
+ * Storage is defined at compile time, either with SHT_REGISTRY_DEFINE() in C
+ * or with the sht_static_registry class template in C++11; nothing is
+ * allocated at runtime. The storage is a single object whose exact size shows
+ * in the linker map, and iterating the sensors with SHT_REGISTRY_FOR_EACH()
+ * walks the entry array without following pointers.
+ *
+ * A sensor's id is its index in the registry, so samples are routed to their
+ * entry without a lookup. sht_registry_on_sample() has the signature of a
+ * sht_wheel_sample_fn and can be passed to sht_wheel_run_sensors() directly.
+ */
+
+#ifndef SHT_REGISTRY_H
+#define SHT_REGISTRY_H
+
+#include "sht_wheel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Exponential moving average of the converted values
+ */
+typedef struct _sht_registry_filter {
+    int32_t temperature; /* milli degree Celsius */
+    int32_t humidity;    /* milli percent */
+    uint8_t shift;       /* weight of a new sample is 2^-shift */
+    uint8_t primed;      /* a sample was filtered */
+} sht_registry_filter_t;
+
+/**
+ * @brief Per-sensor state
+ */
+typedef struct _sht_registry_entry {
+    sht_wheel_sensor_t sched;
+    sht_handle_t handle;
+    sht_registry_filter_t filter;
+    uint16_t head;  /* oldest sample of the ring */
+    uint16_t count; /* samples in the ring */
+} sht_registry_entry_t;
+
+typedef struct _sht_registry {
+    sht_registry_entry_t* entries;
+    sht_raw_sample_t* samples; /* depth samples per entry */
+    uint16_t num_sensors;
+    uint16_t capacity;
+    uint16_t depth;
+} sht_registry_t;
+
+/**
+ * @brief Storage of a registry for num_sensors sensors with depth samples
+ * each
+ */
+#define SHT_REGISTRY_STORAGE(num_sensors, depth)           \
+    struct {                                               \
+        sht_registry_entry_t entries[num_sensors];         \
+        sht_raw_sample_t samples[(num_sensors) * (depth)]; \
+    }
+
+/**
+ * @brief Define a registry named name with static storage
+ */
+#define SHT_REGISTRY_DEFINE(name, num_sensors, depth)                       \
+    static SHT_REGISTRY_STORAGE(num_sensors, depth) name##_storage;         \
+    static sht_registry_t name = {name##_storage.entries,                   \
+                                  name##_storage.samples, 0, (num_sensors), \
+                                  (depth)}
+
+/**
+ * @brief Iterate over the entries of the registered sensors
+ */
+#define SHT_REGISTRY_FOR_EACH(reg, entry) \
+    for ((entry) = (reg)->entries;        \
+         (entry) < (reg)->entries + (reg)->num_sensors; ++(entry))
+
+/**
+ * @brief Register a sensor. The handle is copied into the entry and its id is
+ * set to the entry index.
+ *
+ * @param[in]  reg          the registry
+ * @param[in]  handle       the sensor
+ * @param[in]  filter_shift the filter weight of a new sample is 2^-shift,
+ *                          0 to disable filtering
+ * @param[out] index        the entry index, may be NULL
+ *
+ * @return 0 on success, STATUS_ERR_NO_SPACE if the registry is full
+ */
+int16_t sht_registry_add(sht_registry_t* reg, const sht_handle_t* handle,
+                         uint8_t filter_shift, uint16_t* index);
+
+/**
+ * @brief Start the schedules of all sensors on a timing wheel, with the first
+ * measurements spread evenly over one period
+ *
+ * @param[in] reg          the registry
+ * @param[in] wheel        the wheel
+ * @param[in] period_ticks the sampling period
+ * @param[in] retry_ticks  the delay before retrying a failed transaction
+ * @param[in] max_retries  the retries per period
+ * @param[in] first_tick   the tick of the first measurement
+ */
+void sht_registry_start(sht_registry_t* reg, sht_wheel_t* wheel,
+                        uint32_t period_ticks, uint32_t retry_ticks,
+                        uint8_t max_retries, uint32_t first_tick);
+
+/**
+ * @brief Store a sample in the ring of its sensor, dropping the oldest one if
+ * the ring is full, and update the filter if the read succeeded
+ *
+ * @param[in] reg    the registry
+ * @param[in] sample the sample
+ *
+ * @return 0 on success, STATUS_ERR_INVALID_PARAMS for an unknown sensor id
+ */
+int16_t sht_registry_push(sht_registry_t* reg, const sht_raw_sample_t* sample);
+
+/**
+ * @brief sht_wheel_sample_fn storing the samples into a registry
+ *
+ * @param[in] reg    the sht_registry_t
+ * @param[in] sample the sample
+ */
+void sht_registry_on_sample(void* reg, const sht_raw_sample_t* sample);
+
+/**
+ * @brief Return a stored sample of a sensor
+ *
+ * @param[in] reg   the registry
+ * @param[in] index the entry index
+ * @param[in] age   0 for the newest sample, 1 for the one before, ...
+ *
+ * @return the sample, NULL if fewer samples are stored
+ */
+const sht_raw_sample_t* sht_registry_sample(const sht_registry_t* reg,
+                                            uint16_t index, uint16_t age);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+/**
+ * @brief Registry storage sized by template parameters, e.g.
+ *
+ *     static sht_static_registry<8, 16> sensors;
+ *     sht_registry_add(&sensors.registry, &handle, 3, NULL);
+ */
+template <uint16_t NumSensors, uint16_t Depth> struct sht_static_registry {
+    static_assert(NumSensors > 0 && Depth > 0, "empty registry");
+
+    sht_registry_entry_t entries[NumSensors];
+    sht_raw_sample_t samples[NumSensors * Depth];
+    sht_registry_t registry;
+
+    sht_static_registry()
+        : registry{entries, samples, 0, NumSensors, Depth} {
+    }
+    sht_static_registry(const sht_static_registry&) = delete;
+    sht_static_registry& operator=(const sht_static_registry&) = delete;
+};
+#endif
+
+#endif /* SHT_REGISTRY_H */
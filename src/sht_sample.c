@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Raw sample record implementation
+ */
+
+#include "sht_sample.h"
+
+void sht_raw_sample_convert(const sht_raw_sample_t* sample,
+                            int32_t* temperature, int32_t* humidity) {
+    /**
+     * formulas for conversion of the sensor signals, optimized for fixed point
+     * algebra:
+     * Temperature = 175 * S_T / 2^16 - 45
+     * Relative Humidity = 100 * S_RH / 2^16 (SHT3x, SHTC1)
+     * Relative Humidity = 125 * S_RH / 2^16 - 6 (SHT4x)
+     */
+    *temperature = ((21875 * (int32_t)sample->t_ticks) >> 13) - 45000;
+    if (sample->family == SHT_FAMILY_SHT4X)
+        *humidity = ((15625 * (int32_t)sample->rh_ticks) >> 13) - 6000;
+    else
+        *humidity = ((12500 * (int32_t)sample->rh_ticks) >> 13);
+}
+
+/* round(value * 2^13 / scale), clamped to the tick range */
+static uint16_t sht_raw_sample_ticks(int32_t value, int32_t scale) {
+    int64_t ticks;
+
+    if (value <= 0)
+        return 0;
+    ticks = ((int64_t)value * 8192 + scale / 2) / scale;
+    return ticks > UINT16_MAX ? UINT16_MAX : (uint16_t)ticks;
+}
+
+void sht_raw_sample_set_values(sht_raw_sample_t* sample, int32_t temperature,
+                               int32_t humidity) {
+    sample->t_ticks = sht_raw_sample_ticks(temperature + 45000, 21875);
+    if (sample->family == SHT_FAMILY_SHT4X)
+        sample->rh_ticks = sht_raw_sample_ticks(humidity + 6000, 15625);
+    else
+        sample->rh_ticks = sht_raw_sample_ticks(humidity, 12500);
+}
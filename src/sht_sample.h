@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Raw sample record shared by the processing modules
+ *
+ * A raw sample carries the unconverted sensor ticks together with the
+ * bookkeeping needed to route it through the processing pipeline (sensor id,
+ * bus, sequence number, timestamp and read status). Conversion to physical
+ * units is deferred until the sample is processed.
+ */
+
+#ifndef SHT_SAMPLE_H
+#define SHT_SAMPLE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_BAD_DATA (-1)
+#define STATUS_CRC_FAIL (-2)
+#define STATUS_UNKNOWN_DEVICE (-3)
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NO_SPACE (-5)
+
+/**
+ * @brief Sensor family, selects the command set and the conversion formulas
+ */
+typedef enum _sht_family {
+    SHT_FAMILY_SHT3X,
+    SHT_FAMILY_SHT4X,
+    SHT_FAMILY_SHTC1
+} sht_family_t;
+
+/**
+ * @brief Unconverted measurement of one sensor
+ */
+typedef struct _sht_raw_sample {
+    uint32_t timestamp_ms; /* time the read completed */
+    uint16_t sensor_id;    /* application defined sensor index */
+    uint16_t seq;          /* per-sensor sequence number */
+    uint16_t t_ticks;      /* temperature ADC ticks */
+    uint16_t rh_ticks;     /* humidity ADC ticks */
+    int16_t status;        /* return code of the read */
+    uint8_t bus;           /* bus the sensor is attached to */
+    uint8_t family;        /* sht_family_t */
+} sht_raw_sample_t;
+
+/**
+ * @brief Converts the ticks of a raw sample using the formulas of its family.
+ * Temperature is returned in [degree Celsius], multiplied by 1000,
+ * and relative humidity in [percent relative humidity], multiplied by 1000.
+ *
+ * @param[in]  sample      the raw sample
+ * @param[out] temperature the address for the temperature
+ * @param[out] humidity    the address for the relative humidity
+ */
+void sht_raw_sample_convert(const sht_raw_sample_t* sample,
+                            int32_t* temperature, int32_t* humidity);
+
+/**
+ * @brief Sets the ticks of a raw sample from converted values, the inverse of
+ * sht_raw_sample_convert() for the family of the sample, e.g. to feed values
+ * from another source into the processing pipeline. Values out of the sensor
+ * range are clamped.
+ *
+ * @param[in,out] sample      the raw sample, its family must be set
+ * @param[in]     temperature the temperature, multiplied by 1000
+ * @param[in]     humidity    the relative humidity, multiplied by 1000
+ */
+void sht_raw_sample_set_values(sht_raw_sample_t* sample, int32_t temperature,
+                               int32_t humidity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_SAMPLE_H */
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bit-banged I2C master implementation
+ */
+
+#include "sht_softi2c.h"
+
+#include <stddef.h>
+
+#ifdef SHT_SOFTI2C_HAL
+#include "sensirion_i2c.h"
+#endif
+
+/* GPIO access and timing of one byte, loaded once per byte */
+typedef struct _sht_softi2c_io {
+    const sht_softi2c_gpio_t* gpio;
+    void* ctx;
+    uint16_t half;
+    uint8_t scl;
+    uint8_t sda;
+    uint8_t emulate;
+} sht_softi2c_io_t;
+
+static void sht_softi2c_load(const sht_softi2c_t* i2c, sht_softi2c_io_t* io) {
+    io->gpio = i2c->gpio;
+    io->ctx = i2c->ctx;
+    io->half = i2c->half_period_usec;
+    io->scl = i2c->scl_pin;
+    io->sda = i2c->sda_pin;
+    io->emulate = i2c->flags & SHT_SOFTI2C_FLAG_EMULATE_OPEN_DRAIN;
+}
+
+static void sht_softi2c_line(const sht_softi2c_io_t* io, uint8_t pin,
+                             uint8_t level) {
+    if (io->emulate)
+        io->gpio->direction(io->ctx, pin, !level);
+    else
+        io->gpio->write(io->ctx, pin, level);
+}
+
+#define SHT_SOFTI2C_SCL(io, level) sht_softi2c_line(io, (io)->scl, level)
+#define SHT_SOFTI2C_SDA(io, level) sht_softi2c_line(io, (io)->sda, level)
+#define SHT_SOFTI2C_DELAY(io) (io)->gpio->delay_usec((io)->ctx, (io)->half)
+
+/* release SCL and wait while a slave stretches the clock, charging the wait
+ * to the budget of the transaction */
+static int16_t sht_softi2c_scl_release(sht_softi2c_t* i2c,
+                                       const sht_softi2c_io_t* io) {
+    uint32_t limit = i2c->stretch_timeout_usec;
+    uint32_t waited = 0;
+
+    SHT_SOFTI2C_SCL(io, 1);
+    if (i2c->flags & SHT_SOFTI2C_FLAG_NO_STRETCH)
+        return STATUS_OK;
+    if (i2c->budget_usec < limit)
+        limit = i2c->budget_usec;
+    while (!io->gpio->read(io->ctx, io->scl)) {
+        if (waited >= limit) {
+            i2c->budget_usec -= waited;
+            i2c->timeouts++;
+            return STATUS_ERR_TIMEOUT;
+        }
+        io->gpio->delay_usec(io->ctx, 1);
+        waited++;
+    }
+    i2c->budget_usec -= waited;
+    return STATUS_OK;
+}
+
+/* clock out the bit selected by mask, SCL is not read back */
+#define SHT_SOFTI2C_WRITE_BIT(io, byte, mask) \
+    do {                                      \
+        SHT_SOFTI2C_SDA(io, (byte) & (mask)); \
+        SHT_SOFTI2C_DELAY(io);                \
+        SHT_SOFTI2C_SCL(io, 1);               \
+        SHT_SOFTI2C_DELAY(io);                \
+        SHT_SOFTI2C_SCL(io, 0);               \
+    } while (0)
+
+/* clock in a bit into byte, SCL is not read back */
+#define SHT_SOFTI2C_READ_BIT(io, byte, mask)               \
+    do {                                                   \
+        SHT_SOFTI2C_DELAY(io);                             \
+        SHT_SOFTI2C_SCL(io, 1);                            \
+        if ((io)->gpio->read((io)->ctx, (io)->sda))        \
+            (byte) |= (mask);                              \
+        SHT_SOFTI2C_DELAY(io);                             \
+        SHT_SOFTI2C_SCL(io, 0);                            \
+    } while (0)
+
+static int16_t sht_softi2c_start(sht_softi2c_t* i2c) {
+    sht_softi2c_io_t io;
+    int16_t ret;
+
+    i2c->budget_usec = i2c->transaction_timeout_usec;
+    sht_softi2c_load(i2c, &io);
+    SHT_SOFTI2C_SDA(&io, 1);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    if (ret == STATUS_OK && !io.gpio->read(io.ctx, io.sda)) {
+        ret = sht_softi2c_bus_clear(i2c);
+        i2c->budget_usec = i2c->transaction_timeout_usec;
+    }
+    if (ret != STATUS_OK)
+        return ret;
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SDA(&io, 0);
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+    return STATUS_OK;
+}
+
+static void sht_softi2c_stop(sht_softi2c_t* i2c) {
+    sht_softi2c_io_t io;
+
+    sht_softi2c_load(i2c, &io);
+    SHT_SOFTI2C_SDA(&io, 0);
+    SHT_SOFTI2C_DELAY(&io);
+    (void)sht_softi2c_scl_release(i2c, &io);
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SDA(&io, 1);
+    SHT_SOFTI2C_DELAY(&io);
+}
+
+static int16_t sht_softi2c_write_byte(sht_softi2c_t* i2c, uint8_t byte) {
+    sht_softi2c_io_t io;
+    uint8_t nack;
+    int16_t ret;
+
+    sht_softi2c_load(i2c, &io);
+
+    /* the first bit may be stretched by the slave */
+    SHT_SOFTI2C_SDA(&io, byte & 0x80);
+    SHT_SOFTI2C_DELAY(&io);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    if (ret != STATUS_OK)
+        return ret;
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x40);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x20);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x10);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x08);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x04);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x02);
+    SHT_SOFTI2C_WRITE_BIT(&io, byte, 0x01);
+
+    /* acknowledge */
+    SHT_SOFTI2C_SDA(&io, 1);
+    SHT_SOFTI2C_DELAY(&io);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    if (ret != STATUS_OK)
+        return ret;
+    nack = io.gpio->read(io.ctx, io.sda);
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+
+    if (nack) {
+        i2c->nacks++;
+        return STATUS_ERR_NACK;
+    }
+    return STATUS_OK;
+}
+
+static int16_t sht_softi2c_read_byte(sht_softi2c_t* i2c, uint8_t* data,
+                                     uint8_t ack) {
+    sht_softi2c_io_t io;
+    uint8_t byte = 0;
+    int16_t ret;
+
+    sht_softi2c_load(i2c, &io);
+    SHT_SOFTI2C_SDA(&io, 1);
+
+    /* the first bit may be stretched by the slave */
+    SHT_SOFTI2C_DELAY(&io);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    if (ret != STATUS_OK)
+        return ret;
+    if (io.gpio->read(io.ctx, io.sda))
+        byte |= 0x80;
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x40);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x20);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x10);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x08);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x04);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x02);
+    SHT_SOFTI2C_READ_BIT(&io, byte, 0x01);
+
+    /* acknowledge all but the last byte */
+    SHT_SOFTI2C_SDA(&io, !ack);
+    SHT_SOFTI2C_DELAY(&io);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+    SHT_SOFTI2C_SDA(&io, 1);
+
+    *data = byte;
+    return ret;
+}
+
+void sht_softi2c_init(sht_softi2c_t* i2c, const sht_softi2c_gpio_t* gpio,
+                      void* ctx, uint8_t scl_pin, uint8_t sda_pin,
+                      uint16_t clock_khz, uint8_t flags) {
+    i2c->gpio = gpio;
+    i2c->ctx = ctx;
+    i2c->scl_pin = scl_pin;
+    i2c->sda_pin = sda_pin;
+    i2c->flags = flags;
+    i2c->stretch_timeout_usec = SHT_SOFTI2C_STRETCH_TIMEOUT_USEC;
+    i2c->transaction_timeout_usec = SHT_SOFTI2C_TRANSACTION_TIMEOUT_USEC;
+    i2c->budget_usec = 0;
+    i2c->nacks = 0;
+    i2c->timeouts = 0;
+    i2c->bus_clears = 0;
+    (void)sht_softi2c_set_clock(i2c, clock_khz);
+
+    if (flags & SHT_SOFTI2C_FLAG_EMULATE_OPEN_DRAIN) {
+        gpio->direction(ctx, scl_pin, 0);
+        gpio->direction(ctx, sda_pin, 0);
+        gpio->write(ctx, scl_pin, 0);
+        gpio->write(ctx, sda_pin, 0);
+    } else {
+        gpio->write(ctx, scl_pin, 1);
+        gpio->write(ctx, sda_pin, 1);
+    }
+}
+
+int16_t sht_softi2c_set_clock(sht_softi2c_t* i2c, uint16_t clock_khz) {
+    if (!clock_khz)
+        return STATUS_ERR_INVALID_PARAMS;
+    i2c->half_period_usec = (uint16_t)((500 + clock_khz - 1) / clock_khz);
+    return STATUS_OK;
+}
+
+void sht_softi2c_set_timeouts(sht_softi2c_t* i2c,
+                              uint16_t stretch_timeout_usec,
+                              uint32_t transaction_timeout_usec) {
+    i2c->stretch_timeout_usec = stretch_timeout_usec;
+    i2c->transaction_timeout_usec = transaction_timeout_usec;
+}
+
+int16_t sht_softi2c_bus_clear(sht_softi2c_t* i2c) {
+    sht_softi2c_io_t io;
+    uint8_t i;
+    int16_t ret;
+
+    i2c->bus_clears++;
+    /* the slave gets one stretch timeout to let go of SCL */
+    i2c->budget_usec = i2c->stretch_timeout_usec;
+    sht_softi2c_load(i2c, &io);
+    SHT_SOFTI2C_SDA(&io, 1);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    /* nine clocks with SDA released take a transmitting slave through an
+     * acknowledge slot, where the NACK ends its transfer; a receiving slave
+     * may still be acknowledging, give it another byte to let go */
+    for (i = 0; ret == STATUS_OK &&
+                (i < 9 || (i < 18 && !io.gpio->read(io.ctx, io.sda)));
+         ++i) {
+        SHT_SOFTI2C_DELAY(&io);
+        SHT_SOFTI2C_SCL(&io, 0);
+        SHT_SOFTI2C_DELAY(&io);
+        ret = sht_softi2c_scl_release(i2c, &io);
+    }
+    if (ret != STATUS_OK)
+        return ret;
+    if (!io.gpio->read(io.ctx, io.sda))
+        return STATUS_ERR_BUS_STUCK;
+
+    /* stop condition */
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SCL(&io, 0);
+    SHT_SOFTI2C_SDA(&io, 0);
+    SHT_SOFTI2C_DELAY(&io);
+    ret = sht_softi2c_scl_release(i2c, &io);
+    SHT_SOFTI2C_DELAY(&io);
+    SHT_SOFTI2C_SDA(&io, 1);
+    SHT_SOFTI2C_DELAY(&io);
+    return ret;
+}
+
+/* end a transaction; after a timeout the slave may be out of step */
+static int16_t sht_softi2c_finish(sht_softi2c_t* i2c, int16_t ret) {
+    if (ret == STATUS_ERR_TIMEOUT)
+        (void)sht_softi2c_bus_clear(i2c);
+    else
+        sht_softi2c_stop(i2c);
+    return ret;
+}
+
+int16_t sht_softi2c_write(sht_softi2c_t* i2c, uint8_t address,
+                          const uint8_t* data, uint16_t count) {
+    uint16_t i;
+    int16_t ret;
+
+    ret = sht_softi2c_start(i2c);
+    if (ret != STATUS_OK)
+        return ret;
+
+    ret = sht_softi2c_write_byte(i2c, (uint8_t)(address << 1));
+    for (i = 0; ret == STATUS_OK && i < count; ++i)
+        ret = sht_softi2c_write_byte(i2c, data[i]);
+
+    return sht_softi2c_finish(i2c, ret);
+}
+
+int16_t sht_softi2c_read(sht_softi2c_t* i2c, uint8_t address, uint8_t* data,
+                         uint16_t count) {
+    uint16_t i;
+    int16_t ret;
+
+    ret = sht_softi2c_start(i2c);
+    if (ret != STATUS_OK)
+        return ret;
+
+    ret = sht_softi2c_write_byte(i2c, (uint8_t)((address << 1) | 0x01));
+    for (i = 0; ret == STATUS_OK && i < count; ++i)
+        ret = sht_softi2c_read_byte(i2c, &data[i], i + 1 < count);
+
+    return sht_softi2c_finish(i2c, ret);
+}
+
+#ifdef SHT_SOFTI2C_HAL
+
+static sht_softi2c_t* sht_softi2c_hal_buses[SHT_SOFTI2C_MAX_BUSES];
+static uint8_t sht_softi2c_hal_bus = 0;
+
+void sht_softi2c_hal_register(uint8_t bus, sht_softi2c_t* i2c) {
+    if (bus < SHT_SOFTI2C_MAX_BUSES)
+        sht_softi2c_hal_buses[bus] = i2c;
+}
+
+int16_t sht_softi2c_hal_set_clock(void* user_data, uint8_t bus,
+                                  uint16_t clock_khz) {
+    (void)user_data;
+    if (bus >= SHT_SOFTI2C_MAX_BUSES || !sht_softi2c_hal_buses[bus])
+        return STATUS_ERR_INVALID_PARAMS;
+    return sht_softi2c_set_clock(sht_softi2c_hal_buses[bus], clock_khz);
+}
+
+int16_t sensirion_i2c_select_bus(uint8_t bus_idx) {
+    if (bus_idx >= SHT_SOFTI2C_MAX_BUSES || !sht_softi2c_hal_buses[bus_idx])
+        return STATUS_ERR_INVALID_PARAMS;
+    sht_softi2c_hal_bus = bus_idx;
+    return STATUS_OK;
+}
+
+void sensirion_i2c_init(void) {
+}
+
+void sensirion_i2c_release(void) {
+}
+
+int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count) {
+    sht_softi2c_t* i2c = sht_softi2c_hal_buses[sht_softi2c_hal_bus];
+
+    if (!i2c)
+        return STATUS_ERR_INVALID_PARAMS;
+    return (int8_t)sht_softi2c_read(i2c, address, data, count);
+}
+
+int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
+                           uint16_t count) {
+    sht_softi2c_t* i2c = sht_softi2c_hal_buses[sht_softi2c_hal_bus];
+
+    if (!i2c)
+        return STATUS_ERR_INVALID_PARAMS;
+    return (int8_t)sht_softi2c_write(i2c, address, data, count);
+}
+
+void sensirion_sleep_usec(uint32_t useconds) {
+    sht_softi2c_t* i2c = sht_softi2c_hal_buses[sht_softi2c_hal_bus];
+
+    if (!i2c)
+        return;
+    while (useconds > UINT16_MAX) {
+        i2c->gpio->delay_usec(i2c->ctx, UINT16_MAX);
+        useconds -= UINT16_MAX;
+    }
+    i2c->gpio->delay_usec(i2c->ctx, (uint16_t)useconds);
+}
+
+#endif /* SHT_SOFTI2C_HAL */
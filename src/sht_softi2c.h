@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bit-banged I2C master with pluggable GPIO access
+ *
+ * The master drives SCL and SDA through a small table of GPIO callbacks, so
+ * it runs on any board with two free pins. The byte loops are unrolled and
+ * the callbacks and pin numbers are loaded once per byte, which keeps the
+ * per-bit overhead to the GPIO accesses and the half period delays.
+ *
+ * Both lines are open drain: a level of 1 releases the line, 0 pulls it low.
+ * GPIOs without an open drain mode are supported with
+ * SHT_SOFTI2C_FLAG_EMULATE_OPEN_DRAIN: the output latch is kept low and a
+ * line is released by switching the pin to input, relying on the pull-ups.
+ *
+ * Clock stretching is detected on the first clock of every byte and on the
+ * acknowledge clock, which is where the sensors stretch: after releasing SCL
+ * the master polls it every microsecond until the slave releases it, up to
+ * the stretch timeout. The other clocks are not read back. Besides the
+ * per-clock limit, the stretching of a whole transaction is bounded by the
+ * transaction timeout, so a slave stretching every byte just below the
+ * stretch timeout cannot hold the bus for longer.
+ *
+ * A slave left behind by a timed out transaction may still drive SDA low. A
+ * timeout is therefore followed by a bus clear: nine clocks, more if the
+ * slave still holds SDA, then a stop condition resetting its state machine. A
+ * start condition finding SDA low clears the bus as well, so one misbehaving
+ * slave costs the transactions addressed to it, not those of its neighbours:
+ * at most the transaction timeout plus one stretch timeout for the clear.
+ *
+ * Defining SHT_SOFTI2C_HAL turns the module into the HAL of the library: the
+ * sensirion_i2c_* functions and sensirion_sleep_usec() are then implemented
+ * on top of the masters registered with sht_softi2c_hal_register(), one per
+ * bus index. It must not be defined together with another HAL.
+ */
+
+#ifndef SHT_SOFTI2C_H
+#define SHT_SOFTI2C_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_NACK (-7)
+#define STATUS_ERR_TIMEOUT (-8)
+#define STATUS_ERR_BUS_STUCK (-10)
+
+/**
+ * @brief Keep the output latches low and release the lines by switching the
+ * pins to input
+ */
+#define SHT_SOFTI2C_FLAG_EMULATE_OPEN_DRAIN 0x01U
+
+/**
+ * @brief Do not read SCL back, for buses without clock stretching devices
+ */
+#define SHT_SOFTI2C_FLAG_NO_STRETCH 0x02U
+
+/**
+ * @brief Default clock stretch timeout
+ */
+#ifndef SHT_SOFTI2C_STRETCH_TIMEOUT_USEC
+#define SHT_SOFTI2C_STRETCH_TIMEOUT_USEC 25000
+#endif
+
+/**
+ * @brief Default upper bound of the clock stretching of one transaction
+ */
+#ifndef SHT_SOFTI2C_TRANSACTION_TIMEOUT_USEC
+#define SHT_SOFTI2C_TRANSACTION_TIMEOUT_USEC 50000
+#endif
+
+/**
+ * @brief Number of buses of the HAL implementation
+ */
+#ifndef SHT_SOFTI2C_MAX_BUSES
+#define SHT_SOFTI2C_MAX_BUSES 4
+#endif
+
+/**
+ * @brief GPIO access of a bit-banged bus
+ */
+typedef struct _sht_softi2c_gpio {
+    /* set the output level of a pin, 1 releasing it in open drain mode */
+    void (*write)(void* ctx, uint8_t pin, uint8_t level);
+    /* switch a pin to output (1) or input (0), only used when emulating open
+     * drain, may be NULL otherwise */
+    void (*direction)(void* ctx, uint8_t pin, uint8_t output);
+    /* return the level of a line */
+    uint8_t (*read)(void* ctx, uint8_t pin);
+    /* busy wait, usec may be 0 */
+    void (*delay_usec)(void* ctx, uint16_t usec);
+} sht_softi2c_gpio_t;
+
+/**
+ * @brief One bit-banged bus
+ */
+typedef struct _sht_softi2c {
+    const sht_softi2c_gpio_t* gpio;
+    void* ctx; /* passed to the GPIO callbacks */
+    uint16_t half_period_usec;
+    uint16_t stretch_timeout_usec;
+    uint32_t transaction_timeout_usec;
+    uint32_t budget_usec; /* stretching left in the current transaction */
+    uint8_t scl_pin;
+    uint8_t sda_pin;
+    uint8_t flags; /* SHT_SOFTI2C_FLAG_* */
+    uint32_t nacks;
+    uint32_t timeouts;   /* clock stretches exceeding a timeout */
+    uint32_t bus_clears; /* bus clear sequences issued */
+} sht_softi2c_t;
+
+/**
+ * @brief Initialize a bus and release both lines
+ *
+ * @param[out] i2c       the bus
+ * @param[in]  gpio      the GPIO callbacks
+ * @param[in]  ctx       passed to the GPIO callbacks
+ * @param[in]  scl_pin   the SCL pin
+ * @param[in]  sda_pin   the SDA pin
+ * @param[in]  clock_khz the SCL frequency
+ * @param[in]  flags     SHT_SOFTI2C_FLAG_*
+ */
+void sht_softi2c_init(sht_softi2c_t* i2c, const sht_softi2c_gpio_t* gpio,
+                      void* ctx, uint8_t scl_pin, uint8_t sda_pin,
+                      uint16_t clock_khz, uint8_t flags);
+
+/**
+ * @brief Set the SCL frequency; the half period is rounded up to whole
+ * microseconds, so the effective clock may be lower
+ *
+ * @param[in] i2c       the bus
+ * @param[in] clock_khz the SCL frequency
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_softi2c_set_clock(sht_softi2c_t* i2c, uint16_t clock_khz);
+
+/**
+ * @brief Set the clock stretch timeouts
+ *
+ * @param[in] i2c                      the bus
+ * @param[in] stretch_timeout_usec     the upper bound of one stretch
+ * @param[in] transaction_timeout_usec the upper bound of all stretches of a
+ *                                     transaction
+ */
+void sht_softi2c_set_timeouts(sht_softi2c_t* i2c,
+                              uint16_t stretch_timeout_usec,
+                              uint32_t transaction_timeout_usec);
+
+/**
+ * @brief Free a bus held by a slave: clock nine times, up to nine more while
+ * the slave holds SDA, then issue a stop condition
+ *
+ * @param[in] i2c the bus
+ *
+ * @return 0 on success, STATUS_ERR_TIMEOUT if SCL is held low,
+ * STATUS_ERR_BUS_STUCK if SDA is still held low
+ */
+int16_t sht_softi2c_bus_clear(sht_softi2c_t* i2c);
+
+/**
+ * @brief Write bytes to a device
+ *
+ * @param[in] i2c     the bus
+ * @param[in] address the 7-bit address
+ * @param[in] data    the bytes
+ * @param[in] count   the number of bytes
+ *
+ * @return 0 on success, STATUS_ERR_NACK if a byte was not acknowledged,
+ * STATUS_ERR_TIMEOUT if a clock stretch timed out, STATUS_ERR_BUS_STUCK if
+ * SDA is held low
+ */
+int16_t sht_softi2c_write(sht_softi2c_t* i2c, uint8_t address,
+                          const uint8_t* data, uint16_t count);
+
+/**
+ * @brief Read bytes from a device
+ *
+ * @param[in]  i2c     the bus
+ * @param[in]  address the 7-bit address
+ * @param[out] data    the address for the bytes
+ * @param[in]  count   the number of bytes
+ *
+ * @return 0 on success, STATUS_ERR_NACK if the address was not acknowledged,
+ * STATUS_ERR_TIMEOUT if a clock stretch timed out, STATUS_ERR_BUS_STUCK if
+ * SDA is held low
+ */
+int16_t sht_softi2c_read(sht_softi2c_t* i2c, uint8_t address, uint8_t* data,
+                         uint16_t count);
+
+#ifdef SHT_SOFTI2C_HAL
+/**
+ * @brief Make a bus available to the HAL under a bus index
+ *
+ * @param[in] bus the bus index, below SHT_SOFTI2C_MAX_BUSES
+ * @param[in] i2c the bus
+ */
+void sht_softi2c_hal_register(uint8_t bus, sht_softi2c_t* i2c);
+
+/**
+ * @brief Clock callback for sht_clock_set_backend(), user_data is unused
+ */
+int16_t sht_softi2c_hal_set_clock(void* user_data, uint8_t bus,
+                                  uint16_t clock_khz);
+#endif /* SHT_SOFTI2C_HAL */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_SOFTI2C_H */
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Linux hwmon and IIO sysfs backend implementation
+ */
+
+#ifdef __linux__
+
+/* readlink(), pread(), realpath() */
+#define _DEFAULT_SOURCE
+
+#include "sht_sysfs.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* enough for any attribute value */
+#define SHT_SYSFS_VALUE_SIZE 32
+
+static const char* const SHT_SYSFS_DRIVER_NAMES[] = {"sht3x", "sht4x",
+                                                     "shtc1"};
+
+/* read a whole attribute from an open file, without the trailing newline */
+static int16_t sht_sysfs_pread(int fd, char* buf) {
+    ssize_t n = pread(fd, buf, SHT_SYSFS_VALUE_SIZE - 1, 0);
+
+    if (n <= 0)
+        return STATUS_ERR_IO;
+    while (n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == ' '))
+        n--;
+    buf[n] = '\0';
+    return STATUS_OK;
+}
+
+static int16_t sht_sysfs_read_file(const char* dir, const char* attr,
+                                   char* buf) {
+    char path[SHT_SYSFS_PATH_MAX];
+    int16_t ret;
+    int fd;
+
+    if (snprintf(path, sizeof(path), "%s/%s", dir, attr) >= (int)sizeof(path))
+        return STATUS_ERR_INVALID_PARAMS;
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return STATUS_ERR_IO;
+    ret = sht_sysfs_pread(fd, buf);
+    close(fd);
+    return ret;
+}
+
+static int sht_sysfs_open_attr(const char* dir, const char* attr) {
+    char path[SHT_SYSFS_PATH_MAX];
+
+    if (snprintf(path, sizeof(path), "%s/%s", dir, attr) >= (int)sizeof(path))
+        return -1;
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+/* optional IIO scale or offset attribute */
+static double sht_sysfs_read_double(const char* dir, const char* attr,
+                                    double fallback) {
+    char buf[SHT_SYSFS_VALUE_SIZE];
+    char* end;
+    double v;
+
+    if (sht_sysfs_read_file(dir, attr, buf) != STATUS_OK)
+        return fallback;
+    v = strtod(buf, &end);
+    return end == buf ? fallback : v;
+}
+
+/* find the "<bus>-<addr>" component of the resolved device path, which the
+ * I2C core uses to name client devices */
+static uint8_t sht_sysfs_location_matches(const char* dir, int i2c_bus,
+                                          uint8_t addr) {
+    char resolved[PATH_MAX];
+    char* component;
+    unsigned int bus;
+    unsigned int a;
+    char tail;
+
+    if (i2c_bus < 0 && !addr)
+        return 1;
+    if (!realpath(dir, resolved))
+        return 0;
+
+    while ((component = strrchr(resolved, '/')) != NULL) {
+        if (sscanf(component + 1, "%u-%4x%c", &bus, &a, &tail) == 2)
+            return (i2c_bus < 0 || bus == (unsigned int)i2c_bus) &&
+                   (!addr || a == addr);
+        *component = '\0';
+    }
+    return 0;
+}
+
+/* search class_dir for a device named name at the given location */
+static int16_t sht_sysfs_find(const char* class_dir, const char* name,
+                              int i2c_bus, uint8_t addr, char* found) {
+    char buf[SHT_SYSFS_VALUE_SIZE];
+    struct dirent* entry;
+    DIR* d = opendir(class_dir);
+    int16_t ret = STATUS_UNKNOWN_DEVICE;
+
+    if (!d)
+        return STATUS_UNKNOWN_DEVICE;
+    while ((entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.')
+            continue;
+        if (snprintf(found, SHT_SYSFS_PATH_MAX, "%s/%s", class_dir,
+                     entry->d_name) >= SHT_SYSFS_PATH_MAX)
+            continue;
+        if (sht_sysfs_read_file(found, "name", buf) != STATUS_OK ||
+            strcmp(buf, name) != 0)
+            continue;
+        if (sht_sysfs_location_matches(found, i2c_bus, addr)) {
+            ret = STATUS_OK;
+            break;
+        }
+    }
+    closedir(d);
+    return ret;
+}
+
+static int16_t sht_sysfs_read_value(int fd, uint8_t iio, double scale,
+                                    double offset, int32_t* value) {
+    char buf[SHT_SYSFS_VALUE_SIZE];
+    char* end;
+    long raw;
+    int16_t ret = sht_sysfs_pread(fd, buf);
+
+    if (ret != STATUS_OK)
+        return ret;
+    raw = strtol(buf, &end, 10);
+    if (end == buf)
+        return STATUS_ERR_BAD_DATA;
+    /* IIO reports milli degree Celsius and milli percent after scaling */
+    *value = iio ? (int32_t)((raw + offset) * scale) : (int32_t)raw;
+    return STATUS_OK;
+}
+
+int16_t sht_sysfs_open(sht_sysfs_dev_t* dev, const char* root, uint8_t family,
+                       int i2c_bus, uint8_t addr) {
+    char class_dir[SHT_SYSFS_PATH_MAX];
+    char dir[SHT_SYSFS_PATH_MAX];
+    const char* name;
+    int16_t ret;
+
+    dev->temperature_fd = -1;
+    dev->humidity_fd = -1;
+    if (family > SHT_FAMILY_SHTC1)
+        return STATUS_ERR_INVALID_PARAMS;
+    name = SHT_SYSFS_DRIVER_NAMES[family];
+    if (!root)
+        root = SHT_SYSFS_DEFAULT_ROOT;
+
+    snprintf(class_dir, sizeof(class_dir), "%s/class/hwmon", root);
+    ret = sht_sysfs_find(class_dir, name, i2c_bus, addr, dir);
+    if (ret == STATUS_OK) {
+        dev->iio = 0;
+        dev->temperature_fd = sht_sysfs_open_attr(dir, "temp1_input");
+        dev->humidity_fd = sht_sysfs_open_attr(dir, "humidity1_input");
+    } else {
+        snprintf(class_dir, sizeof(class_dir), "%s/bus/iio/devices", root);
+        ret = sht_sysfs_find(class_dir, name, i2c_bus, addr, dir);
+        if (ret != STATUS_OK)
+            return ret;
+        dev->iio = 1;
+        dev->temperature_fd = sht_sysfs_open_attr(dir, "in_temp_raw");
+        dev->humidity_fd = sht_sysfs_open_attr(dir, "in_humidityrelative_raw");
+        dev->temperature_scale = sht_sysfs_read_double(dir, "in_temp_scale", 1);
+        dev->temperature_offset =
+            sht_sysfs_read_double(dir, "in_temp_offset", 0);
+        dev->humidity_scale =
+            sht_sysfs_read_double(dir, "in_humidityrelative_scale", 1);
+        dev->humidity_offset =
+            sht_sysfs_read_double(dir, "in_humidityrelative_offset", 0);
+    }
+
+    if (dev->temperature_fd < 0 || dev->humidity_fd < 0) {
+        sht_sysfs_close(dev);
+        return STATUS_ERR_IO;
+    }
+    return STATUS_OK;
+}
+
+void sht_sysfs_close(sht_sysfs_dev_t* dev) {
+    if (dev->temperature_fd >= 0)
+        close(dev->temperature_fd);
+    if (dev->humidity_fd >= 0)
+        close(dev->humidity_fd);
+    dev->temperature_fd = -1;
+    dev->humidity_fd = -1;
+}
+
+int16_t sht_sysfs_read(const sht_sysfs_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity) {
+    int16_t ret;
+
+    ret = sht_sysfs_read_value(dev->temperature_fd, dev->iio,
+                               dev->temperature_scale, dev->temperature_offset,
+                               temperature);
+    if (ret != STATUS_OK)
+        return ret;
+    return sht_sysfs_read_value(dev->humidity_fd, dev->iio,
+                                dev->humidity_scale, dev->humidity_offset,
+                                humidity);
+}
+
+int16_t sht_sysfs_read_sample(const sht_sysfs_dev_t* dev,
+                              sht_handle_t* handle, uint32_t now_ms,
+                              sht_raw_sample_t* sample) {
+    int32_t temperature = 0;
+    int32_t humidity = 0;
+    int16_t ret = sht_sysfs_read(dev, &temperature, &humidity);
+
+    sample->timestamp_ms = now_ms;
+    sample->sensor_id = handle->id;
+    sample->seq = handle->seq++;
+    sample->status = ret;
+    sample->bus = handle->bus;
+    sample->family = handle->family;
+    if (ret == STATUS_OK) {
+        sht_raw_sample_set_values(sample, temperature, humidity);
+    } else {
+        sample->t_ticks = 0;
+        sample->rh_ticks = 0;
+    }
+    return ret;
+}
+
+#endif /* __linux__ */
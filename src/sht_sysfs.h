@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Linux hwmon and IIO sysfs backend
+ *
+ * On hosts where the kernel sht3x, sht4x or shtc1 driver is bound to a
+ * sensor, the library cannot talk to it through i2c-dev. This backend serves
+ * measurements from the sysfs attributes of the kernel driver instead, so
+ * applications built on raw samples run unchanged next to kernel managed
+ * sensors, and user space sampling can be compared with kernel sampling.
+ *
+ * A device is looked up by driver name and I2C location under a configurable
+ * sysfs root, first among the hwmon devices (temp1_input and humidity1_input,
+ * in milli units) and then among the IIO devices (in_temp_raw and
+ * in_humidityrelative_raw with their scale and offset). The attribute files
+ * are kept open and re-read with pread(), so a measurement costs two system
+ * calls per quantity. The SHT kernel drivers are hwmon drivers without IIO
+ * buffer support, so IIO devices are read through their raw attributes only.
+ *
+ * The backend is only built on Linux.
+ */
+
+#ifndef SHT_SYSFS_H
+#define SHT_SYSFS_H
+
+#ifdef __linux__
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_BAD_DATA (-1)
+#define STATUS_UNKNOWN_DEVICE (-3)
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_IO (-9)
+
+/**
+ * @brief sysfs mount point used when no root is given
+ */
+#ifndef SHT_SYSFS_DEFAULT_ROOT
+#define SHT_SYSFS_DEFAULT_ROOT "/sys"
+#endif
+
+/**
+ * @brief Maximum length of the paths built by the backend
+ */
+#ifndef SHT_SYSFS_PATH_MAX
+#define SHT_SYSFS_PATH_MAX 512
+#endif
+
+/**
+ * @brief An open kernel managed sensor
+ */
+typedef struct _sht_sysfs_dev {
+    int temperature_fd;
+    int humidity_fd;
+    uint8_t iio; /* the attributes are raw IIO values */
+    double temperature_scale;
+    double temperature_offset;
+    double humidity_scale;
+    double humidity_offset;
+} sht_sysfs_dev_t;
+
+/**
+ * @brief Open the kernel device of a sensor
+ *
+ * @param[out] dev     the device
+ * @param[in]  root    the sysfs mount point, NULL for SHT_SYSFS_DEFAULT_ROOT
+ * @param[in]  family  the sht_family_t, selecting the kernel driver name
+ * @param[in]  i2c_bus the I2C adapter number, negative for any
+ * @param[in]  addr    the 7-bit address, 0 for any
+ *
+ * @return 0 on success, STATUS_UNKNOWN_DEVICE if no matching device was
+ * found, else an error code
+ */
+int16_t sht_sysfs_open(sht_sysfs_dev_t* dev, const char* root, uint8_t family,
+                       int i2c_bus, uint8_t addr);
+
+/**
+ * @brief Close a device
+ *
+ * @param[in] dev the device
+ */
+void sht_sysfs_close(sht_sysfs_dev_t* dev);
+
+/**
+ * @brief Read a measurement from the kernel driver.
+ * Temperature is returned in [degree Celsius], multiplied by 1000,
+ * and relative humidity in [percent relative humidity], multiplied by 1000.
+ *
+ * @param[in]  dev         the device
+ * @param[out] temperature the address for the temperature
+ * @param[out] humidity    the address for the relative humidity
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_sysfs_read(const sht_sysfs_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity);
+
+/**
+ * @brief Read a measurement into a raw sample, as sht_handle_read_sample()
+ * does for sensors on i2c-dev
+ *
+ * @param[in]     dev    the device
+ * @param[in,out] handle the sensor, its sequence number is advanced
+ * @param[in]     now_ms the timestamp of the sample
+ * @param[out]    sample the sample, also filled in on error
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_sysfs_read_sample(const sht_sysfs_dev_t* dev,
+                              sht_handle_t* handle, uint32_t now_ms,
+                              sht_raw_sample_t* sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __linux__ */
+
+#endif /* SHT_SYSFS_H */
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Strong unit types for C++
+ *
+ * The C API passes temperatures, relative humidities and absolute humidities
+ * as plain integers in milli units. For C++ users this header wraps them in
+ * distinct types, so a humidity cannot be passed where a temperature is
+ * expected and Celsius cannot be mixed with Fahrenheit:
+ *
+ *     sht::milli_celsius t = sht::temperature_from_ticks(t_ticks);
+ *     sht::milli_fahrenheit f = sht::to_fahrenheit(t);
+ *
+ * The types hold a single integer and all operations are constexpr with the
+ * arithmetic of tick_to_temperature(), tick_to_humidity(),
+ * sensirion_celsius_to_fahrenheit() and sensirion_calc_absolute_humidity(),
+ * so they compile to the same code as the C functions and constant arguments
+ * are evaluated at compile time, e.g. alert thresholds:
+ *
+ *     using namespace sht::literals;
+ *     constexpr uint16_t limit = sht::temperature_to_ticks(60.0_degC);
+ *
+ * The header requires C++11 and is empty for C and older C++ standards.
+ */
+
+#ifndef SHT_UNITS_H
+#define SHT_UNITS_H
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+
+#include <stdint.h>
+
+namespace sht {
+
+/**
+ * @brief A value in a unit identified by Tag, stored as Rep
+ */
+template <typename Tag, typename Rep> class quantity {
+  public:
+    typedef Rep rep;
+
+    constexpr quantity() : value_(0) {
+    }
+    constexpr explicit quantity(Rep value) : value_(value) {
+    }
+    constexpr Rep value() const {
+        return value_;
+    }
+
+    friend constexpr bool operator==(quantity a, quantity b) {
+        return a.value_ == b.value_;
+    }
+    friend constexpr bool operator!=(quantity a, quantity b) {
+        return a.value_ != b.value_;
+    }
+    friend constexpr bool operator<(quantity a, quantity b) {
+        return a.value_ < b.value_;
+    }
+    friend constexpr bool operator<=(quantity a, quantity b) {
+        return a.value_ <= b.value_;
+    }
+    friend constexpr bool operator>(quantity a, quantity b) {
+        return a.value_ > b.value_;
+    }
+    friend constexpr bool operator>=(quantity a, quantity b) {
+        return a.value_ >= b.value_;
+    }
+    friend constexpr quantity operator+(quantity a, quantity b) {
+        return quantity(static_cast<Rep>(a.value_ + b.value_));
+    }
+    friend constexpr quantity operator-(quantity a, quantity b) {
+        return quantity(static_cast<Rep>(a.value_ - b.value_));
+    }
+
+  private:
+    Rep value_;
+};
+
+struct celsius_tag {};
+struct fahrenheit_tag {};
+struct relative_humidity_tag {};
+struct absolute_humidity_tag {};
+
+/* milli degree Celsius */
+typedef quantity<celsius_tag, int32_t> milli_celsius;
+/* milli degree Fahrenheit */
+typedef quantity<fahrenheit_tag, int32_t> milli_fahrenheit;
+/* milli percent relative humidity */
+typedef quantity<relative_humidity_tag, int32_t> milli_percent_rh;
+/* milligrams of water per cubic meter */
+typedef quantity<absolute_humidity_tag, uint32_t> mg_per_m3;
+
+/**
+ * @brief Temperature of a tick value, as tick_to_temperature()
+ */
+constexpr milli_celsius temperature_from_ticks(uint16_t tick) {
+    return milli_celsius(((21875 * static_cast<int32_t>(tick)) >> 13) - 45000);
+}
+
+/**
+ * @brief Relative humidity of an SHT3x or SHTC1 tick value, as
+ * tick_to_humidity()
+ */
+constexpr milli_percent_rh humidity_from_ticks(uint16_t tick) {
+    return milli_percent_rh((12500 * static_cast<int32_t>(tick)) >> 13);
+}
+
+/**
+ * @brief Relative humidity of an SHT4x tick value
+ */
+constexpr milli_percent_rh humidity_from_ticks_sht4x(uint16_t tick) {
+    return milli_percent_rh(((15625 * static_cast<int32_t>(tick)) >> 13) -
+                            6000);
+}
+
+/**
+ * @brief Tick value of a temperature, as temperature_to_tick()
+ */
+constexpr uint16_t temperature_to_ticks(milli_celsius t) {
+    return static_cast<uint16_t>((t.value() * 12271 + 552195000) >> 15);
+}
+
+/**
+ * @brief Tick value of an SHT3x relative humidity, as humidity_to_tick()
+ */
+constexpr uint16_t humidity_to_ticks(milli_percent_rh rh) {
+    return static_cast<uint16_t>((rh.value() * 21474) >> 15);
+}
+
+/**
+ * @brief As sensirion_celsius_to_fahrenheit()
+ */
+constexpr milli_fahrenheit to_fahrenheit(milli_celsius t) {
+    return milli_fahrenheit(((t.value() * 7373) >> 12) + 32000);
+}
+
+/**
+ * @brief As sensirion_fahrenheit_to_celsius()
+ */
+constexpr milli_celsius to_celsius(milli_fahrenheit t) {
+    return milli_celsius(((t.value() - 32000) * 569) >> 10);
+}
+
+namespace detail {
+
+/* the lookup table of sensirion_calc_absolute_humidity(): absolute humidity
+ * at 100 %RH from -20 to 70 degree Celsius in steps of 10 degrees */
+constexpr uint32_t ah_lut(uint32_t i) {
+    return i == 0   ? 1078
+           : i == 1 ? 2364
+           : i == 2 ? 4849
+           : i == 3 ? 9383
+           : i == 4 ? 17243
+           : i == 5 ? 30264
+           : i == 6 ? 50983
+           : i == 7 ? 82785
+           : i == 8 ? 130048
+                    : 198277;
+}
+
+constexpr uint32_t ah_step = 10000;
+
+constexpr uint32_t ah_interpolate(uint32_t i, uint32_t rem) {
+    return i >= 9     ? ah_lut(9)
+           : rem == 0 ? ah_lut(i)
+                      : ah_lut(i) + (ah_lut(i + 1) - ah_lut(i)) * rem / ah_step;
+}
+
+constexpr uint32_t ah_at(uint32_t t, int32_t rh) {
+    return ((ah_interpolate(t / ah_step, t % ah_step) >> 3) *
+            static_cast<uint32_t>(rh)) /
+           12500;
+}
+
+} // namespace detail
+
+/**
+ * @brief As sensirion_calc_absolute_humidity()
+ */
+constexpr mg_per_m3 absolute_humidity(milli_celsius t, milli_percent_rh rh) {
+    return mg_per_m3(
+        rh.value() <= 0
+            ? 0
+            : detail::ah_at(t.value() < -20000
+                                ? 0
+                                : static_cast<uint32_t>(t.value() + 20000),
+                            rh.value()));
+}
+
+namespace literals {
+
+constexpr milli_celsius operator"" _degC(long double v) {
+    return milli_celsius(static_cast<int32_t>(v * 1000 + (v < 0 ? -0.5 : 0.5)));
+}
+constexpr milli_celsius operator"" _degC(unsigned long long v) {
+    return milli_celsius(static_cast<int32_t>(v * 1000));
+}
+constexpr milli_fahrenheit operator"" _degF(long double v) {
+    return milli_fahrenheit(
+        static_cast<int32_t>(v * 1000 + (v < 0 ? -0.5 : 0.5)));
+}
+constexpr milli_fahrenheit operator"" _degF(unsigned long long v) {
+    return milli_fahrenheit(static_cast<int32_t>(v * 1000));
+}
+constexpr milli_percent_rh operator"" _pctRH(long double v) {
+    return milli_percent_rh(static_cast<int32_t>(v * 1000 + 0.5));
+}
+constexpr milli_percent_rh operator"" _pctRH(unsigned long long v) {
+    return milli_percent_rh(static_cast<int32_t>(v * 1000));
+}
+
+} // namespace literals
+
+} // namespace sht
+
+#endif /* __cplusplus >= 201103L */
+
+#endif /* SHT_UNITS_H */
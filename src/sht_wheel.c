@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Hierarchical timing wheel implementation
+ */
+
+#include "sht_wheel.h"
+#include "sht_clock.h"
+#include "sht_mux.h"
+
+#include <stddef.h>
+
+#define SHT_WHEEL_MASK (SHT_WHEEL_SLOTS - 1U)
+#define SHT_WHEEL_SLOT(tick, level) \
+    (((tick) >> ((level)*SHT_WHEEL_SLOT_BITS)) & SHT_WHEEL_MASK)
+
+typedef struct _sht_wheel_sensor_ctx {
+    sht_wheel_sample_fn fn;
+    void* user_data;
+} sht_wheel_sensor_ctx_t;
+
+static void sht_wheel_link(sht_wheel_t* wheel, sht_wheel_timer_t* timer) {
+    uint32_t delta = timer->expires - wheel->now;
+    sht_wheel_timer_t** head;
+    uint8_t level = 0;
+
+    if ((int32_t)delta < 0) {
+        timer->expires = wheel->now;
+        delta = 0;
+    } else if (delta > SHT_WHEEL_MAX_DELTA) {
+        timer->expires = wheel->now + SHT_WHEEL_MAX_DELTA;
+        delta = SHT_WHEEL_MAX_DELTA;
+    }
+    while (level + 1 < SHT_WHEEL_LEVELS &&
+           delta >= (1UL << ((level + 1) * SHT_WHEEL_SLOT_BITS)))
+        level++;
+
+    head = &wheel->slots[level][SHT_WHEEL_SLOT(timer->expires, level)];
+    timer->next = *head;
+    if (timer->next)
+        timer->next->pprev = &timer->next;
+    timer->pprev = head;
+    *head = timer;
+}
+
+/* re-insert the timers of a slot on the lower levels, returns the slot */
+static uint32_t sht_wheel_cascade(sht_wheel_t* wheel, uint8_t level) {
+    uint32_t slot = SHT_WHEEL_SLOT(wheel->now, level);
+    sht_wheel_timer_t* t = wheel->slots[level][slot];
+    sht_wheel_timer_t* next;
+
+    wheel->slots[level][slot] = NULL;
+    for (; t; t = next) {
+        next = t->next;
+        sht_wheel_link(wheel, t);
+    }
+    return slot;
+}
+
+void sht_wheel_init(sht_wheel_t* wheel, uint32_t now_tick, uint32_t tick_usec) {
+    uint8_t level;
+    uint32_t slot;
+
+    for (level = 0; level < SHT_WHEEL_LEVELS; ++level)
+        for (slot = 0; slot < SHT_WHEEL_SLOTS; ++slot)
+            wheel->slots[level][slot] = NULL;
+    wheel->now = now_tick;
+    wheel->tick_usec = tick_usec;
+}
+
+void sht_wheel_add(sht_wheel_t* wheel, sht_wheel_timer_t* timer,
+                   uint32_t expires, uint8_t event) {
+    sht_wheel_cancel(timer);
+    timer->expires = expires;
+    timer->event = event;
+    sht_wheel_link(wheel, timer);
+}
+
+void sht_wheel_cancel(sht_wheel_timer_t* timer) {
+    if (!timer->pprev)
+        return;
+
+    *timer->pprev = timer->next;
+    if (timer->next)
+        timer->next->pprev = timer->pprev;
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+uint32_t sht_wheel_advance(sht_wheel_t* wheel, uint32_t now_tick,
+                           sht_wheel_expire_fn fn, void* user_data) {
+    sht_wheel_timer_t* pending;
+    sht_wheel_timer_t* t;
+    uint32_t expired = 0;
+    uint32_t slot;
+    uint8_t level;
+
+    while ((int32_t)(now_tick - wheel->now) >= 0) {
+        slot = SHT_WHEEL_SLOT(wheel->now, 0);
+        for (level = 1; slot == 0 && level < SHT_WHEEL_LEVELS; ++level)
+            slot = sht_wheel_cascade(wheel, level);
+
+        /* the tick is consumed and its slot detached before the callbacks
+         * run: a timer re-armed for the current tick expires on the next one,
+         * and one re-armed a full turn ahead does not land in the slot being
+         * expired. Callbacks may still cancel timers of the detached list. */
+        slot = SHT_WHEEL_SLOT(wheel->now, 0);
+        wheel->now++;
+        pending = wheel->slots[0][slot];
+        wheel->slots[0][slot] = NULL;
+        if (pending)
+            pending->pprev = &pending;
+        while ((t = pending) != NULL) {
+            sht_wheel_cancel(t);
+            expired++;
+            fn(wheel, t, user_data);
+        }
+    }
+    return expired;
+}
+
+static uint32_t sht_wheel_usec_to_ticks(const sht_wheel_t* wheel,
+                                        uint32_t usec) {
+    return (usec + wheel->tick_usec - 1) / wheel->tick_usec;
+}
+
+/* bus time from the start of a measure-start event until the conversion
+ * starts: mux selection and a command of up to two bytes */
+static uint32_t sht_wheel_measure_usec(const sht_handle_t* handle) {
+    uint16_t khz = sht_clock_handle_khz(handle);
+
+    return sht_mux_select_writes(handle) * SHT_HANDLE_TRANSFER_USEC(1, khz) +
+           SHT_HANDLE_TRANSFER_USEC(2, khz);
+}
+
+static void sht_wheel_sensor_event(sht_wheel_t* wheel,
+                                   sht_wheel_timer_t* timer,
+                                   void* user_data) {
+    sht_wheel_sensor_t* s = (sht_wheel_sensor_t*)timer;
+    sht_wheel_sensor_ctx_t* ctx = (sht_wheel_sensor_ctx_t*)user_data;
+    sht_raw_sample_t sample;
+    uint32_t now = wheel->now - 1;
+    uint8_t reading = timer->event == SHT_WHEEL_EVENT_READ ||
+                      (timer->event == SHT_WHEEL_EVENT_RETRY && s->reading);
+    uint32_t usec = 0;
+    int16_t ret;
+
+    if (timer->event == SHT_WHEEL_EVENT_MEASURE) {
+        s->measure_tick = now;
+        s->retries = 0;
+    }
+
+    /* before the selection changes the mux path */
+    if (!reading)
+        usec = sht_wheel_measure_usec(s->handle) +
+               sht_handle_measurement_duration_usec(s->handle);
+    ret = sht_mux_select_handle(s->handle);
+    if (ret == STATUS_OK && !reading) {
+        ret = sht_handle_measure(s->handle);
+        if (ret == STATUS_OK) {
+            s->reading = 1;
+            sht_wheel_add(wheel, timer,
+                          now + sht_wheel_usec_to_ticks(wheel, usec),
+                          SHT_WHEEL_EVENT_READ);
+            return;
+        }
+    } else if (ret == STATUS_OK) {
+        ret = sht_handle_read_sample(s->handle, now, &sample);
+        if (ret == STATUS_OK) {
+            ctx->fn(ctx->user_data, &sample);
+            s->reading = 0;
+            sht_wheel_add(wheel, timer, s->measure_tick + s->period_ticks,
+                          SHT_WHEEL_EVENT_MEASURE);
+            return;
+        }
+        /* a failed read needs a new measurement */
+        s->reading = 0;
+    }
+
+    if (s->retries < s->max_retries) {
+        s->retries++;
+        sht_wheel_add(wheel, timer, now + s->retry_ticks,
+                      SHT_WHEEL_EVENT_RETRY);
+        return;
+    }
+
+    sample.timestamp_ms = now;
+    sample.sensor_id = s->handle->id;
+    sample.seq = s->handle->seq++;
+    sample.t_ticks = 0;
+    sample.rh_ticks = 0;
+    sample.status = ret;
+    sample.bus = s->handle->bus;
+    sample.family = s->handle->family;
+    ctx->fn(ctx->user_data, &sample);
+    s->reading = 0;
+    sht_wheel_add(wheel, timer, s->measure_tick + s->period_ticks,
+                  SHT_WHEEL_EVENT_MEASURE);
+}
+
+void sht_wheel_sensor_start(sht_wheel_t* wheel, sht_wheel_sensor_t* sensor,
+                            sht_handle_t* handle, uint32_t period_ticks,
+                            uint32_t retry_ticks, uint8_t max_retries,
+                            uint32_t first_tick) {
+    sensor->timer.next = NULL;
+    sensor->timer.pprev = NULL;
+    sensor->handle = handle;
+    sensor->period_ticks = period_ticks;
+    sensor->retry_ticks = retry_ticks;
+    sensor->measure_tick = first_tick;
+    sensor->reading = 0;
+    sensor->retries = 0;
+    sensor->max_retries = max_retries;
+    sht_wheel_add(wheel, &sensor->timer, first_tick, SHT_WHEEL_EVENT_MEASURE);
+}
+
+uint32_t sht_wheel_run_sensors(sht_wheel_t* wheel, uint32_t now_tick,
+                               sht_wheel_sample_fn fn, void* user_data) {
+    sht_wheel_sensor_ctx_t ctx;
+
+    ctx.fn = fn;
+    ctx.user_data = user_data;
+    return sht_wheel_advance(wheel, now_tick, sht_wheel_sensor_event, &ctx);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Hierarchical timing wheel for measure, read and retry events
+ *
+ * Large installations run thousands of sensors with periods from 100 ms to
+ * minutes. Instead of one blocking measure-and-read per sensor and period,
+ * the wheel keeps one timer per sensor and drives a small state machine:
+ * a measure-start event triggers the measurement and arms a read-ready event
+ * after the conversion time, the read-ready event reads the sample and arms
+ * the next measure-start event one period after the previous one. Failed
+ * transactions arm a retry event. Sensors on the same bus convert in
+ * parallel, the bus is only busy for the actual transactions.
+ *
+ * The wheel has SHT_WHEEL_LEVELS levels of 2^SHT_WHEEL_SLOT_BITS slots. A
+ * timer is placed on the level matching its distance from the current tick
+ * and cascades towards level 0 as time advances, so inserting, cancelling
+ * and expiring a timer are O(1). Timers are intrusive nodes owned by the
+ * caller, no memory is allocated. The tick length is chosen by the
+ * application; with 1 ms ticks the default wheel spans 4.6 hours.
+ */
+
+#ifndef SHT_WHEEL_H
+#define SHT_WHEEL_H
+
+#include "sht_handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SHT_WHEEL_SLOT_BITS
+#define SHT_WHEEL_SLOT_BITS 6
+#endif
+
+#ifndef SHT_WHEEL_LEVELS
+#define SHT_WHEEL_LEVELS 4
+#endif
+
+#define SHT_WHEEL_SLOTS (1U << SHT_WHEEL_SLOT_BITS)
+
+/**
+ * @brief Largest distance, in ticks, between now and a timer expiry; later
+ * expiries are clamped
+ */
+#define SHT_WHEEL_MAX_DELTA \
+    ((1UL << (SHT_WHEEL_SLOT_BITS * SHT_WHEEL_LEVELS)) - 1)
+
+/**
+ * @brief Events of the sensor state machine
+ */
+typedef enum _sht_wheel_event {
+    SHT_WHEEL_EVENT_MEASURE, /* start a measurement */
+    SHT_WHEEL_EVENT_READ,    /* the conversion is done, read the sample */
+    SHT_WHEEL_EVENT_RETRY    /* retry a failed measure or read */
+} sht_wheel_event_t;
+
+/**
+ * @brief Intrusive timer node, must be zero-initialized before first use
+ */
+typedef struct _sht_wheel_timer {
+    struct _sht_wheel_timer* next;
+    struct _sht_wheel_timer** pprev; /* link pointing to this node */
+    uint32_t expires;                /* expiry tick */
+    uint8_t event;                   /* sht_wheel_event_t */
+} sht_wheel_timer_t;
+
+typedef struct _sht_wheel {
+    sht_wheel_timer_t* slots[SHT_WHEEL_LEVELS][SHT_WHEEL_SLOTS];
+    uint32_t now;       /* next tick to process */
+    uint32_t tick_usec; /* length of a tick */
+} sht_wheel_t;
+
+typedef void (*sht_wheel_expire_fn)(sht_wheel_t* wheel,
+                                    sht_wheel_timer_t* timer, void* user_data);
+
+/**
+ * @brief Scheduled sensor, driven by the measure/read/retry state machine
+ */
+typedef struct _sht_wheel_sensor {
+    sht_wheel_timer_t timer; /* must be the first member */
+    sht_handle_t* handle;
+    uint32_t period_ticks;
+    uint32_t retry_ticks;
+    uint32_t measure_tick; /* tick of the current period's measure-start */
+    uint8_t reading;       /* a retry repeats the read, not the measure */
+    uint8_t retries;       /* retries spent in the current period */
+    uint8_t max_retries;
+} sht_wheel_sensor_t;
+
+typedef void (*sht_wheel_sample_fn)(void* user_data,
+                                    const sht_raw_sample_t* sample);
+
+/**
+ * @brief Initialize an empty wheel
+ *
+ * @param[out] wheel     the wheel
+ * @param[in]  now_tick  the current tick
+ * @param[in]  tick_usec the length of a tick in microseconds
+ */
+void sht_wheel_init(sht_wheel_t* wheel, uint32_t now_tick, uint32_t tick_usec);
+
+/**
+ * @brief Arm a timer; an armed timer is moved to the new expiry
+ *
+ * @param[in] wheel   the wheel
+ * @param[in] timer   the timer
+ * @param[in] expires the expiry tick, ticks in the past expire on the next
+ *                    advance
+ * @param[in] event   the sht_wheel_event_t reported on expiry
+ */
+void sht_wheel_add(sht_wheel_t* wheel, sht_wheel_timer_t* timer,
+                   uint32_t expires, uint8_t event);
+
+/**
+ * @brief Disarm a timer, does nothing if it is not armed
+ *
+ * @param[in] timer the timer
+ */
+void sht_wheel_cancel(sht_wheel_timer_t* timer);
+
+/**
+ * @brief Process all ticks up to and including now_tick, calling fn for every
+ * expired timer. The callback may re-arm the timer or arm other timers.
+ *
+ * @param[in] wheel     the wheel
+ * @param[in] now_tick  the current tick
+ * @param[in] fn        the expiry callback
+ * @param[in] user_data passed to fn
+ *
+ * @return the number of expired timers
+ */
+uint32_t sht_wheel_advance(sht_wheel_t* wheel, uint32_t now_tick,
+                           sht_wheel_expire_fn fn, void* user_data);
+
+/**
+ * @brief Initialize a scheduled sensor and arm its first measure-start
+ *
+ * @param[in]  wheel        the wheel
+ * @param[out] sensor       the scheduled sensor
+ * @param[in]  handle       the sensor handle
+ * @param[in]  period_ticks the sampling period
+ * @param[in]  retry_ticks  the delay before retrying a failed transaction
+ * @param[in]  max_retries  the retries per period before a failed sample is
+ *                          reported
+ * @param[in]  first_tick   the tick of the first measure-start
+ */
+void sht_wheel_sensor_start(sht_wheel_t* wheel, sht_wheel_sensor_t* sensor,
+                            sht_handle_t* handle, uint32_t period_ticks,
+                            uint32_t retry_ticks, uint8_t max_retries,
+                            uint32_t first_tick);
+
+/**
+ * @brief Advance the wheel and run the state machine of all expired sensors.
+ * Every period of every sensor produces exactly one sample, with a non-zero
+ * status if the retries were exhausted. Sample timestamps are in ticks.
+ *
+ * @param[in] wheel     the wheel holding only sht_wheel_sensor_t timers
+ * @param[in] now_tick  the current tick
+ * @param[in] fn        called with every sample
+ * @param[in] user_data passed to fn
+ *
+ * @return the number of processed events
+ */
+uint32_t sht_wheel_run_sensors(sht_wheel_t* wheel, uint32_t now_tick,
+                               sht_wheel_sample_fn fn, void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_WHEEL_H */
@@ -43,6 +43,7 @@
 #include "shtc1.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sht_frame.h"
 #include <sensirion-embedded-common.h>
 
 /* all measurement commands return T (CRC) RH (CRC) */
@@ -90,21 +91,32 @@ int16_t shtc1_measure(void) {
 }
 
 int16_t shtc1_read(int32_t* temperature, int32_t* humidity) {
-    uint16_t words[2];
-    int16_t ret = sensirion_i2c_read_words(SHTC1_ADDRESS, words,
-                                           SENSIRION_NUM_WORDS(words));
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    int16_t ret = shtc1_read_ticks(&t_ticks, &rh_ticks);
+    if (ret)
+        return ret;
     /**
      * formulas for conversion of the sensor signals, optimized for fixed point
      * algebra:
      * Temperature = 175 * S_T / 2^16 - 45
      * Relative Humidity = 100 * S_RH / 2^16
      */
-    *temperature = ((21875 * (int32_t)words[0]) >> 13) - 45000;
-    *humidity = ((12500 * (int32_t)words[1]) >> 13);
+    *temperature = ((21875 * (int32_t)t_ticks) >> 13) - 45000;
+    *humidity = ((12500 * (int32_t)rh_ticks) >> 13);
 
     return ret;
 }
 
+int16_t shtc1_read_ticks(uint16_t* t_ticks, uint16_t* rh_ticks) {
+    uint8_t data[SHT_FRAME_MEASUREMENT_SIZE];
+    int16_t ret = sensirion_i2c_read(SHTC1_ADDRESS, data, sizeof(data));
+    if (ret)
+        return ret;
+
+    return sht_frame_unpack_ticks(data, t_ticks, rh_ticks);
+}
+
 int16_t shtc1_probe(void) {
     uint32_t serial;
 
@@ -102,6 +102,17 @@ int16_t shtc1_measure(void);
  */
 int16_t shtc1_read(int32_t* temperature, int32_t* humidity);
 
+/**
+ * Reads out the raw ticks of a measurement that was previously started by
+ * shtc1_measure(). The CRC check and the word unpacking are done in a single
+ * pass over the received bytes.
+ *
+ * @param t_ticks   the address for the temperature ticks
+ * @param rh_ticks  the address for the relative humidity ticks
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t shtc1_read_ticks(uint16_t* t_ticks, uint16_t* rh_ticks);
+
 /**
  * Send the sensor to sleep, if supported.
  *
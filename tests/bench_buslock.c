@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Overhead of the bus lock: an uncontended acquire and release pair, and
+ * sweeps of 1 to 24 SHT4x behind up to three multiplexers with and without
+ * the lock. The locked sweep closes the selected multiplexer path before
+ * every release, so it pays those mux writes on top of the lock file
+ * operations and finds the bus with all channels disabled. The overhead is
+ * the extra bus time plus the extra host time of the locked sweep, relative
+ * to the duration of the unlocked one: simulated bus time and conversion
+ * waits, plus its host time. Bus times are simulated, host times measured.
+ */
+
+#include "sht4x.h"
+#include "sht_buslock.h"
+#include "sht_handle.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_SENSORS 24
+#define MAX_MUXES ((MAX_SENSORS + 7) / 8)
+#define ROUNDS 1000
+#define LOCK_ROUNDS 100000
+
+static sht_mux_t muxes[MAX_MUXES];
+static sht_handle_t handles[MAX_SENSORS];
+
+/* cost of one sweep */
+typedef struct _sweep_cost {
+    double sweep_usec; /* simulated duration, conversion waits included */
+    double bus_usec;   /* simulated bus time */
+    double host_usec;
+    double mux_writes;
+    uint16_t failed;
+} sweep_cost_t;
+
+/* the sensors spread over the channels of (n + 7) / 8 muxes */
+static void setup(uint16_t n) {
+    uint8_t sim[MAX_MUXES];
+    uint8_t num_muxes = (uint8_t)((n + 7) / 8);
+    uint16_t i;
+
+    sht_i2c_sim_init();
+    for (i = 0; i < num_muxes; ++i) {
+        sim[i] = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0,
+                                     (uint8_t)(0x70 + i));
+        sht_mux_init(&muxes[i], 0, (uint8_t)(0x70 + i), 0, NULL, 0);
+    }
+
+    for (i = 0; i < n; ++i) {
+        sht_handle_t* h = &handles[i];
+
+        h->mux = &muxes[i % num_muxes];
+        h->id = i;
+        h->seq = 0;
+        h->clock_khz = 0;
+        h->bus = 0;
+        h->channel = (uint8_t)(i / num_muxes);
+        h->addr = sht4x_get_configured_address();
+        h->family = SHT_FAMILY_SHT4X;
+        sht_i2c_sim_add_sensor(0, sim[i % num_muxes], h->channel, h->addr,
+                               SHT_FAMILY_SHT4X, i);
+    }
+}
+
+static double elapsed_nsec(const struct timespec* t0,
+                           const struct timespec* t1) {
+    return (t1->tv_sec - t0->tv_sec) * 1e9 + (t1->tv_nsec - t0->tv_nsec);
+}
+
+static uint32_t mux_writes(void) {
+    uint32_t writes = 0;
+    uint8_t i;
+
+    for (i = 0; i < MAX_MUXES; ++i)
+        writes += muxes[i].writes;
+    return writes;
+}
+
+static void run_sweep(uint16_t n, sht_buslock_t* lock, sweep_cost_t* cost) {
+    sht_raw_sample_t samples[MAX_SENSORS];
+    uint16_t order[MAX_SENSORS];
+    struct timespec t0, t1;
+    uint64_t now_usec;
+    uint64_t bus_usec;
+    uint32_t writes;
+    uint16_t f;
+    uint32_t r;
+
+    setup(n);
+    sht_mux_plan(handles, n, order);
+    now_usec = sht_i2c_sim.now_usec;
+    bus_usec = sht_i2c_sim.bus_usec;
+    writes = mux_writes();
+    cost->failed = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (r = 0; r < ROUNDS; ++r) {
+        if (lock) {
+            if (sht_buslock_sweep(lock, handles, order, n, r, samples, &f) !=
+                STATUS_OK)
+                cost->failed++;
+            cost->failed += f;
+        } else {
+            cost->failed += sht_mux_sweep(handles, order, n, r, samples);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    cost->host_usec = elapsed_nsec(&t0, &t1) / 1000 / ROUNDS;
+    cost->sweep_usec =
+        (double)(sht_i2c_sim.now_usec - now_usec) / ROUNDS + cost->host_usec;
+    cost->bus_usec = (double)(sht_i2c_sim.bus_usec - bus_usec) / ROUNDS;
+    cost->mux_writes = (double)(mux_writes() - writes) / ROUNDS;
+    if (sht_i2c_sim_open_muxes(0) != (lock ? 0 : 1))
+        cost->failed++;
+}
+
+int main(void) {
+    static const uint16_t sizes[] = {1, 4, 8, 16, 24};
+    char dir[] = "/tmp/bench_buslock.XXXXXX";
+    char path[64];
+    sht_buslock_t lock;
+    sweep_cost_t unlocked;
+    sweep_cost_t locked;
+    struct timespec t0, t1;
+    double overhead;
+    uint32_t r;
+    uint8_t i;
+
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    sht_buslock_init(&lock, dir);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (r = 0; r < LOCK_ROUNDS; ++r) {
+        if (sht_buslock_acquire(&lock, 0, NULL) != STATUS_OK ||
+            sht_buslock_release(&lock, 0) != STATUS_OK) {
+            printf("locking failed\n");
+            break;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("acquire + release, uncontended  %6.0f ns host\n",
+           elapsed_nsec(&t0, &t1) / LOCK_ROUNDS);
+
+    printf("SHT4x behind up to %d muxes, %d sweeps each\n", MAX_MUXES,
+           ROUNDS);
+    printf("sensors   sweep us   +bus us  +mux writes  +host us  overhead  "
+           "failed\n");
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        run_sweep(sizes[i], NULL, &unlocked);
+        run_sweep(sizes[i], &lock, &locked);
+        overhead = (locked.bus_usec - unlocked.bus_usec + locked.host_usec -
+                    unlocked.host_usec) /
+                   unlocked.sweep_usec;
+        printf("%7u  %9.0f  %8.0f  %11.1f  %8.1f  %7.2f%%  %6u\n",
+               sizes[i], unlocked.sweep_usec,
+               locked.bus_usec - unlocked.bus_usec,
+               locked.mux_writes - unlocked.mux_writes,
+               locked.host_usec - unlocked.host_usec, 100 * overhead,
+               unlocked.failed + locked.failed);
+    }
+
+    sht_buslock_close(&lock);
+    snprintf(path, sizeof(path), "%s/sht-i2c-0.lock", dir);
+    unlink(path);
+    rmdir(dir);
+    return 0;
+}
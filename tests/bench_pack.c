@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Decode throughput of packed tick blocks: 1024 blocks of 128 values per
+ * width, decoded to ticks and, fused with the conversion, to milli degrees.
+ * The blocks stay in the L2 cache, so the figures are those of the kernel.
+ * Host times are measured, the best of five runs is reported.
+ */
+
+#include "sht_pack.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_BLOCKS 1024
+#define ROUNDS 50
+#define RUNS 5
+
+static uint8_t blocks[NUM_BLOCKS][SHT_PACK_BLOCK_MAX_SIZE];
+static uint16_t ticks[SHT_PACK_BLOCK_SAMPLES];
+static int32_t values[SHT_PACK_BLOCK_SAMPLES];
+
+static uint32_t rng = 3;
+
+static uint32_t random_u32(void) {
+    rng = rng * 1103515245U + 12345U;
+    return rng >> 8;
+}
+
+static double elapsed_nsec(const struct timespec* t0,
+                           const struct timespec* t1) {
+    return (t1->tv_sec - t0->tv_sec) * 1e9 + (t1->tv_nsec - t0->tv_nsec);
+}
+
+/* a slowly varying signal with noise of the given width */
+static void encode(uint8_t width) {
+    uint16_t in[SHT_PACK_BLOCK_SAMPLES];
+    uint16_t level = 26000;
+    uint16_t b;
+    uint16_t i;
+
+    for (b = 0; b < NUM_BLOCKS; ++b) {
+        level = (uint16_t)(level + random_u32() % 64 - 32);
+        for (i = 0; i < SHT_PACK_BLOCK_SAMPLES; ++i)
+            in[i] = (uint16_t)(level + random_u32() % (1UL << width));
+        in[0] = level;
+        in[1] = (uint16_t)(level + (1UL << width) - 1);
+        (void)sht_pack_encode(in, SHT_PACK_BLOCK_SAMPLES, blocks[b]);
+    }
+}
+
+static double run(uint8_t milli, uint32_t* check) {
+    struct timespec t0, t1;
+    double best = 0;
+    double rate;
+    uint16_t b;
+    uint16_t r;
+    uint8_t n;
+
+    for (n = 0; n < RUNS; ++n) {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (r = 0; r < ROUNDS; ++r) {
+            for (b = 0; b < NUM_BLOCKS; ++b) {
+                if (milli) {
+                    sht_pack_decode_milli(blocks[b], SHT_PACK_TEMPERATURE,
+                                          values);
+                    *check += (uint32_t)values[b % SHT_PACK_BLOCK_SAMPLES];
+                } else {
+                    sht_pack_decode(blocks[b], ticks);
+                    *check += ticks[b % SHT_PACK_BLOCK_SAMPLES];
+                }
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        /* values per nanosecond, i.e. G values/s */
+        rate = (double)ROUNDS * NUM_BLOCKS * SHT_PACK_BLOCK_SAMPLES /
+               elapsed_nsec(&t0, &t1);
+        if (rate > best)
+            best = rate;
+    }
+    return best;
+}
+
+int main(void) {
+    static const uint8_t widths[] = {1, 4, 8, 12, 16};
+    uint32_t check = 0;
+    uint8_t i;
+
+    printf("%d blocks of %d values, %d rounds, best of %d runs\n",
+           NUM_BLOCKS, SHT_PACK_BLOCK_SAMPLES, ROUNDS, RUNS);
+    printf("width  block bytes  decode G values/s  decode milli G values/s\n");
+    for (i = 0; i < sizeof(widths); ++i) {
+        double ticks_rate;
+        double milli_rate;
+
+        encode(widths[i]);
+        ticks_rate = run(0, &check);
+        milli_rate = run(1, &check);
+        printf("%5u  %11u  %17.2f  %23.2f\n", widths[i],
+               SHT_PACK_BLOCK_SIZE(widths[i]), ticks_rate, milli_rate);
+    }
+    /* keeps the decoded values alive */
+    printf("checksum %lu\n", (unsigned long)check);
+    return 0;
+}
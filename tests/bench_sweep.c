@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Sweep time of 16 SHT4x sensors behind two multiplexers at 100 kHz, 400 kHz
+ * and 1 MHz, and on a bus where one mux only supports 400 kHz so the sweep
+ * groups the sensors by clock. Times are simulated: the sweep time includes
+ * the measurement wait and the command delays of the driver, the bus time
+ * only the transfers at the selected clock.
+ */
+
+#include "sht4x.h"
+#include "sht_clock.h"
+#include "sht_handle.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_SENSORS 16
+#define ROUNDS 1000
+
+static sht_mux_t mux_a;
+static sht_mux_t mux_b;
+static sht_handle_t handles[NUM_SENSORS];
+static uint32_t clock_changes;
+
+static int16_t count_clock(void* user_data, uint8_t bus, uint16_t clock_khz) {
+    clock_changes++;
+    return sht_i2c_sim_set_clock(user_data, bus, clock_khz);
+}
+
+static void setup(uint16_t sensor_khz, uint16_t mux_b_khz) {
+    uint8_t a, b;
+    uint16_t i;
+
+    sht_i2c_sim_init();
+    a = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x70);
+    b = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x71);
+    sht_mux_init(&mux_a, 0, 0x70, 0, NULL, 0);
+    sht_mux_init(&mux_b, 0, 0x71, 0, NULL, 0);
+    mux_a.clock_khz = sensor_khz;
+    mux_b.clock_khz = mux_b_khz;
+    sht_clock_set_bus_limit(0, sensor_khz);
+    sht_clock_set_backend(count_clock, NULL);
+
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        sht_handle_t* h = &handles[i];
+
+        /* interleave the muxes so the plan has something to group */
+        h->mux = i % 2 ? &mux_b : &mux_a;
+        h->id = i;
+        h->seq = 0;
+        h->clock_khz = sensor_khz;
+        h->bus = 0;
+        h->channel = (uint8_t)(i / 2);
+        h->addr = sht4x_get_configured_address();
+        h->family = SHT_FAMILY_SHT4X;
+        sht_i2c_sim_add_sensor(0, i % 2 ? b : a, h->channel, h->addr,
+                               SHT_FAMILY_SHT4X, i);
+    }
+}
+
+static void run(const char* name, uint16_t sensor_khz, uint16_t mux_b_khz) {
+    sht_raw_sample_t samples[NUM_SENSORS];
+    uint16_t order[NUM_SENSORS];
+    struct timespec t0, t1;
+    uint64_t sim_usec;
+    uint64_t bus_usec;
+    uint32_t transfers;
+    uint32_t changes;
+    uint16_t failed = 0;
+    double host_nsec;
+    uint32_t r;
+
+    setup(sensor_khz, mux_b_khz);
+    sht_mux_plan(handles, NUM_SENSORS, order);
+
+    /* one sweep to open the muxes and settle the clock */
+    failed += sht_mux_sweep(handles, order, NUM_SENSORS, 0, samples);
+    sim_usec = sht_i2c_sim.now_usec;
+    bus_usec = sht_i2c_sim.bus_usec;
+    transfers = sht_i2c_sim.transfers;
+    changes = clock_changes;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (r = 0; r < ROUNDS; ++r)
+        failed += sht_mux_sweep(handles, order, NUM_SENSORS, r, samples);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    sim_usec = (sht_i2c_sim.now_usec - sim_usec) / ROUNDS;
+    bus_usec = (sht_i2c_sim.bus_usec - bus_usec) / ROUNDS;
+    host_nsec = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) /
+                ROUNDS;
+    printf("%-18s sweep %6lu us  bus %6lu us  %5.1f transfers  "
+           "%4.1f clock changes  %7.0f ns host  %u failed\n",
+           name, (unsigned long)sim_usec, (unsigned long)bus_usec,
+           (double)(sht_i2c_sim.transfers - transfers) / ROUNDS,
+           (double)(clock_changes - changes) / ROUNDS, host_nsec, failed);
+}
+
+int main(void) {
+    printf("%d SHT4x behind two muxes, %d sweeps\n", NUM_SENSORS, ROUNDS);
+    run("100 kHz", SHT_CLOCK_STANDARD_KHZ, SHT_CLOCK_STANDARD_KHZ);
+    run("400 kHz", SHT_CLOCK_FAST_KHZ, SHT_CLOCK_FAST_KHZ);
+    run("1 MHz", SHT_CLOCK_FAST_PLUS_KHZ, SHT_CLOCK_FAST_PLUS_KHZ);
+    run("1 MHz + 400 kHz", SHT_CLOCK_FAST_PLUS_KHZ, SHT_CLOCK_FAST_KHZ);
+    return 0;
+}
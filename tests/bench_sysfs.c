@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * CPU cost and latency of a sample read through the sysfs backend and
+ * through i2c-dev.
+ *
+ *   bench_sysfs                      sysfs backend on a fake tree only
+ *   bench_sysfs BUS ADDR [FAMILY]    also the sensor at ADDR on /dev/i2c-BUS
+ *                                    and, if a kernel driver is bound to it,
+ *                                    its /sys attributes
+ *
+ * The fake tree isolates the cost of the backend itself (two pread() and
+ * parses per sample). On real sensors the latency of i2c-dev is dominated by
+ * the measurement duration, that of the kernel driver by its own wait and
+ * caching policy.
+ */
+
+/* clock_gettime() */
+#define _POSIX_C_SOURCE 200809L
+
+#include "sensirion_i2c.h"
+#include "sht_handle.h"
+#include "sht_sysfs.h"
+#include "sht_sysfs_tree.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef int16_t (*read_fn)(void* ctx, sht_raw_sample_t* sample);
+
+static uint64_t nsec(clockid_t clock) {
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static void run(const char* name, read_fn fn, void* ctx, uint32_t rounds) {
+    sht_raw_sample_t sample;
+    uint64_t wall = nsec(CLOCK_MONOTONIC);
+    uint64_t cpu = nsec(CLOCK_PROCESS_CPUTIME_ID);
+    uint32_t failed = 0;
+    uint32_t r;
+
+    for (r = 0; r < rounds; ++r)
+        if (fn(ctx, &sample) != 0)
+            failed++;
+    wall = nsec(CLOCK_MONOTONIC) - wall;
+    cpu = nsec(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+    printf("%-22s %10.1f us latency %9.2f us cpu  %u/%u failed\n", name,
+           wall / 1e3 / rounds, cpu / 1e3 / rounds, failed, rounds);
+}
+
+typedef struct {
+    sht_sysfs_dev_t dev;
+    sht_handle_t handle;
+} sysfs_ctx_t;
+
+static int16_t read_sysfs(void* ctx, sht_raw_sample_t* sample) {
+    sysfs_ctx_t* c = ctx;
+
+    return sht_sysfs_read_sample(&c->dev, &c->handle, 0, sample);
+}
+
+static int16_t read_i2c_dev(void* ctx, sht_raw_sample_t* sample) {
+    sht_handle_t* h = ctx;
+    int16_t ret = sht_handle_measure(h);
+
+    if (ret != 0)
+        return ret;
+    sensirion_sleep_usec(sht_handle_measurement_duration_usec(h));
+    return sht_handle_read_sample(h, 0, sample);
+}
+
+int main(int argc, char** argv) {
+    char root[SHT_SYSFS_TREE_PATH_MAX];
+    sysfs_ctx_t sysfs;
+    sht_handle_t handle = {NULL, 0, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X};
+    int bus;
+
+    if (sht_sysfs_tree_create(root) != 0 ||
+        sht_sysfs_tree_add_hwmon(root, 0, "sht3x", 1, 0x44, 23450, 45600) !=
+            0 ||
+        sht_sysfs_open(&sysfs.dev, root, SHT_FAMILY_SHT3X, 1, 0x44) != 0) {
+        printf("bench_sysfs: cannot build the fake tree\n");
+        return 1;
+    }
+    sysfs.handle = handle;
+    run("sysfs, fake tree", read_sysfs, &sysfs, 100000);
+    sht_sysfs_close(&sysfs.dev);
+    sht_sysfs_tree_remove(root);
+
+    if (argc < 3) {
+        printf("no sensor given, i2c-dev and kernel driver skipped\n");
+        return 0;
+    }
+
+    bus = atoi(argv[1]);
+    handle.bus = (uint8_t)bus;
+    handle.addr = (uint8_t)strtoul(argv[2], NULL, 0);
+    if (argc > 3 && strcmp(argv[3], "sht4x") == 0)
+        handle.family = SHT_FAMILY_SHT4X;
+    else if (argc > 3 && strcmp(argv[3], "shtc1") == 0)
+        handle.family = SHT_FAMILY_SHTC1;
+
+    if (sht_sysfs_open(&sysfs.dev, NULL, handle.family, bus, handle.addr) ==
+        0) {
+        sysfs.handle = handle;
+        run("sysfs, kernel driver", read_sysfs, &sysfs, 200);
+        sht_sysfs_close(&sysfs.dev);
+    } else {
+        printf("no kernel driver bound, sysfs skipped\n");
+    }
+
+    sensirion_i2c_select_bus(handle.bus);
+    sensirion_i2c_init();
+    run("i2c-dev", read_i2c_dev, &handle, 200);
+    sensirion_i2c_release();
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+
+uint8_t sensirion_common_generate_crc(const uint8_t* data, uint16_t count) {
+    uint16_t current_byte;
+    uint8_t crc = CRC8_INIT;
+    uint8_t crc_bit;
+
+    for (current_byte = 0; current_byte < count; ++current_byte) {
+        crc ^= data[current_byte];
+        for (crc_bit = 8; crc_bit > 0; --crc_bit) {
+            if (crc & 0x80)
+                crc = (uint8_t)((crc << 1) ^ CRC8_POLYNOMIAL);
+            else
+                crc = (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+int8_t sensirion_common_check_crc(const uint8_t* data, uint16_t count,
+                                  uint8_t checksum) {
+    if (sensirion_common_generate_crc(data, count) != checksum)
+        return STATUS_FAIL;
+    return NO_ERROR;
+}
+
+uint16_t sensirion_fill_cmd_send_buf(uint8_t* buf, uint16_t cmd,
+                                     const uint16_t* args, uint8_t num_args) {
+    uint16_t idx = 0;
+    uint8_t i;
+
+    buf[idx++] = (uint8_t)(cmd >> 8);
+    buf[idx++] = (uint8_t)cmd;
+    for (i = 0; i < num_args; ++i) {
+        buf[idx++] = (uint8_t)(args[i] >> 8);
+        buf[idx++] = (uint8_t)args[i];
+        buf[idx] = sensirion_common_generate_crc(&buf[idx - 2],
+                                                 SENSIRION_WORD_SIZE);
+        ++idx;
+    }
+    return idx;
+}
+
+int16_t sensirion_i2c_read_words_as_bytes(uint8_t address, uint8_t* data,
+                                          uint16_t num_words) {
+    uint8_t buf[SENSIRION_MAX_BUFFER_WORDS * (SENSIRION_WORD_SIZE + CRC8_LEN)];
+    uint16_t size = num_words * (SENSIRION_WORD_SIZE + CRC8_LEN);
+    uint16_t i;
+    uint16_t j;
+    int16_t ret;
+
+    if (num_words > SENSIRION_MAX_BUFFER_WORDS)
+        return STATUS_FAIL;
+
+    ret = sensirion_i2c_read(address, buf, size);
+    if (ret != NO_ERROR)
+        return ret;
+
+    for (i = 0, j = 0; i < size; i += SENSIRION_WORD_SIZE + CRC8_LEN) {
+        ret = sensirion_common_check_crc(&buf[i], SENSIRION_WORD_SIZE,
+                                         buf[i + SENSIRION_WORD_SIZE]);
+        if (ret != NO_ERROR)
+            return ret;
+        data[j++] = buf[i];
+        data[j++] = buf[i + 1];
+    }
+    return NO_ERROR;
+}
+
+int16_t sensirion_i2c_read_words(uint8_t address, uint16_t* data_words,
+                                 uint16_t num_words) {
+    uint8_t bytes[SENSIRION_MAX_BUFFER_WORDS * SENSIRION_WORD_SIZE];
+    uint16_t i;
+    int16_t ret;
+
+    ret = sensirion_i2c_read_words_as_bytes(address, bytes, num_words);
+    if (ret != NO_ERROR)
+        return ret;
+
+    for (i = 0; i < num_words; ++i)
+        data_words[i] = (uint16_t)((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+    return NO_ERROR;
+}
+
+int16_t sensirion_i2c_write_cmd(uint8_t address, uint16_t command) {
+    uint8_t buf[SENSIRION_COMMAND_SIZE];
+
+    sensirion_fill_cmd_send_buf(buf, command, NULL, 0);
+    return sensirion_i2c_write(address, buf, SENSIRION_COMMAND_SIZE);
+}
+
+int16_t sensirion_i2c_write_cmd_with_args(uint8_t address, uint16_t command,
+                                          const uint16_t* data_words,
+                                          uint16_t num_words) {
+    uint8_t buf[SENSIRION_COMMAND_SIZE +
+                SENSIRION_MAX_BUFFER_WORDS * (SENSIRION_WORD_SIZE + CRC8_LEN)];
+    uint16_t size;
+
+    if (num_words > SENSIRION_MAX_BUFFER_WORDS)
+        return STATUS_FAIL;
+
+    size = sensirion_fill_cmd_send_buf(buf, command, data_words,
+                                       (uint8_t)num_words);
+    return sensirion_i2c_write(address, buf, size);
+}
+
+int16_t sensirion_i2c_delayed_read_cmd(uint8_t address, uint16_t cmd,
+                                       uint32_t delay_us, uint16_t* data_words,
+                                       uint16_t num_words) {
+    int16_t ret = sensirion_i2c_write_cmd(address, cmd);
+
+    if (ret != NO_ERROR)
+        return ret;
+    if (delay_us)
+        sensirion_sleep_usec(delay_us);
+    return sensirion_i2c_read_words(address, data_words, num_words);
+}
+
+int16_t sensirion_i2c_read_cmd(uint8_t address, uint16_t cmd,
+                               uint16_t* data_words, uint16_t num_words) {
+    return sensirion_i2c_delayed_read_cmd(address, cmd, 0, data_words,
+                                          num_words);
+}
+
+uint32_t sensirion_bytes_to_uint32_t(const uint8_t* bytes) {
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) |
+           ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
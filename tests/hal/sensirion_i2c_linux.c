@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief I2C HAL over the Linux i2c-dev interface
+ *
+ * Bus index n is /dev/i2c-n, opened on first use. Used by the benchmarks
+ * that run against real sensors.
+ */
+
+/* usleep() */
+#define _DEFAULT_SOURCE
+
+#include "sensirion_i2c.h"
+
+#include <fcntl.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#define I2C_LINUX_NO_ADDRESS 0xFF
+
+static int i2c_fd = -1;
+static uint8_t i2c_bus = 0;
+static uint8_t i2c_address = I2C_LINUX_NO_ADDRESS;
+
+static int i2c_linux_open(uint8_t address) {
+    char path[16];
+
+    if (i2c_fd < 0) {
+        snprintf(path, sizeof(path), "/dev/i2c-%u", i2c_bus);
+        i2c_fd = open(path, O_RDWR | O_CLOEXEC);
+        if (i2c_fd < 0)
+            return -1;
+        i2c_address = I2C_LINUX_NO_ADDRESS;
+    }
+    if (i2c_address != address) {
+        if (ioctl(i2c_fd, I2C_SLAVE, (unsigned long)address) < 0)
+            return -1;
+        i2c_address = address;
+    }
+    return 0;
+}
+
+int16_t sensirion_i2c_select_bus(uint8_t bus_idx) {
+    if (bus_idx != i2c_bus)
+        sensirion_i2c_release();
+    i2c_bus = bus_idx;
+    return 0;
+}
+
+void sensirion_i2c_init(void) {
+}
+
+void sensirion_i2c_release(void) {
+    if (i2c_fd >= 0)
+        close(i2c_fd);
+    i2c_fd = -1;
+}
+
+int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count) {
+    if (i2c_linux_open(address) != 0 || read(i2c_fd, data, count) != count)
+        return -1;
+    return 0;
+}
+
+int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
+                           uint16_t count) {
+    if (i2c_linux_open(address) != 0 || write(i2c_fd, data, count) != count)
+        return -1;
+    return 0;
+}
+
+void sensirion_sleep_usec(uint32_t useconds) {
+    usleep(useconds);
+}
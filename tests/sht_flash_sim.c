@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief File-backed NOR flash simulation implementation
+ */
+
+#include "sht_flash_sim.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SHT_FLASH_SIM_CHUNK 256
+
+/* count an operation towards the scheduled power cut, return 1 if the power
+ * fails during it */
+static uint8_t sht_flash_sim_cut(sht_flash_sim_t* sim) {
+    if (sim->power_cut_after < 0)
+        return 0;
+    if (sim->power_cut_after-- > 0)
+        return 0;
+    sim->powered = 0;
+    sim->power_cut_after = -1;
+    return 1;
+}
+
+static int16_t sht_flash_sim_read(void* ctx, uint32_t addr, uint8_t* data,
+                                  uint16_t len) {
+    sht_flash_sim_t* sim = (sht_flash_sim_t*)ctx;
+
+    if (!sim->powered || addr + len > sim->size ||
+        pread(sim->fd, data, len, (off_t)addr) != (ssize_t)len)
+        return STATUS_ERR_IO;
+    sim->reads++;
+    return STATUS_OK;
+}
+
+static int16_t sht_flash_sim_program(void* ctx, uint32_t addr,
+                                     const uint8_t* data, uint16_t len) {
+    sht_flash_sim_t* sim = (sht_flash_sim_t*)ctx;
+    uint8_t buf[SHT_FLASH_SIM_CHUNK];
+    uint16_t done;
+    uint16_t n;
+    uint16_t i;
+    uint8_t bad = 0;
+
+    if (!sim->powered || addr + len > sim->size)
+        return STATUS_ERR_IO;
+    sim->programs++;
+    if (sht_flash_sim_cut(sim))
+        len /= 2;
+
+    for (done = 0; done < len; done = (uint16_t)(done + n)) {
+        n = (uint16_t)(len - done);
+        if (n > SHT_FLASH_SIM_CHUNK)
+            n = SHT_FLASH_SIM_CHUNK;
+        if (pread(sim->fd, buf, n, (off_t)(addr + done)) != (ssize_t)n)
+            return STATUS_ERR_IO;
+        for (i = 0; i < n; ++i) {
+            bad |= (uint8_t)(data[done + i] & ~buf[i]);
+            buf[i] &= data[done + i];
+        }
+        if (pwrite(sim->fd, buf, n, (off_t)(addr + done)) != (ssize_t)n)
+            return STATUS_ERR_IO;
+    }
+    sim->program_bytes += len;
+    if (bad)
+        sim->bad_programs++;
+    return sim->powered ? STATUS_OK : STATUS_ERR_IO;
+}
+
+static int16_t sht_flash_sim_erase(void* ctx, uint32_t addr) {
+    sht_flash_sim_t* sim = (sht_flash_sim_t*)ctx;
+    uint8_t buf[SHT_FLASH_SIM_CHUNK];
+    uint32_t sector = addr / sim->sector_size;
+    uint32_t len = sim->sector_size;
+    uint32_t done;
+    uint32_t n;
+
+    if (!sim->powered || addr % sim->sector_size || addr >= sim->size)
+        return STATUS_ERR_IO;
+    sim->erases++;
+    if (sim->sector_erases) {
+        sim->sector_erases[sector]++;
+        if (sim->sector_erases[sector] > sim->max_sector_erases)
+            sim->max_sector_erases = sim->sector_erases[sector];
+    }
+    if (sht_flash_sim_cut(sim))
+        len /= 2;
+
+    memset(buf, 0xFF, sizeof(buf));
+    for (done = 0; done < len; done += n) {
+        n = len - done;
+        if (n > sizeof(buf))
+            n = sizeof(buf);
+        if (pwrite(sim->fd, buf, n, (off_t)(addr + done)) != (ssize_t)n)
+            return STATUS_ERR_IO;
+    }
+    return sim->powered ? STATUS_OK : STATUS_ERR_IO;
+}
+
+const sht_flash_ops_t sht_flash_sim_ops = {
+    sht_flash_sim_read,
+    sht_flash_sim_program,
+    sht_flash_sim_erase,
+};
+
+int16_t sht_flash_sim_open(sht_flash_sim_t* sim, const char* path,
+                           uint32_t size, uint32_t sector_size,
+                           uint32_t* sector_erases) {
+    struct stat st;
+    uint32_t i;
+
+    if (!sector_size || size % sector_size)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    sim->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (sim->fd < 0)
+        return STATUS_ERR_IO;
+    sim->size = size;
+    sim->sector_size = sector_size;
+    sim->sector_erases = sector_erases;
+    sim->power_cut_after = -1;
+    sim->powered = 1;
+    if (sector_erases) {
+        for (i = 0; i < size / sector_size; ++i)
+            sector_erases[i] = 0;
+    }
+
+    if (fstat(sim->fd, &st) != 0 || st.st_size != (off_t)size) {
+        /* a new flash comes erased */
+        if (ftruncate(sim->fd, 0) != 0) {
+            sht_flash_sim_close(sim);
+            return STATUS_ERR_IO;
+        }
+        for (i = 0; i < size; i += sector_size) {
+            if (sht_flash_sim_erase(sim, i) != STATUS_OK) {
+                sht_flash_sim_close(sim);
+                return STATUS_ERR_IO;
+            }
+        }
+        if (sector_erases) {
+            for (i = 0; i < size / sector_size; ++i)
+                sector_erases[i] = 0;
+        }
+    }
+    sim->reads = 0;
+    sim->programs = 0;
+    sim->program_bytes = 0;
+    sim->erases = 0;
+    sim->max_sector_erases = 0;
+    sim->bad_programs = 0;
+    return STATUS_OK;
+}
+
+void sht_flash_sim_close(sht_flash_sim_t* sim) {
+    if (sim->fd >= 0)
+        close(sim->fd);
+    sim->fd = -1;
+}
+
+void sht_flash_sim_power_on(sht_flash_sim_t* sim) {
+    sim->powered = 1;
+}
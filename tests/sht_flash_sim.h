@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief File-backed NOR flash simulation for the flash log
+ *
+ * The simulated flash keeps its contents in a file, so a log survives a
+ * simulated reset by reopening the file. It behaves like NOR flash: an erase
+ * sets a sector to 0xFF and programming can only clear bits.
+ *
+ * The simulation counts reads, programs, programmed bytes and erases, in
+ * total and per sector, to quantify the write amplification and the wear of
+ * a logging configuration: the lifetime is the rated erase cycles divided by
+ * the erase rate of the most erased sector.
+ *
+ * A power cut can be scheduled after a number of program and erase
+ * operations; the operation hit is torn halfway and every further operation
+ * fails until sht_flash_sim_power_on().
+ */
+
+#ifndef SHT_FLASH_SIM_H
+#define SHT_FLASH_SIM_H
+
+#include "sht_flash_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_OK 0
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#define STATUS_ERR_IO (-9)
+
+typedef struct _sht_flash_sim {
+    int fd;
+    uint32_t size;
+    uint32_t sector_size;
+    uint32_t* sector_erases; /* erase count per sector, or NULL */
+    int32_t power_cut_after; /* operations until the power cut, -1 never */
+    uint8_t powered;
+    /* statistics */
+    uint32_t reads;
+    uint32_t programs;
+    uint32_t program_bytes;
+    uint32_t erases;
+    uint32_t max_sector_erases;
+    uint32_t bad_programs; /* programs that needed a bit set */
+} sht_flash_sim_t;
+
+/**
+ * @brief Flash callbacks operating on a sht_flash_sim_t context
+ */
+extern const sht_flash_ops_t sht_flash_sim_ops;
+
+/**
+ * @brief Open the flash file, creating an erased one if it does not exist or
+ * has a different size
+ *
+ * @param[out] sim           the simulation
+ * @param[in]  path          the file
+ * @param[in]  size          the flash size, a multiple of sector_size
+ * @param[in]  sector_size   the erase sector size
+ * @param[in]  sector_erases storage for size / sector_size erase counts,
+ *                           or NULL
+ *
+ * @return 0 on success, else an error code
+ */
+int16_t sht_flash_sim_open(sht_flash_sim_t* sim, const char* path,
+                           uint32_t size, uint32_t sector_size,
+                           uint32_t* sector_erases);
+
+/**
+ * @brief Close the flash file
+ *
+ * @param[in] sim the simulation
+ */
+void sht_flash_sim_close(sht_flash_sim_t* sim);
+
+/**
+ * @brief Restore the power after a power cut
+ *
+ * @param[in] sim the simulation
+ */
+void sht_flash_sim_power_on(sht_flash_sim_t* sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_FLASH_SIM_H */
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sht_i2c_sim.h"
+#include "sensirion_common.h"
+#include "sht3x.h"
+#include "sht4x.h"
+#include "sht_handle.h"
+#include "shtc1.h"
+
+#include <string.h>
+
+#define SHT_I2C_SIM_MAX_WORDS 8
+
+sht_i2c_sim_t sht_i2c_sim;
+
+/* I2C status codes of the sensor drivers */
+#define STATUS_OK 0
+#define STATUS_NACK (-1)
+
+void sht_i2c_sim_init(void) {
+    memset(&sht_i2c_sim, 0, sizeof(sht_i2c_sim));
+    sht_i2c_sim.clock_khz = 100;
+}
+
+static uint8_t sht_i2c_sim_add(uint8_t bus, uint8_t parent, uint8_t channel,
+                               uint8_t addr) {
+    sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[sht_i2c_sim.num_devices];
+
+    dev->bus = bus;
+    dev->parent = parent;
+    dev->channel = channel;
+    dev->addr = addr;
+    dev->present = 1;
+    return sht_i2c_sim.num_devices++;
+}
+
+uint8_t sht_i2c_sim_add_mux(uint8_t bus, uint8_t parent, uint8_t channel,
+                            uint8_t addr) {
+    uint8_t index = sht_i2c_sim_add(bus, parent, channel, addr);
+
+    sht_i2c_sim.devices[index].is_mux = 1;
+    return index;
+}
+
+uint8_t sht_i2c_sim_add_sensor(uint8_t bus, uint8_t parent, uint8_t channel,
+                               uint8_t addr, uint8_t family, uint32_t serial) {
+    uint8_t index = sht_i2c_sim_add(bus, parent, channel, addr);
+    sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[index];
+
+    dev->family = family;
+    dev->serial = serial;
+    dev->t_ticks = 0x6666; /* 25 degC */
+    dev->rh_ticks = 0x8000;
+    return index;
+}
+
+uint8_t sht_i2c_sim_reachable(uint8_t index) {
+    const sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[index];
+    const sht_i2c_sim_device_t* mux;
+
+    if (!dev->present || dev->bus != sht_i2c_sim.bus)
+        return 0;
+    if (dev->parent == SHT_I2C_SIM_ROOT)
+        return 1;
+    mux = &sht_i2c_sim.devices[dev->parent];
+    return (mux->mask >> dev->channel) & 1 ? sht_i2c_sim_reachable(dev->parent)
+                                           : 0;
+}
+
+uint8_t sht_i2c_sim_open_muxes(uint8_t bus) {
+    uint8_t n = 0;
+    uint8_t i;
+
+    for (i = 0; i < sht_i2c_sim.num_devices; ++i) {
+        const sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[i];
+
+        if (dev->is_mux && dev->bus == bus && dev->mask)
+            n++;
+    }
+    return n;
+}
+
+int16_t sht_i2c_sim_set_clock(void* user_data, uint8_t bus,
+                              uint16_t clock_khz) {
+    (void)user_data;
+    (void)bus;
+    sht_i2c_sim.clock_khz = clock_khz;
+    return STATUS_OK;
+}
+
+/* address byte plus count data bytes, 9 clocks each */
+static void sht_i2c_sim_transfer_time(uint16_t count) {
+    uint64_t usec =
+        (uint64_t)(count + 1U) * 9U * 1000U / sht_i2c_sim.clock_khz;
+
+    sht_i2c_sim.now_usec += usec;
+    sht_i2c_sim.bus_usec += usec;
+    sht_i2c_sim.transfers++;
+}
+
+/* conversion time of a measurement command, 0 for other commands */
+static uint32_t sht_i2c_sim_conversion_usec(const sht_i2c_sim_device_t* dev) {
+    switch (dev->family) {
+        case SHT_FAMILY_SHT3X:
+            return (dev->cmd & 0xFF00) == 0x2400 ||
+                           (dev->cmd & 0xFF00) == 0x2C00
+                       ? SHT3X_MEASUREMENT_DURATION_USEC
+                       : 0;
+        case SHT_FAMILY_SHT4X:
+            if (dev->cmd == 0xFD)
+                return SHT4X_MEASUREMENT_DURATION_USEC;
+            return dev->cmd == 0xE0 ? SHT4X_MEASUREMENT_DURATION_LPM_USEC : 0;
+        case SHT_FAMILY_SHTC1:
+            return dev->cmd == 0x7866 || dev->cmd == 0x7CA2 ||
+                           dev->cmd == 0x609C || dev->cmd == 0x6458
+                       ? SHTC1_MEASUREMENT_DURATION_USEC
+                       : 0;
+        default:
+            return 0;
+    }
+}
+
+/* words a sensor answers to its last command */
+static uint8_t sht_i2c_sim_words(sht_i2c_sim_device_t* dev, uint16_t* words) {
+    switch (dev->cmd) {
+        case 0x3780: /* SHT3x serial */
+        case 0x89:   /* SHT4x serial */
+            words[0] = (uint16_t)(dev->serial >> 16);
+            words[1] = (uint16_t)dev->serial;
+            return 2;
+        case 0xC7F7: /* SHTC1 id register, one half per read */
+            words[0] = (uint16_t)(dev->serial >> (dev->serial_pos ? 0 : 16));
+            dev->serial_pos ^= 1;
+            return 1;
+        case 0xEFC8: /* SHTC1 product id */
+            words[0] = 0x0807;
+            return 1;
+        case 0xF32D: /* SHT3x status register */
+            words[0] = 0x0000;
+            return 1;
+        default:
+            words[0] = dev->t_ticks;
+            words[1] = dev->rh_ticks;
+            return 2;
+    }
+}
+
+static void sht_i2c_sim_response(sht_i2c_sim_device_t* dev, uint8_t* data,
+                                 uint16_t count) {
+    uint16_t words[SHT_I2C_SIM_MAX_WORDS];
+    uint8_t num_words;
+    uint16_t i;
+
+    if (dev->is_mux) {
+        memset(data, 0xFF, count);
+        if (count)
+            data[0] = dev->mask;
+        return;
+    }
+
+    num_words = sht_i2c_sim_words(dev, words);
+    for (i = 0; i < count; ++i) {
+        uint16_t w = (uint16_t)(i / 3);
+        uint8_t bytes[2];
+
+        if (w >= num_words) {
+            data[i] = 0xFF;
+            continue;
+        }
+        bytes[0] = (uint8_t)(words[w] >> 8);
+        bytes[1] = (uint8_t)words[w];
+        data[i] = i % 3 < 2 ? bytes[i % 3]
+                            : sensirion_common_generate_crc(bytes, 2);
+    }
+}
+
+/* reachable devices at addr, the collision counted once per transfer */
+static uint8_t sht_i2c_sim_find(uint8_t address, uint8_t* found) {
+    uint8_t n = 0;
+    uint8_t i;
+
+    for (i = 0; i < sht_i2c_sim.num_devices; ++i)
+        if (sht_i2c_sim.devices[i].addr == address &&
+            sht_i2c_sim.devices[i].busy_until_usec <= sht_i2c_sim.now_usec &&
+            sht_i2c_sim_reachable(i))
+            found[n++] = i;
+    if (n == 0)
+        sht_i2c_sim.nacks++;
+    else if (n > 1)
+        sht_i2c_sim.collisions++;
+    return n;
+}
+
+int16_t sensirion_i2c_select_bus(uint8_t bus_idx) {
+    sht_i2c_sim.bus = bus_idx;
+    return STATUS_OK;
+}
+
+void sensirion_i2c_init(void) {
+}
+
+void sensirion_i2c_release(void) {
+}
+
+int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count) {
+    uint8_t found[SHT_I2C_SIM_MAX_DEVICES];
+    uint8_t response[SHT_I2C_SIM_MAX_WORDS * 3];
+    uint8_t n = sht_i2c_sim_find(address, found);
+    uint16_t i;
+    uint8_t k;
+
+    sht_i2c_sim_transfer_time(count);
+    if (n == 0 || count > sizeof(response))
+        return STATUS_NACK;
+
+    memset(data, 0xFF, count);
+    for (k = 0; k < n; ++k) {
+        sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[found[k]];
+
+        sht_i2c_sim_response(dev, response, count);
+        for (i = 0; i < count; ++i)
+            data[i] &= response[i];
+        dev->reads++;
+    }
+    return STATUS_OK;
+}
+
+int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
+                           uint16_t count) {
+    uint8_t found[SHT_I2C_SIM_MAX_DEVICES];
+    uint8_t n = sht_i2c_sim_find(address, found);
+    uint8_t k;
+
+    sht_i2c_sim_transfer_time(count);
+    if (n == 0)
+        return STATUS_NACK;
+
+    for (k = 0; k < n; ++k) {
+        sht_i2c_sim_device_t* dev = &sht_i2c_sim.devices[found[k]];
+
+        if (dev->is_mux) {
+            if (count)
+                dev->mask = data[0];
+        } else if (count) {
+            dev->cmd = count == 1 ? data[0]
+                                  : (uint16_t)((data[0] << 8) | data[1]);
+            if (dev->cmd == 0xC595)
+                dev->serial_pos = 0;
+            dev->busy_until_usec =
+                sht_i2c_sim.now_usec + sht_i2c_sim_conversion_usec(dev);
+        }
+        dev->writes++;
+    }
+    return STATUS_OK;
+}
+
+void sensirion_sleep_usec(uint32_t useconds) {
+    sht_i2c_sim.now_usec += useconds;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Simulated I2C buses with multiplexers and sensors
+ *
+ * The simulation implements the I2C HAL of the library (sensirion_i2c_*() and
+ * sensirion_sleep_usec()) at the byte level. Devices sit either directly on a
+ * bus segment or behind a channel of a simulated TCA9548-style multiplexer,
+ * whose control register is written and read as one byte. A device is
+ * reachable when every mux on its path is reachable and has the channel
+ * enabled.
+ *
+ * A transfer answered by more than one reachable device is counted as a
+ * collision: writes reach all of them and the read data is the wired AND of
+ * their responses, as on a real bus. A transfer nobody answers is a NACK.
+ *
+ * Sensors answer the measurement, serial number and status commands of their
+ * family with CRC protected words. After a measurement command a sensor
+ * NACKs every transfer until its conversion time has passed, as the no
+ * clock stretching commands do on the real parts. Time only advances in
+ * sensirion_sleep_usec() and by the duration of each transfer at the
+ * simulated clock, so the tests are independent of the host.
+ */
+
+#ifndef SHT_I2C_SIM_H
+#define SHT_I2C_SIM_H
+
+#include "sensirion_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SHT_I2C_SIM_MAX_DEVICES
+#define SHT_I2C_SIM_MAX_DEVICES 32
+#endif
+
+/* parent of the devices sitting directly on a bus segment */
+#define SHT_I2C_SIM_ROOT 0xFF
+
+/**
+ * @brief One simulated device, a multiplexer or a sensor
+ */
+typedef struct _sht_i2c_sim_device {
+    uint8_t bus;
+    uint8_t parent;  /* index of the upstream mux, or SHT_I2C_SIM_ROOT */
+    uint8_t channel; /* channel of the upstream mux */
+    uint8_t addr;
+    uint8_t is_mux;
+    uint8_t family;  /* sht_family_t of a sensor */
+    uint8_t present; /* answers on the bus */
+    uint8_t mask;    /* control register of a mux */
+    uint16_t cmd;    /* last command written to a sensor */
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    uint8_t serial_pos; /* next serial word of the SHTC1 id readout */
+    uint32_t serial;
+    uint64_t busy_until_usec; /* converting, NACKs until then */
+    uint32_t writes;
+    uint32_t reads;
+} sht_i2c_sim_device_t;
+
+/**
+ * @brief Simulation state, one instance behind the HAL functions
+ */
+typedef struct _sht_i2c_sim {
+    sht_i2c_sim_device_t devices[SHT_I2C_SIM_MAX_DEVICES];
+    uint8_t num_devices;
+    uint8_t bus;        /* selected bus */
+    uint16_t clock_khz; /* SCL frequency, sets the transfer duration */
+    uint64_t now_usec;
+    uint64_t bus_usec; /* part of now_usec spent in transfers */
+    uint32_t transfers;
+    uint32_t nacks;
+    uint32_t collisions; /* transfers answered by several devices */
+} sht_i2c_sim_t;
+
+extern sht_i2c_sim_t sht_i2c_sim;
+
+/**
+ * @brief Remove all devices and reset time and statistics, 100 kHz clock
+ */
+void sht_i2c_sim_init(void);
+
+/**
+ * @brief Add a multiplexer with all channels disabled
+ *
+ * @param[in] bus     the bus index
+ * @param[in] parent  index of the upstream mux, or SHT_I2C_SIM_ROOT
+ * @param[in] channel channel of the upstream mux
+ * @param[in] addr    7-bit address
+ *
+ * @return the device index
+ */
+uint8_t sht_i2c_sim_add_mux(uint8_t bus, uint8_t parent, uint8_t channel,
+                            uint8_t addr);
+
+/**
+ * @brief Add a sensor
+ *
+ * @param[in] bus     the bus index
+ * @param[in] parent  index of the upstream mux, or SHT_I2C_SIM_ROOT
+ * @param[in] channel channel of the upstream mux
+ * @param[in] addr    7-bit address
+ * @param[in] family  sht_family_t
+ * @param[in] serial  serial number reported by the sensor
+ *
+ * @return the device index
+ */
+uint8_t sht_i2c_sim_add_sensor(uint8_t bus, uint8_t parent, uint8_t channel,
+                               uint8_t addr, uint8_t family, uint32_t serial);
+
+/**
+ * @brief Check whether a device is reachable on the selected bus
+ *
+ * @param[in] index the device index
+ *
+ * @return 1 if reachable, else 0
+ */
+uint8_t sht_i2c_sim_reachable(uint8_t index);
+
+/**
+ * @brief Number of muxes of a bus with at least one channel enabled
+ *
+ * @param[in] bus the bus index
+ *
+ * @return the number of open muxes, reachable or not
+ */
+uint8_t sht_i2c_sim_open_muxes(uint8_t bus);
+
+/**
+ * @brief Clock backend for sht_clock_set_backend(), user data unused
+ */
+int16_t sht_i2c_sim_set_clock(void* user_data, uint8_t bus,
+                              uint16_t clock_khz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_I2C_SIM_H */
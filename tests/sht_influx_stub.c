@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sht_influx_stub.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define SHT_INFLUX_STUB_BODY_MAX 65536
+
+static sht_influx_stub_point_t points[SHT_INFLUX_STUB_MAX_POINTS];
+static uint32_t num_points;
+static uint32_t rejected;
+static int listen_fd = -1;
+static pthread_t thread;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* copy up to an unescaped stop character, unescaping; return the end */
+static const char* parse_name(const char* p, const char* end, const char* stop,
+                              char* out, size_t size) {
+    size_t n = 0;
+
+    while (p < end && !strchr(stop, *p)) {
+        if (*p == '\\' && p + 1 < end)
+            p++;
+        if (n + 1 >= size)
+            return NULL;
+        out[n++] = *p++;
+    }
+    out[n] = '\0';
+    return n ? p : NULL;
+}
+
+/* "key=value" with a float or an integer value ending in i */
+static const char* parse_field(const char* p, const char* end,
+                               sht_influx_stub_point_t* pt) {
+    char key[SHT_INFLUX_STUB_NAME_MAX];
+    char value[32];
+    char* tail;
+    double d;
+    long long i;
+
+    p = parse_name(p, end, "=, \n", key, sizeof(key));
+    if (!p || *p != '=')
+        return NULL;
+    p = parse_name(p + 1, end, ", \n", value, sizeof(value));
+    if (!p)
+        return NULL;
+
+    if (value[strlen(value) - 1] == 'i') {
+        i = strtoll(value, &tail, 10);
+        if (*tail != 'i' || tail[1] != '\0' || strcmp(key, "status") != 0)
+            return NULL;
+        pt->status = i;
+        pt->has_status = 1;
+        return p;
+    }
+    d = strtod(value, &tail);
+    if (*tail != '\0' || tail == value)
+        return NULL;
+    if (strcmp(key, "temperature") == 0)
+        pt->temperature = d;
+    else if (strcmp(key, "humidity") == 0)
+        pt->humidity = d;
+    else
+        return NULL;
+    pt->has_values++;
+    return p;
+}
+
+/* one line, without the newline */
+static int parse_line(const char* p, const char* end,
+                      sht_influx_stub_point_t* pt) {
+    char* tail;
+    const char* tags;
+
+    memset(pt, 0, sizeof(*pt));
+    p = parse_name(p, end, ", ", pt->measurement, sizeof(pt->measurement));
+    if (!p)
+        return -1;
+    if (*p == ',') {
+        tags = ++p;
+        while (p < end && *p != ' ')
+            p += *p == '\\' ? 2 : 1;
+        if ((size_t)(p - tags) >= sizeof(pt->tags) || p == tags)
+            return -1;
+        memcpy(pt->tags, tags, (size_t)(p - tags));
+    }
+    if (p >= end || *p++ != ' ')
+        return -1;
+    for (;;) {
+        p = parse_field(p, end, pt);
+        if (!p || p >= end)
+            return -1;
+        if (*p == ' ')
+            break;
+        if (*p++ != ',')
+            return -1;
+    }
+    if ((pt->has_values != 0 && pt->has_values != 2) ||
+        (pt->has_values && pt->has_status) ||
+        (!pt->has_values && !pt->has_status))
+        return -1;
+    pt->timestamp_ms = strtoull(p + 1, &tail, 10);
+    return tail == end && tail != p + 1 ? 0 : -1;
+}
+
+static int parse_body(const char* body, size_t len) {
+    const char* end = body + len;
+    const char* eol;
+    uint32_t n = num_points;
+
+    while (body < end) {
+        eol = memchr(body, '\n', (size_t)(end - body));
+        if (!eol)
+            eol = end;
+        if (n == SHT_INFLUX_STUB_MAX_POINTS ||
+            parse_line(body, eol, &points[n]) != 0)
+            return -1;
+        n++;
+        body = eol + 1;
+    }
+    num_points = n;
+    return 0;
+}
+
+static void serve(int fd) {
+    static char req[SHT_INFLUX_STUB_BODY_MAX];
+    const char* status = "400 Bad Request";
+    char* body;
+    char* cl;
+    size_t len = 0;
+    size_t want = 0;
+    ssize_t r;
+    const char* query;
+    int valid;
+    char resp[128];
+
+    for (;;) {
+        r = read(fd, req + len, sizeof(req) - 1 - len);
+        if (r <= 0)
+            break;
+        len += (size_t)r;
+        req[len] = '\0';
+        body = strstr(req, "\r\n\r\n");
+        if (!body)
+            continue;
+        body += 4;
+        cl = strstr(req, "Content-Length: ");
+        want = (size_t)(body - req) + (cl ? strtoul(cl + 16, NULL, 10) : 0);
+        if (len >= want)
+            break;
+    }
+
+    pthread_mutex_lock(&lock);
+    body = strstr(req, "\r\n\r\n");
+    valid = body && len == want && strncmp(req, "POST ", 5) == 0 &&
+            (strncmp(req + 5, "/api/v2/write?", 14) == 0 ||
+             strncmp(req + 5, "/write?", 7) == 0) &&
+            (query = strstr(req, "precision=ms")) != NULL &&
+            query < strstr(req, "\r\n");
+    if (valid && parse_body(body + 4, want - (size_t)(body + 4 - req)) == 0)
+        status = "204 No Content";
+    else
+        rejected++;
+    pthread_mutex_unlock(&lock);
+
+    snprintf(resp, sizeof(resp),
+             "HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+             status);
+    if (write(fd, resp, strlen(resp)) < 0)
+        perror("sht_influx_stub");
+    close(fd);
+}
+
+static void* run(void* arg) {
+    int fd;
+
+    (void)arg;
+    while ((fd = accept(listen_fd, NULL, NULL)) >= 0)
+        serve(fd);
+    return NULL;
+}
+
+uint16_t sht_influx_stub_start(void) {
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof(addr);
+
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0)
+        return 0;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, 4) != 0 ||
+        getsockname(listen_fd, (struct sockaddr*)&addr, &addr_len) != 0 ||
+        pthread_create(&thread, NULL, run, NULL) != 0) {
+        close(listen_fd);
+        listen_fd = -1;
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+void sht_influx_stub_stop(void) {
+    shutdown(listen_fd, SHUT_RDWR);
+    close(listen_fd);
+    pthread_join(thread, NULL);
+    listen_fd = -1;
+}
+
+const sht_influx_stub_point_t* sht_influx_stub_points(uint32_t* count) {
+    pthread_mutex_lock(&lock);
+    *count = num_points;
+    pthread_mutex_unlock(&lock);
+    return points;
+}
+
+uint32_t sht_influx_stub_rejected(void) {
+    uint32_t n;
+
+    pthread_mutex_lock(&lock);
+    n = rejected;
+    pthread_mutex_unlock(&lock);
+    return n;
+}
+
+int sht_influx_stub_post(uint16_t port, const char* path, const char* body,
+                         uint32_t len) {
+    struct sockaddr_in addr;
+    char head[256];
+    char resp[256];
+    ssize_t n;
+    int status = -1;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    snprintf(head, sizeof(head),
+             "POST %s HTTP/1.1\r\nHost: localhost\r\n"
+             "Content-Type: text/plain; charset=utf-8\r\n"
+             "Content-Length: %u\r\n\r\n",
+             path, len);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0 &&
+        write(fd, head, strlen(head)) == (ssize_t)strlen(head) &&
+        write(fd, body, len) == (ssize_t)len) {
+        n = read(fd, resp, sizeof(resp) - 1);
+        if (n > 0) {
+            resp[n] = '\0';
+            if (sscanf(resp, "HTTP/1.1 %d", &status) != 1)
+                status = -1;
+        }
+    }
+    close(fd);
+    return status;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Local InfluxDB compatible write endpoint
+ *
+ * A thread serving POST /api/v2/write and /write on a loopback port. Each
+ * request body is parsed as line protocol, as strictly as InfluxDB does for
+ * the subset the library emits: an escaped measurement, tags, float and
+ * integer fields and a millisecond timestamp. A valid body is answered with
+ * 204 and its points are recorded, an invalid one with 400 and nothing is
+ * recorded.
+ */
+
+#ifndef SHT_INFLUX_STUB_H
+#define SHT_INFLUX_STUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_INFLUX_STUB_MAX_POINTS 4096
+#define SHT_INFLUX_STUB_NAME_MAX 64
+
+/**
+ * @brief One recorded point
+ */
+typedef struct _sht_influx_stub_point {
+    char measurement[SHT_INFLUX_STUB_NAME_MAX]; /* unescaped */
+    char tags[SHT_INFLUX_STUB_NAME_MAX];        /* as sent, after the comma */
+    double temperature;
+    double humidity;
+    int64_t status;
+    uint8_t has_values;
+    uint8_t has_status;
+    uint64_t timestamp_ms;
+} sht_influx_stub_point_t;
+
+/**
+ * @brief Start the endpoint on a free loopback port
+ *
+ * @return the port, 0 on error
+ */
+uint16_t sht_influx_stub_start(void);
+
+/**
+ * @brief Stop the endpoint
+ */
+void sht_influx_stub_stop(void);
+
+/**
+ * @brief Points recorded so far, valid until the next request
+ *
+ * @param[out] count the number of points
+ *
+ * @return the points
+ */
+const sht_influx_stub_point_t* sht_influx_stub_points(uint32_t* count);
+
+/**
+ * @brief Number of requests answered with 400
+ */
+uint32_t sht_influx_stub_rejected(void);
+
+/**
+ * @brief POST a body to the endpoint
+ *
+ * @param[in] port  the port of the endpoint
+ * @param[in] path  the request path and query
+ * @param[in] body  the body
+ * @param[in] len   the length of body
+ *
+ * @return the HTTP status, -1 on a connection error
+ */
+int sht_influx_stub_post(uint16_t port, const char* path, const char* body,
+                         uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_INFLUX_STUB_H */
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Minimal MQTT 3.1.1 broker for the integration tests, used when no
+ * mosquitto is installed: clean sessions only, CONNECT, SUBSCRIBE with exact
+ * and "#" filters, PUBLISH with QoS 0 and 1 (forwarded with QoS 0), PINGREQ
+ * and DISCONNECT.
+ *
+ *   sht_mqtt_broker PORT
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define MAX_CLIENTS 16
+#define MAX_FILTERS 4
+#define BUF_SIZE 65536
+
+typedef struct {
+    int fd;
+    size_t len;
+    uint8_t buf[BUF_SIZE];
+    char filters[MAX_FILTERS][64];
+    int num_filters;
+} client_t;
+
+static client_t clients[MAX_CLIENTS];
+
+static void drop(client_t* c) {
+    close(c->fd);
+    c->fd = -1;
+}
+
+static void send_all(client_t* c, const uint8_t* data, size_t len) {
+    if (c->fd >= 0 && send(c->fd, data, len, MSG_NOSIGNAL) != (ssize_t)len)
+        drop(c);
+}
+
+static int matches(const char* filter, const char* topic, size_t topic_len) {
+    size_t n = strlen(filter);
+
+    if (n && filter[n - 1] == '#')
+        return topic_len >= n - 1 && memcmp(filter, topic, n - 1) == 0;
+    return n == topic_len && memcmp(filter, topic, n) == 0;
+}
+
+static void forward(const uint8_t* topic, size_t topic_len,
+                    const uint8_t* payload, size_t payload_len) {
+    static uint8_t out[BUF_SIZE + 16];
+    size_t rem = 2 + topic_len + payload_len;
+    size_t n = 0;
+    int i;
+    int f;
+
+    out[n++] = 0x30;
+    do {
+        out[n++] = (uint8_t)((rem & 0x7F) | (rem > 0x7F ? 0x80 : 0));
+        rem >>= 7;
+    } while (rem);
+    out[n++] = (uint8_t)(topic_len >> 8);
+    out[n++] = (uint8_t)topic_len;
+    memcpy(&out[n], topic, topic_len);
+    n += topic_len;
+    memcpy(&out[n], payload, payload_len);
+    n += payload_len;
+
+    for (i = 0; i < MAX_CLIENTS; ++i) {
+        for (f = 0; clients[i].fd >= 0 && f < clients[i].num_filters; ++f) {
+            if (matches(clients[i].filters[f], (const char*)topic,
+                        topic_len)) {
+                send_all(&clients[i], out, n);
+                break;
+            }
+        }
+    }
+}
+
+/* handle one packet of type byte type and body p[0..len) */
+static void handle(client_t* c, uint8_t type, const uint8_t* p, size_t len) {
+    uint8_t resp[5];
+    size_t topic_len;
+    size_t n;
+
+    switch (type >> 4) {
+        case 1: /* CONNECT */
+            resp[0] = 0x20;
+            resp[1] = 2;
+            resp[2] = 0;
+            resp[3] = 0;
+            send_all(c, resp, 4);
+            break;
+        case 3: /* PUBLISH */
+            if (len < 2)
+                break;
+            topic_len = (size_t)(p[0] << 8 | p[1]);
+            n = 2 + topic_len;
+            if ((type & 0x06) && n + 2 <= len) {
+                resp[0] = 0x40;
+                resp[1] = 2;
+                resp[2] = p[n];
+                resp[3] = p[n + 1];
+                n += 2;
+                forward(&p[2], topic_len, &p[n], len - n);
+                send_all(c, resp, 4);
+            } else if (n <= len) {
+                forward(&p[2], topic_len, &p[n], len - n);
+            }
+            break;
+        case 8: /* SUBSCRIBE */
+            n = 2;
+            while (n + 2 < len) {
+                topic_len = (size_t)(p[n] << 8 | p[n + 1]);
+                if (c->num_filters < MAX_FILTERS && topic_len < 64) {
+                    memcpy(c->filters[c->num_filters], &p[n + 2], topic_len);
+                    c->filters[c->num_filters++][topic_len] = '\0';
+                }
+                n += 2 + topic_len + 1;
+            }
+            resp[0] = 0x90;
+            resp[1] = 3;
+            resp[2] = p[0];
+            resp[3] = p[1];
+            resp[4] = 0;
+            send_all(c, resp, 5);
+            break;
+        case 12: /* PINGREQ */
+            resp[0] = 0xD0;
+            resp[1] = 0;
+            send_all(c, resp, 2);
+            break;
+        case 14: /* DISCONNECT */
+            drop(c);
+            break;
+        default:
+            break;
+    }
+}
+
+/* handle the complete packets in the buffer of a client */
+static void process(client_t* c) {
+    size_t rem;
+    size_t hdr;
+    int shift;
+
+    while (c->fd >= 0 && c->len >= 2) {
+        rem = 0;
+        shift = 0;
+        for (hdr = 1; hdr < c->len && hdr < 5; ++hdr) {
+            rem |= (size_t)(c->buf[hdr] & 0x7F) << shift;
+            shift += 7;
+            if (!(c->buf[hdr] & 0x80))
+                break;
+        }
+        if (hdr >= c->len || c->len < hdr + 1 + rem)
+            return;
+        handle(c, c->buf[0], &c->buf[hdr + 1], rem);
+        if (c->fd < 0)
+            return;
+        memmove(c->buf, &c->buf[hdr + 1 + rem], c->len - (hdr + 1 + rem));
+        c->len -= hdr + 1 + rem;
+    }
+}
+
+int main(int argc, char** argv) {
+    struct pollfd fds[MAX_CLIENTS + 1];
+    struct sockaddr_in addr;
+    int listen_fd;
+    int one = 1;
+    int i;
+    int fd;
+    ssize_t r;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s PORT\n", argv[0]);
+        return 2;
+    }
+    signal(SIGPIPE, SIG_IGN);
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons((uint16_t)atoi(argv[1]));
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, 8) != 0) {
+        perror("sht_mqtt_broker");
+        return 1;
+    }
+    for (i = 0; i < MAX_CLIENTS; ++i)
+        clients[i].fd = -1;
+
+    for (;;) {
+        fds[0].fd = listen_fd;
+        fds[0].events = POLLIN;
+        for (i = 0; i < MAX_CLIENTS; ++i) {
+            fds[i + 1].fd = clients[i].fd;
+            fds[i + 1].events = POLLIN;
+        }
+        if (poll(fds, MAX_CLIENTS + 1, -1) < 0)
+            return 1;
+        if (fds[0].revents & POLLIN) {
+            fd = accept(listen_fd, NULL, NULL);
+            for (i = 0; fd >= 0 && i < MAX_CLIENTS; ++i) {
+                if (clients[i].fd < 0) {
+                    clients[i].fd = fd;
+                    clients[i].len = 0;
+                    clients[i].num_filters = 0;
+                    break;
+                }
+            }
+            if (fd >= 0 && i == MAX_CLIENTS)
+                close(fd);
+        }
+        for (i = 0; i < MAX_CLIENTS; ++i) {
+            client_t* c = &clients[i];
+
+            if (c->fd < 0 || !(fds[i + 1].revents & (POLLIN | POLLHUP)))
+                continue;
+            r = read(c->fd, c->buf + c->len, BUF_SIZE - c->len);
+            if (r <= 0) {
+                drop(c);
+                continue;
+            }
+            c->len += (size_t)r;
+            process(c);
+        }
+    }
+}
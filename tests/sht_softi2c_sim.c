@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Simulated GPIO bus implementation
+ */
+
+#include "sht_softi2c_sim.h"
+
+enum {
+    SHT_SOFTI2C_SIM_IDLE, /* waiting for a start condition */
+    SHT_SOFTI2C_SIM_RX,   /* receiving the address or data */
+    SHT_SOFTI2C_SIM_TX,   /* transmitting the response */
+    SHT_SOFTI2C_SIM_SKIP  /* not addressed, waiting for start or stop */
+};
+
+static uint8_t sht_softi2c_sim_master(const sht_softi2c_sim_t* sim,
+                                      uint8_t pin) {
+    return sim->output[pin] ? sim->latch[pin] : 1;
+}
+
+static uint8_t sht_softi2c_sim_tx_bit(const sht_softi2c_sim_t* sim) {
+    uint8_t byte = sim->tx_pos < sim->response_len
+                       ? sim->response[sim->tx_pos]
+                       : 0xFF;
+    return (uint8_t)((byte >> (7 - sim->bit)) & 1);
+}
+
+static void sht_softi2c_sim_scl_rise(sht_softi2c_sim_t* sim) {
+    if (sim->state == SHT_SOFTI2C_SIM_RX && sim->bit < 8) {
+        sim->shift = (uint8_t)((sim->shift << 1) | sim->sda);
+        sim->bit++;
+    } else if (sim->state == SHT_SOFTI2C_SIM_TX && sim->bit == 8) {
+        sim->nack = sim->sda;
+    }
+}
+
+static void sht_softi2c_sim_scl_fall(sht_softi2c_sim_t* sim) {
+    if (sim->state == SHT_SOFTI2C_SIM_RX) {
+        if (sim->bit == 8) {
+            /* byte complete, acknowledge during the 9th clock */
+            if (sim->reading == 0xFF) {
+                if ((sim->shift >> 1) != sim->addr) {
+                    sim->state = SHT_SOFTI2C_SIM_SKIP;
+                    return;
+                }
+                sim->reading = sim->shift & 1;
+                sim->written_len = sim->reading ? sim->written_len : 0;
+            } else if (sim->written_len < SHT_SOFTI2C_SIM_BUFFER_SIZE) {
+                sim->written[sim->written_len++] = sim->shift;
+            }
+            sim->slave_sda = 0;
+            sim->bit = 9;
+        } else if (sim->bit == 9) {
+            sim->slave_sda = 1;
+            sim->bit = 0;
+            sim->shift = 0;
+            if (sim->reading == 1) {
+                if (sim->stretch_usec)
+                    sim->stretch_until = sim->now_usec + sim->stretch_usec;
+                sim->state = SHT_SOFTI2C_SIM_TX;
+                sim->tx_pos = 0;
+                sim->slave_sda = sht_softi2c_sim_tx_bit(sim);
+            }
+        }
+    } else if (sim->state == SHT_SOFTI2C_SIM_TX) {
+        if (sim->bit < 7) {
+            sim->bit++;
+            sim->slave_sda = sht_softi2c_sim_tx_bit(sim);
+        } else if (sim->bit == 7) {
+            /* release SDA for the master's acknowledge */
+            sim->bit = 8;
+            sim->slave_sda = 1;
+        } else if (sim->nack) {
+            sim->state = SHT_SOFTI2C_SIM_SKIP;
+        } else {
+            sim->bit = 0;
+            sim->tx_pos++;
+            sim->slave_sda = sht_softi2c_sim_tx_bit(sim);
+        }
+    }
+}
+
+/* start and stop conditions are legal between bytes; the clock rising to
+ * generate them samples a first bit */
+static uint8_t sht_softi2c_sim_between_bytes(const sht_softi2c_sim_t* sim) {
+    return sim->state == SHT_SOFTI2C_SIM_IDLE ||
+           sim->state == SHT_SOFTI2C_SIM_SKIP ||
+           (sim->state == SHT_SOFTI2C_SIM_RX && sim->bit <= 1);
+}
+
+/* recompute the line levels and let the slave react to the edges */
+static void sht_softi2c_sim_update(sht_softi2c_sim_t* sim) {
+    uint8_t stretching = (int32_t)(sim->stretch_until - sim->now_usec) > 0;
+    uint8_t scl = sht_softi2c_sim_master(sim, SHT_SOFTI2C_SIM_SCL) &&
+                  !stretching;
+    uint8_t sda;
+    uint32_t d;
+
+    if (scl != sim->scl) {
+        d = sim->now_usec - sim->scl_changed_usec;
+        if (sim->scl && d < sim->min_scl_high_usec)
+            sim->min_scl_high_usec = d;
+        if (!sim->scl && d < sim->min_scl_low_usec)
+            sim->min_scl_low_usec = d;
+        sim->scl_changed_usec = sim->now_usec;
+        sim->scl = scl;
+        sim->scl_edges++;
+        if (scl)
+            sht_softi2c_sim_scl_rise(sim);
+        else
+            sht_softi2c_sim_scl_fall(sim);
+    }
+
+    sda = sht_softi2c_sim_master(sim, SHT_SOFTI2C_SIM_SDA) && sim->slave_sda;
+    if (sda == sim->sda)
+        return;
+    sim->sda = sda;
+    sim->sda_edges++;
+    if (!sim->scl)
+        return;
+
+    if (!sht_softi2c_sim_between_bytes(sim))
+        sim->violations++;
+    if (!sda) {
+        /* start or repeated start */
+        sim->state = SHT_SOFTI2C_SIM_RX;
+        sim->bit = 0;
+        sim->shift = 0;
+        sim->reading = 0xFF;
+        sim->start_usec = sim->now_usec;
+    } else {
+        /* stop */
+        sim->state = SHT_SOFTI2C_SIM_IDLE;
+        sim->slave_sda = 1;
+        sim->transaction_usec = sim->now_usec - sim->start_usec;
+    }
+}
+
+static void sht_softi2c_sim_write(void* ctx, uint8_t pin, uint8_t level) {
+    sht_softi2c_sim_t* sim = (sht_softi2c_sim_t*)ctx;
+
+    sim->gpio_ops++;
+    sim->latch[pin] = level != 0;
+    sht_softi2c_sim_update(sim);
+}
+
+static void sht_softi2c_sim_direction(void* ctx, uint8_t pin, uint8_t output) {
+    sht_softi2c_sim_t* sim = (sht_softi2c_sim_t*)ctx;
+
+    sim->gpio_ops++;
+    sim->output[pin] = output != 0;
+    sht_softi2c_sim_update(sim);
+}
+
+static uint8_t sht_softi2c_sim_read(void* ctx, uint8_t pin) {
+    sht_softi2c_sim_t* sim = (sht_softi2c_sim_t*)ctx;
+
+    sim->gpio_ops++;
+    sht_softi2c_sim_update(sim);
+    return pin == SHT_SOFTI2C_SIM_SCL ? sim->scl : sim->sda;
+}
+
+static void sht_softi2c_sim_delay(void* ctx, uint16_t usec) {
+    sht_softi2c_sim_t* sim = (sht_softi2c_sim_t*)ctx;
+
+    sim->now_usec += usec;
+    sht_softi2c_sim_update(sim);
+}
+
+const sht_softi2c_gpio_t sht_softi2c_sim_gpio = {
+    sht_softi2c_sim_write, sht_softi2c_sim_direction, sht_softi2c_sim_read,
+    sht_softi2c_sim_delay};
+
+void sht_softi2c_sim_init(sht_softi2c_sim_t* sim, uint8_t addr) {
+    uint8_t i;
+
+    sim->addr = addr;
+    sim->stretch_usec = 0;
+    sim->response_len = 0;
+    sim->written_len = 0;
+    for (i = 0; i < 2; ++i) {
+        sim->latch[i] = 1;
+        sim->output[i] = 1;
+    }
+    sim->scl = 1;
+    sim->sda = 1;
+    sim->state = SHT_SOFTI2C_SIM_IDLE;
+    sim->bit = 0;
+    sim->shift = 0;
+    sim->reading = 0xFF;
+    sim->nack = 0;
+    sim->slave_sda = 1;
+    sim->tx_pos = 0;
+    sim->now_usec = 0;
+    sim->stretch_until = 0;
+    sim->start_usec = 0;
+    sim->transaction_usec = 0;
+    sht_softi2c_sim_reset_stats(sim);
+}
+
+void sht_softi2c_sim_reset_stats(sht_softi2c_sim_t* sim) {
+    sim->scl_edges = 0;
+    sim->sda_edges = 0;
+    sim->gpio_ops = 0;
+    sim->violations = 0;
+    sim->scl_changed_usec = sim->now_usec;
+    sim->min_scl_high_usec = UINT32_MAX;
+    sim->min_scl_low_usec = UINT32_MAX;
+}
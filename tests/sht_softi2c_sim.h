@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Simulated GPIO bus for the bit-banged I2C master
+ *
+ * The simulation models the two open drain lines wired to the master's GPIOs
+ * and to one I2C slave. The slave acknowledges its address, records the
+ * written bytes, answers reads from a response buffer and may stretch the
+ * clock after acknowledging its address. Time only advances in the delay
+ * callback, so timing is checked in simulated microseconds and independent
+ * of the host.
+ *
+ * The simulation counts the edges of both lines, flags protocol violations
+ * (SDA changing while SCL is high outside of start and stop conditions) and
+ * records the shortest SCL high and low periods and the duration of the last
+ * transaction, to validate a clock setting and to measure the cost of a
+ * transaction in GPIO operations.
+ */
+
+#ifndef SHT_SOFTI2C_SIM_H
+#define SHT_SOFTI2C_SIM_H
+
+#include "sht_softi2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_SOFTI2C_SIM_SCL 0
+#define SHT_SOFTI2C_SIM_SDA 1
+
+#ifndef SHT_SOFTI2C_SIM_BUFFER_SIZE
+#define SHT_SOFTI2C_SIM_BUFFER_SIZE 32
+#endif
+
+/**
+ * @brief Simulated lines and slave
+ */
+typedef struct _sht_softi2c_sim {
+    /* slave configuration */
+    uint8_t addr;
+    uint16_t stretch_usec; /* clock stretch after the address ACK */
+    uint8_t response[SHT_SOFTI2C_SIM_BUFFER_SIZE];
+    uint8_t response_len;
+    /* bytes written by the master in the last write transfer */
+    uint8_t written[SHT_SOFTI2C_SIM_BUFFER_SIZE];
+    uint8_t written_len;
+
+    /* master pins: output latch and direction */
+    uint8_t latch[2];
+    uint8_t output[2];
+    /* line levels */
+    uint8_t scl;
+    uint8_t sda;
+
+    /* slave state */
+    uint8_t state;
+    uint8_t bit;
+    uint8_t shift;
+    uint8_t reading;
+    uint8_t nack;
+    uint8_t slave_sda;
+    uint8_t tx_pos;
+    uint32_t stretch_until;
+
+    /* statistics */
+    uint32_t now_usec;
+    uint32_t scl_edges;
+    uint32_t sda_edges;
+    uint32_t gpio_ops; /* write, direction and read callbacks */
+    uint32_t violations;
+    uint32_t scl_changed_usec;
+    uint32_t min_scl_high_usec;
+    uint32_t min_scl_low_usec;
+    uint32_t start_usec;       /* time of the last start condition */
+    uint32_t transaction_usec; /* start to stop of the last transaction */
+} sht_softi2c_sim_t;
+
+/**
+ * @brief GPIO callbacks operating on a sht_softi2c_sim_t context, pins
+ * SHT_SOFTI2C_SIM_SCL and SHT_SOFTI2C_SIM_SDA
+ */
+extern const sht_softi2c_gpio_t sht_softi2c_sim_gpio;
+
+/**
+ * @brief Initialize the simulation with idle lines and a slave at addr
+ *
+ * @param[out] sim  the simulation
+ * @param[in]  addr the 7-bit slave address
+ */
+void sht_softi2c_sim_init(sht_softi2c_sim_t* sim, uint8_t addr);
+
+/**
+ * @brief Reset the edge, operation and timing statistics
+ *
+ * @param[in] sim the simulation
+ */
+void sht_softi2c_sim_reset_stats(sht_softi2c_sim_t* sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_SOFTI2C_SIM_H */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* mkdtemp(), nftw(), symlink() */
+#define _XOPEN_SOURCE 700
+
+#include "sht_sysfs_tree.h"
+
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* mkdir -p of root/rel */
+static int sht_sysfs_tree_mkdirs(const char* root, const char* rel) {
+    char path[SHT_SYSFS_TREE_PATH_MAX];
+    char* p;
+
+    if (snprintf(path, sizeof(path), "%s/%s", root, rel) >= (int)sizeof(path))
+        return -1;
+    for (p = path + strlen(root) + 1; (p = strchr(p, '/')) != NULL; ++p) {
+        *p = '\0';
+        if (mkdir(path, 0755) != 0 && access(path, F_OK) != 0)
+            return -1;
+        *p = '/';
+    }
+    return mkdir(path, 0755) == 0 || access(path, F_OK) == 0 ? 0 : -1;
+}
+
+static int sht_sysfs_tree_put(const char* dir, const char* attr,
+                              const char* value) {
+    char path[SHT_SYSFS_TREE_PATH_MAX];
+    FILE* f;
+    int ret;
+
+    if (snprintf(path, sizeof(path), "%s/%s", dir, attr) >= (int)sizeof(path))
+        return -1;
+    f = fopen(path, "w");
+    if (!f)
+        return -1;
+    ret = fprintf(f, "%s\n", value) < 0 ? -1 : 0;
+    return fclose(f) == 0 ? ret : -1;
+}
+
+/* the device directory below devices/ and the class link to it */
+static int sht_sysfs_tree_device(const char* root, const char* class_dir,
+                                 const char* node, const char* name,
+                                 int i2c_bus, uint8_t addr, char* dir) {
+    char rel[SHT_SYSFS_TREE_PATH_MAX / 2];
+    char link[SHT_SYSFS_TREE_PATH_MAX];
+
+    snprintf(rel, sizeof(rel), "devices/i2c-%d/%d-%04x/%s", i2c_bus, i2c_bus,
+             addr, node);
+    if (sht_sysfs_tree_mkdirs(root, rel) != 0 ||
+        sht_sysfs_tree_mkdirs(root, class_dir) != 0)
+        return -1;
+    if (snprintf(dir, SHT_SYSFS_TREE_PATH_MAX, "%s/%s", root, rel) >=
+            SHT_SYSFS_TREE_PATH_MAX ||
+        snprintf(link, sizeof(link), "%s/%s/%s", root, class_dir,
+                 strrchr(node, '/') ? strrchr(node, '/') + 1 : node) >=
+            (int)sizeof(link))
+        return -1;
+    if (symlink(dir, link) != 0)
+        return -1;
+    return sht_sysfs_tree_put(dir, "name", name);
+}
+
+int sht_sysfs_tree_create(char* root) {
+    snprintf(root, SHT_SYSFS_TREE_PATH_MAX, "/tmp/sht-sysfs-XXXXXX");
+    return mkdtemp(root) ? 0 : -1;
+}
+
+static int sht_sysfs_tree_rm(const char* path, const struct stat* st,
+                             int type, struct FTW* ftw) {
+    (void)st;
+    (void)type;
+    (void)ftw;
+    return remove(path);
+}
+
+void sht_sysfs_tree_remove(const char* root) {
+    nftw(root, sht_sysfs_tree_rm, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+int sht_sysfs_tree_add_hwmon(const char* root, int index, const char* name,
+                             int i2c_bus, uint8_t addr, int32_t t_milli,
+                             int32_t rh_milli) {
+    char dir[SHT_SYSFS_TREE_PATH_MAX];
+    char node[32];
+    char value[16];
+
+    snprintf(node, sizeof(node), "hwmon/hwmon%d", index);
+    if (sht_sysfs_tree_device(root, "class/hwmon", node, name, i2c_bus, addr,
+                              dir) != 0)
+        return -1;
+    snprintf(value, sizeof(value), "%ld", (long)t_milli);
+    if (sht_sysfs_tree_put(dir, "temp1_input", value) != 0)
+        return -1;
+    snprintf(value, sizeof(value), "%ld", (long)rh_milli);
+    return sht_sysfs_tree_put(dir, "humidity1_input", value);
+}
+
+int sht_sysfs_tree_add_iio(const char* root, int index, const char* name,
+                           int i2c_bus, uint8_t addr, long t_raw,
+                           const char* t_scale, const char* t_offset,
+                           long rh_raw, const char* rh_scale) {
+    char dir[SHT_SYSFS_TREE_PATH_MAX];
+    char node[32];
+    char value[24];
+
+    snprintf(node, sizeof(node), "iio:device%d", index);
+    if (sht_sysfs_tree_device(root, "bus/iio/devices", node, name, i2c_bus,
+                              addr, dir) != 0)
+        return -1;
+    snprintf(value, sizeof(value), "%ld", t_raw);
+    if (sht_sysfs_tree_put(dir, "in_temp_raw", value) != 0 ||
+        sht_sysfs_tree_put(dir, "in_temp_scale", t_scale) != 0 ||
+        sht_sysfs_tree_put(dir, "in_temp_offset", t_offset) != 0)
+        return -1;
+    snprintf(value, sizeof(value), "%ld", rh_raw);
+    if (sht_sysfs_tree_put(dir, "in_humidityrelative_raw", value) != 0)
+        return -1;
+    return sht_sysfs_tree_put(dir, "in_humidityrelative_scale", rh_scale);
+}
+
+int sht_sysfs_tree_write(const char* root, const char* dir, const char* attr,
+                         const char* value) {
+    char path[SHT_SYSFS_TREE_PATH_MAX];
+
+    snprintf(path, sizeof(path), "%s/%s", root, dir);
+    return sht_sysfs_tree_put(path, attr, value);
+}
+
+int sht_sysfs_tree_unlink(const char* root, const char* dir, const char* attr) {
+    char path[SHT_SYSFS_TREE_PATH_MAX];
+
+    snprintf(path, sizeof(path), "%s/%s/%s", root, dir, attr);
+    return unlink(path);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Fake sysfs trees for the sysfs backend
+ *
+ * Builds the part of sysfs the backend looks at in a temporary directory:
+ * the device directories below devices/, named after the I2C bus and address
+ * as the I2C core does, and the class/hwmon and bus/iio/devices links to
+ * them. Attributes are plain files, so a test changes a measurement by
+ * rewriting one.
+ */
+
+#ifndef SHT_SYSFS_TREE_H
+#define SHT_SYSFS_TREE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHT_SYSFS_TREE_PATH_MAX 256
+
+/**
+ * @brief Create an empty tree in a new temporary directory
+ *
+ * @param[out] root the path of the tree, SHT_SYSFS_TREE_PATH_MAX bytes
+ *
+ * @return 0 on success, -1 on error
+ */
+int sht_sysfs_tree_create(char* root);
+
+/**
+ * @brief Remove a tree
+ *
+ * @param[in] root the path of the tree
+ */
+void sht_sysfs_tree_remove(const char* root);
+
+/**
+ * @brief Add a hwmon device with temp1_input and humidity1_input
+ *
+ * @param[in] root      the path of the tree
+ * @param[in] index     the hwmon index, unique in the tree
+ * @param[in] name      the driver name
+ * @param[in] i2c_bus   the I2C adapter number
+ * @param[in] addr      the 7-bit address
+ * @param[in] t_milli   the temperature in milli degree Celsius
+ * @param[in] rh_milli  the relative humidity in milli percent
+ *
+ * @return 0 on success, -1 on error
+ */
+int sht_sysfs_tree_add_hwmon(const char* root, int index, const char* name,
+                             int i2c_bus, uint8_t addr, int32_t t_milli,
+                             int32_t rh_milli);
+
+/**
+ * @brief Add an IIO device with raw, scale and offset attributes
+ *
+ * @param[in] root      the path of the tree
+ * @param[in] index     the IIO device index, unique in the tree
+ * @param[in] name      the driver name
+ * @param[in] i2c_bus   the I2C adapter number
+ * @param[in] addr      the 7-bit address
+ * @param[in] t_raw     in_temp_raw
+ * @param[in] t_scale   in_temp_scale
+ * @param[in] t_offset  in_temp_offset
+ * @param[in] rh_raw    in_humidityrelative_raw
+ * @param[in] rh_scale  in_humidityrelative_scale
+ *
+ * @return 0 on success, -1 on error
+ */
+int sht_sysfs_tree_add_iio(const char* root, int index, const char* name,
+                           int i2c_bus, uint8_t addr, long t_raw,
+                           const char* t_scale, const char* t_offset,
+                           long rh_raw, const char* rh_scale);
+
+/**
+ * @brief Write an attribute of a device, creating it if needed
+ *
+ * @param[in] root  the path of the tree
+ * @param[in] dir   the device link relative to root, e.g. class/hwmon/hwmon0
+ * @param[in] attr  the attribute name
+ * @param[in] value the new content, a newline is appended
+ *
+ * @return 0 on success, -1 on error
+ */
+int sht_sysfs_tree_write(const char* root, const char* dir, const char* attr,
+                         const char* value);
+
+/**
+ * @brief Remove an attribute of a device
+ *
+ * @return 0 on success, -1 on error
+ */
+int sht_sysfs_tree_unlink(const char* root, const char* dir, const char* attr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_SYSFS_TREE_H */
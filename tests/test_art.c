@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Dynamic ART switching on the simulated bus: a stable signal keeps the base
+ * rate, a fast change switches to ART and re-initializes the fetch schedule,
+ * and the sensor goes back to the base rate once the signal stayed calm for
+ * the hold time. Rate thresholds above 71.6 units/s must not overflow the
+ * comparison at the 60 s interval cap.
+ */
+
+#include "sht3x_art.h"
+#include "sht_i2c_sim.h"
+#include "sht_sample.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define CMD_1_MPS_HPM 0x2130
+#define CMD_ART 0x2B32
+#define CMD_BREAK 0x3093
+
+static int failures;
+
+static uint8_t dev;
+
+static void setup(void) {
+    sht_i2c_sim_init();
+    dev = sht_i2c_sim_add_sensor(0, SHT_I2C_SIM_ROOT, 0, SHT3X_I2C_ADDR_DFLT,
+                                 SHT_FAMILY_SHT3X, 1);
+}
+
+static void test_switching(void) {
+    /* 0.5 degC/s or 2 %RH/s enter ART, below 0.1 degC/s and 0.5 %RH/s for
+     * 10 s leave it */
+    static const sht3x_art_policy_t policy = {
+        SHT3X_PERIODIC_1_MPS, SHT3X_MEAS_MODE_HPM, 500, 2000, 100, 500,
+        10000};
+    sht3x_art_state_t state;
+    sht3x_fetch_sched_entry_t sched;
+    uint32_t t;
+    int32_t temperature = 25000;
+
+    setup();
+    CHECK(sht3x_art_init(&policy, &state, SHT3X_I2C_ADDR_DFLT) == STATUS_OK);
+    CHECK(sht_i2c_sim.devices[dev].cmd == CMD_1_MPS_HPM);
+    (void)sht3x_fetch_sched_init(&sched, SHT3X_I2C_ADDR_DFLT,
+                                 policy.base_rate, 0);
+
+    /* 0.05 degC/s: stable */
+    for (t = 0; t < 20000; t += 1000) {
+        CHECK(sht3x_art_update(&policy, &state, t, temperature, 50000, &sched,
+                               t * 1000) == STATUS_OK);
+        temperature += 50;
+    }
+    CHECK(!state.art && state.switches == 0);
+    CHECK(sched.period_usec == 1000000);
+
+    /* 1 degC within a second */
+    temperature += 1000;
+    CHECK(sht3x_art_update(&policy, &state, t, temperature, 50000, &sched,
+                           t * 1000) == STATUS_OK);
+    CHECK(state.art && state.switches == 1);
+    CHECK(sht_i2c_sim.devices[dev].cmd == CMD_ART);
+    CHECK(sched.period_usec == 250000);
+    CHECK(sched.state == SHT3X_FETCH_SCHED_ACQUIRE);
+
+    /* calm at 4 mps: ART is held for 10 s, the humidity moving at 1 %RH/s
+     * restarts the hold */
+    for (t += 250; t < 25000; t += 250)
+        CHECK(sht3x_art_update(&policy, &state, t, temperature, 50000, &sched,
+                               t * 1000) == STATUS_OK);
+    CHECK(state.art);
+    CHECK(sht3x_art_update(&policy, &state, t, temperature, 50250, &sched,
+                           t * 1000) == STATUS_OK);
+    for (t += 250; t < 35000; t += 250)
+        CHECK(sht3x_art_update(&policy, &state, t, temperature, 50250, &sched,
+                               t * 1000) == STATUS_OK);
+    CHECK(state.art && state.switches == 1);
+    for (; t <= 36000; t += 250)
+        CHECK(sht3x_art_update(&policy, &state, t, temperature, 50250, &sched,
+                               t * 1000) == STATUS_OK);
+    CHECK(!state.art && state.switches == 2);
+    CHECK(sht_i2c_sim.devices[dev].cmd == CMD_1_MPS_HPM);
+    CHECK(sched.period_usec == 1000000);
+}
+
+static void test_high_rate(void) {
+    /* a threshold of 71.583 degC/s times 60 s passes 2^32 */
+    static const sht3x_art_policy_t policy = {
+        SHT3X_PERIODIC_0_5_MPS, SHT3X_MEAS_MODE_HPM, 71583, 71583, 100, 500,
+        10000};
+    sht3x_art_state_t state;
+
+    setup();
+    CHECK(sht3x_art_init(&policy, &state, SHT3X_I2C_ADDR_DFLT) == STATUS_OK);
+    CHECK(sht3x_art_update(&policy, &state, 0, 25000, 50000, NULL, 0) ==
+          STATUS_OK);
+    /* 1 degC in a minute is far below the threshold */
+    CHECK(sht3x_art_update(&policy, &state, 60000, 26000, 50000, NULL, 0) ==
+          STATUS_OK);
+    CHECK(!state.art && state.switches == 0);
+    /* 80 degC in a second is above */
+    CHECK(sht3x_art_update(&policy, &state, 61000, 106000, 50000, NULL, 0) ==
+          STATUS_OK);
+    CHECK(state.art && state.switches == 1);
+}
+
+int main(void) {
+    test_switching();
+    test_high_rate();
+    if (failures) {
+        printf("test_art: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_art: ok\n");
+    return 0;
+}
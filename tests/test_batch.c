@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Struct-of-arrays batches: samples survive the round trip through the
+ * columns, the column conversion matches sht_raw_sample_convert() for every
+ * tick value of every family, thresholds skip failed reads, the absolute
+ * humidity column matches the per-sample conversion and a sweep is collected
+ * into batches smaller than the sweep.
+ */
+
+#include "sensirion_humidity_conversion.h"
+#include "sht_batch.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define CAPACITY 256
+#define NUM_SENSORS 5
+
+static int failures;
+
+SHT_BATCH_DEFINE(batch, CAPACITY);
+
+static int32_t temperature[CAPACITY];
+static int32_t humidity[CAPACITY];
+static uint32_t absolute[CAPACITY];
+static uint8_t flags[CAPACITY];
+
+static void test_add_get(void) {
+    sht_raw_sample_t in;
+    sht_raw_sample_t out;
+    uint16_t i;
+
+    sht_batch_clear(&batch);
+    CHECK(batch.capacity == CAPACITY && batch.count == 0);
+    memset(&in, 0, sizeof(in));
+    for (i = 0; i < CAPACITY; ++i) {
+        in.timestamp_ms = 0xFFFF0000U + i;
+        in.sensor_id = (uint16_t)(1000 + i);
+        in.seq = i;
+        in.t_ticks = (uint16_t)(i * 257);
+        in.rh_ticks = (uint16_t)~in.t_ticks;
+        in.status = (int16_t)(i % 3 ? 0 : -1);
+        in.bus = 3;
+        in.family = (uint8_t)(i % 3);
+        CHECK(sht_batch_add(&batch, &in) == STATUS_OK);
+    }
+    CHECK(batch.count == CAPACITY);
+    CHECK(sht_batch_add(&batch, &in) == STATUS_ERR_NO_SPACE);
+    CHECK(batch.count == CAPACITY);
+
+    for (i = 0; i < CAPACITY; ++i) {
+        memset(&out, 0xA5, sizeof(out));
+        sht_batch_get(&batch, i, &out);
+        CHECK(out.timestamp_ms == 0xFFFF0000U + i);
+        CHECK(out.sensor_id == 1000 + i);
+        CHECK(out.t_ticks == (uint16_t)(i * 257));
+        CHECK(out.rh_ticks == (uint16_t) ~(uint16_t)(i * 257));
+        CHECK(out.status == (i % 3 ? 0 : -1));
+        CHECK(out.family == i % 3);
+        /* not stored */
+        CHECK(out.seq == 0 && out.bus == 0);
+    }
+
+    sht_batch_clear(&batch);
+    CHECK(batch.count == 0);
+}
+
+/* every tick value of every family, with the humidity ticks running the
+ * other way so that swapped columns show */
+static void test_convert(void) {
+    static const uint8_t families[] = {SHT_FAMILY_SHT3X, SHT_FAMILY_SHT4X,
+                                       SHT_FAMILY_SHTC1};
+    sht_raw_sample_t sample;
+    int32_t t, rh;
+    uint32_t ticks;
+    uint16_t i;
+    uint8_t f;
+
+    memset(&sample, 0, sizeof(sample));
+    for (f = 0; f < sizeof(families); ++f) {
+        sample.family = families[f];
+        for (ticks = 0; ticks < 0x10000; ticks += CAPACITY) {
+            sht_batch_clear(&batch);
+            for (i = 0; i < CAPACITY; ++i) {
+                sample.t_ticks = (uint16_t)(ticks + i);
+                sample.rh_ticks = (uint16_t)(0xFFFF - ticks - i);
+                sht_batch_add(&batch, &sample);
+            }
+            sht_batch_convert(&batch, temperature, humidity);
+            for (i = 0; i < CAPACITY; ++i) {
+                sample.t_ticks = (uint16_t)(ticks + i);
+                sample.rh_ticks = (uint16_t)(0xFFFF - ticks - i);
+                sht_raw_sample_convert(&sample, &t, &rh);
+                CHECK(temperature[i] == t);
+                CHECK(humidity[i] == rh);
+            }
+        }
+    }
+
+    /* mixed families in one batch */
+    sht_batch_clear(&batch);
+    for (i = 0; i < CAPACITY; ++i) {
+        sample.family = families[i % 3];
+        sample.t_ticks = (uint16_t)(i * 251);
+        sample.rh_ticks = (uint16_t)(i * 253);
+        sht_batch_add(&batch, &sample);
+    }
+    sht_batch_convert(&batch, temperature, humidity);
+    for (i = 0; i < CAPACITY; ++i) {
+        sht_batch_get(&batch, i, &sample);
+        sht_raw_sample_convert(&sample, &t, &rh);
+        CHECK(temperature[i] == t && humidity[i] == rh);
+    }
+}
+
+static void test_threshold(void) {
+    sht_raw_sample_t sample;
+    uint16_t expected = 0;
+    uint16_t i;
+    uint8_t want;
+
+    memset(&sample, 0, sizeof(sample));
+    sample.family = SHT_FAMILY_SHT3X;
+    sht_batch_clear(&batch);
+    for (i = 0; i < CAPACITY; ++i) {
+        sample.t_ticks = (uint16_t)(i * 256);
+        sample.status = (int16_t)(i % 5 ? 0 : -1);
+        sht_batch_add(&batch, &sample);
+    }
+    sht_batch_convert(&batch, temperature, humidity);
+
+    /* limits that fall on sample values: equal is inside */
+    CHECK(sht_batch_threshold(&batch, temperature, temperature[64],
+                              temperature[192], flags) > 0);
+    for (i = 0; i < CAPACITY; ++i) {
+        want = 0;
+        if (i % 5) {
+            if (i < 64)
+                want = SHT_BATCH_BELOW;
+            else if (i > 192)
+                want = SHT_BATCH_ABOVE;
+        }
+        CHECK(flags[i] == want);
+        expected = (uint16_t)(expected + (want != 0));
+    }
+    CHECK(sht_batch_threshold(&batch, temperature, temperature[64],
+                              temperature[192], flags) == expected);
+
+    /* crossed limits flag every successful read one way or the other */
+    CHECK(sht_batch_threshold(&batch, temperature, 0, -1, flags) ==
+          CAPACITY - (CAPACITY + 4) / 5);
+    for (i = 0; i < CAPACITY; ++i) {
+        want = temperature[i] < 0 ? SHT_BATCH_BELOW : SHT_BATCH_ABOVE;
+        CHECK(flags[i] == (i % 5 ? want : 0));
+    }
+}
+
+static void test_absolute_humidity(void) {
+    uint16_t i;
+
+    for (i = 0; i < CAPACITY; ++i) {
+        temperature[i] = -40000 + (int32_t)i * 500;
+        humidity[i] = (int32_t)i * 400;
+    }
+    sht_batch_absolute_humidity(CAPACITY, temperature, humidity, absolute);
+    for (i = 0; i < CAPACITY; ++i)
+        CHECK(absolute[i] ==
+              sensirion_calc_absolute_humidity(temperature[i], humidity[i]));
+}
+
+/* one sensor per bus, the one on bus 2 is missing; the sweep is collected
+ * into batches of 3 */
+static void test_sweep_collect(void) {
+    SHT_BATCH_DEFINE(small, 3);
+    sht_handle_t handles[NUM_SENSORS];
+    uint16_t order[NUM_SENSORS];
+    uint16_t done;
+    uint16_t i;
+    uint16_t k;
+    uint8_t dev;
+
+    sht_i2c_sim_init();
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        memset(&handles[i], 0, sizeof(handles[i]));
+        handles[i].id = (uint16_t)(10 + i);
+        handles[i].bus = (uint8_t)i;
+        handles[i].addr = 0x44;
+        handles[i].family = i % 2 ? SHT_FAMILY_SHT4X : SHT_FAMILY_SHT3X;
+        dev = sht_i2c_sim_add_sensor((uint8_t)i, SHT_I2C_SIM_ROOT, 0, 0x44,
+                                     handles[i].family, i);
+        sht_i2c_sim.devices[dev].t_ticks = (uint16_t)(0x1000 * (i + 1));
+        sht_i2c_sim.devices[dev].rh_ticks = (uint16_t)(0x2000 * (i + 1));
+        if (i == 2)
+            sht_i2c_sim.devices[dev].present = 0;
+    }
+    sht_mux_plan(handles, NUM_SENSORS, order);
+    CHECK(sht_mux_sweep_trigger(handles, order, NUM_SENSORS) == 1);
+    sht_i2c_sim.now_usec += 20000;
+
+    sht_batch_clear(&small);
+    CHECK(sht_batch_sweep_collect(&small, handles, order, NUM_SENSORS, 77) ==
+          3);
+    CHECK(small.count == 3);
+    CHECK(sht_batch_sweep_collect(&small, handles, order, NUM_SENSORS, 77) ==
+          0);
+    done = small.count;
+    for (k = 0; k < 2; ++k) {
+        for (i = 0; i < small.count; ++i) {
+            const sht_handle_t* h = &handles[order[3 * k + i]];
+
+            CHECK(small.sensor_id[i] == h->id);
+            CHECK(small.family[i] == h->family);
+            CHECK(small.timestamp_ms[i] == 77);
+            if (h->bus == 2) {
+                CHECK(small.status[i] != STATUS_OK);
+                CHECK(small.t_ticks[i] == 0 && small.rh_ticks[i] == 0);
+            } else {
+                CHECK(small.status[i] == STATUS_OK);
+                CHECK(small.t_ticks[i] == 0x1000 * (h->bus + 1));
+                CHECK(small.rh_ticks[i] == 0x2000 * (h->bus + 1));
+            }
+        }
+        if (k == 0) {
+            sht_batch_clear(&small);
+            CHECK(sht_batch_sweep_collect(&small, handles, order + done,
+                                          NUM_SENSORS - done, 77) == 2);
+            CHECK(small.count == 2);
+        }
+    }
+    for (i = 0; i < NUM_SENSORS; ++i)
+        CHECK(handles[i].seq == 1);
+}
+
+int main(void) {
+    test_add_get();
+    test_convert();
+    test_threshold();
+    test_absolute_humidity();
+    test_sweep_collect();
+    if (failures) {
+        printf("test_batch: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_batch: ok\n");
+    return 0;
+}
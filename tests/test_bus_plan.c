@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bus planning: transfer and sample costs follow the bit counts of the
+ * transfers and bound the bus time the simulation measures for a sample,
+ * a configuration within the budget is admitted unchanged, one over it is
+ * down-rated by doubling the periods of the largest consumers or rejected
+ * when the periods are fixed or the down-rating limits are reached, and an
+ * exceeded latency budget or a saturated bus is reported.
+ */
+
+#include "sht_bus_plan.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_SENSORS 10
+/* measure command of 2 bytes (29 bits) and a read of 6 (65 bits) */
+#define SHT3X_SAMPLE_USEC (290 + 650)
+
+static int failures;
+
+static sht_mux_t mux;
+static sht_handle_t sht3x = {NULL, 0, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X};
+static sht_handle_t sht4x = {NULL, 1, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT4X};
+static sht_handle_t muxed = {&mux, 2, 0, 0, 0, 3, 0x44, SHT_FAMILY_SHT3X};
+
+static void plan_init(sht_bus_plan_t* plan, uint32_t max_utilization_ppm) {
+    plan->clock_hz = 100000;
+    plan->overhead_usec = 0;
+    plan->max_utilization_ppm = max_utilization_ppm;
+    plan->max_latency_usec = 0;
+}
+
+static void entry_init(sht_bus_plan_entry_t* e, const sht_handle_t* handle,
+                       uint32_t period_usec, uint32_t max_period_usec) {
+    e->handle = handle;
+    e->period_usec = period_usec;
+    e->max_period_usec = max_period_usec;
+    e->conversion_usec = 0;
+    e->read_bytes = 0;
+    e->mode = SHT_BUS_PLAN_SINGLE_SHOT;
+}
+
+static void test_costs(void) {
+    sht_bus_plan_t plan;
+    sht_bus_plan_entry_t e;
+    sht_raw_sample_t sample;
+    uint64_t bus_usec;
+
+    plan_init(&plan, 1000000);
+    CHECK(sht_bus_plan_transfer_usec(&plan, 2) == 290);
+    plan.overhead_usec = 10;
+    CHECK(sht_bus_plan_transfer_usec(&plan, 2) == 300);
+    plan.overhead_usec = 0;
+    plan.clock_hz = 400000;
+    /* 72.5 us rounded up */
+    CHECK(sht_bus_plan_transfer_usec(&plan, 2) == 73);
+    plan.clock_hz = 0;
+    CHECK(sht_bus_plan_transfer_usec(&plan, 2) == 290);
+
+    plan.clock_hz = 100000;
+    entry_init(&e, &sht3x, 1000000, 0);
+    CHECK(sht_bus_plan_sample_usec(&plan, &e) == SHT3X_SAMPLE_USEC);
+    e.handle = &sht4x;
+    CHECK(sht_bus_plan_sample_usec(&plan, &e) == 200 + 650);
+    /* one mux: entered and closed before the measure and the read */
+    e.handle = &muxed;
+    CHECK(sht_bus_plan_sample_usec(&plan, &e) == SHT3X_SAMPLE_USEC + 4 * 200);
+    e.mode = SHT_BUS_PLAN_PERIODIC;
+    CHECK(sht_bus_plan_sample_usec(&plan, &e) == SHT3X_SAMPLE_USEC + 2 * 200);
+    e.mode = SHT_BUS_PLAN_SINGLE_SHOT;
+    e.read_bytes = 3;
+    CHECK(sht_bus_plan_sample_usec(&plan, &e) ==
+          SHT3X_SAMPLE_USEC - 270 + 4 * 200);
+
+    /* the planned cost bounds the bus time of a sample on the simulation,
+     * which leaves out the start and stop conditions */
+    sht_i2c_sim_init();
+    sht_i2c_sim_add_sensor(0, sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x70),
+                           3, 0x44, SHT_FAMILY_SHT3X, 1);
+    sht_mux_init(&mux, 0, 0x70, 0, NULL, 0);
+    CHECK(sht_mux_select_handle(&muxed) == STATUS_OK);
+    CHECK(sht_handle_measure(&muxed) == STATUS_OK);
+    sensirion_sleep_usec(sht_handle_measurement_duration_usec(&muxed));
+    CHECK(sht_handle_read_sample(&muxed, 0, &sample) == STATUS_OK);
+    bus_usec = sht_i2c_sim.bus_usec;
+    e.read_bytes = 0;
+    CHECK(bus_usec > 0);
+    CHECK(bus_usec <= sht_bus_plan_sample_usec(&plan, &e));
+}
+
+static void test_accept(void) {
+    sht_bus_plan_t plan;
+    sht_bus_plan_entry_t e[4];
+    uint16_t i;
+
+    plan_init(&plan, 500000);
+    for (i = 0; i < 4; ++i)
+        entry_init(&e[i], &sht3x, 1000000, 8000000);
+    CHECK(sht_bus_plan_admit(&plan, e, 4) == STATUS_OK);
+    CHECK(plan.down_rated == 0);
+    CHECK(plan.utilization_ppm == 4 * SHT3X_SAMPLE_USEC);
+    /* all due at once: one round, the measure and the read may each wait for
+     * it */
+    CHECK(plan.busy_period_usec == 4 * SHT3X_SAMPLE_USEC);
+    CHECK(plan.worst_latency_usec == 2 * 4 * SHT3X_SAMPLE_USEC + 15000);
+    for (i = 0; i < 4; ++i) {
+        CHECK(e[i].period_usec == 1000000);
+        CHECK(e[i].bus_usec == SHT3X_SAMPLE_USEC);
+        CHECK(e[i].latency_usec == plan.worst_latency_usec);
+    }
+
+    /* the latency budget is checked too */
+    plan.max_latency_usec = plan.worst_latency_usec - 1;
+    CHECK(sht_bus_plan_evaluate(&plan, e, 4) == STATUS_ERR_OVER_BUDGET);
+    plan.max_latency_usec = plan.worst_latency_usec;
+    CHECK(sht_bus_plan_evaluate(&plan, e, 4) == STATUS_OK);
+
+    e[2].period_usec = 0;
+    CHECK(sht_bus_plan_evaluate(&plan, e, 4) == STATUS_ERR_INVALID_PARAMS);
+}
+
+static void test_down_rate(void) {
+    sht_bus_plan_t plan;
+    sht_bus_plan_entry_t e[NUM_SENSORS];
+    uint16_t i;
+
+    /* 94 % of the bus at 10 ms, the budget is 50 % */
+    plan_init(&plan, 500000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        entry_init(&e[i], &sht3x, 10000, 80000);
+    /* one sensor reads 22 bytes, 2.5 times the bus time of the others */
+    e[4].read_bytes = 22;
+    CHECK(sht_bus_plan_evaluate(&plan, e, NUM_SENSORS) ==
+          STATUS_ERR_OVER_BUDGET);
+    CHECK(e[4].bus_usec == 290 + 2090);
+
+    /* the largest consumer is down-rated first and twice, as its halved
+     * share is still the largest */
+    CHECK(sht_bus_plan_admit(&plan, e, NUM_SENSORS) == STATUS_OK);
+    CHECK(plan.utilization_ppm <= 500000);
+    CHECK(e[4].period_usec == 40000);
+    CHECK(plan.down_rated == 11);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        CHECK(i == 4 || e[i].period_usec == 20000);
+}
+
+static void test_reject(void) {
+    sht_bus_plan_t plan;
+    sht_bus_plan_entry_t e[NUM_SENSORS];
+    uint16_t i;
+
+    /* fixed rates */
+    plan_init(&plan, 500000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        entry_init(&e[i], &sht3x, 10000, 0);
+    CHECK(sht_bus_plan_admit(&plan, e, NUM_SENSORS) ==
+          STATUS_ERR_OVER_BUDGET);
+    CHECK(plan.down_rated == 0);
+    CHECK(plan.utilization_ppm == NUM_SENSORS * 94000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        CHECK(e[i].period_usec == 10000);
+
+    /* one doubling allowed: 47 % stays over a 40 % budget, the entries keep
+     * the doubled periods */
+    plan_init(&plan, 400000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        entry_init(&e[i], &sht3x, 10000, 20000);
+    CHECK(sht_bus_plan_admit(&plan, e, NUM_SENSORS) ==
+          STATUS_ERR_OVER_BUDGET);
+    CHECK(plan.down_rated == NUM_SENSORS);
+    CHECK(plan.utilization_ppm == NUM_SENSORS * 47000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        CHECK(e[i].period_usec == 20000);
+
+    /* a saturated bus has no bounded busy period */
+    plan_init(&plan, 2000000);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        entry_init(&e[i], &sht3x, 9000, 0);
+    CHECK(sht_bus_plan_evaluate(&plan, e, NUM_SENSORS) == STATUS_OK);
+    CHECK(plan.utilization_ppm > 1000000);
+    CHECK(plan.busy_period_usec == UINT32_MAX);
+    CHECK(plan.worst_latency_usec == UINT32_MAX);
+    plan.max_latency_usec = 1000000;
+    CHECK(sht_bus_plan_evaluate(&plan, e, NUM_SENSORS) ==
+          STATUS_ERR_OVER_BUDGET);
+}
+
+int main(void) {
+    test_costs();
+    test_accept();
+    test_down_rate();
+    test_reject();
+    if (failures) {
+        printf("test_bus_plan: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_bus_plan: ok\n");
+    return 0;
+}
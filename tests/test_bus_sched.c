@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bus scheduling on the simulated bus: operations are started by class first
+ * and by deadline within a class, a late alert waits only for the
+ * transaction in progress and runs while a sample operation waits for its
+ * conversion, the samples carry the millisecond timestamp passed in, and the
+ * per class metrics count transactions, failures, missed deadlines and
+ * waits. The microsecond clock starts just before its wrap-around.
+ */
+
+#include "sht_bus_sched.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_SENSORS 4
+#define CAPACITY 8
+#define MAX_DONE 16
+/* 16 ms before the wrap-around */
+#define START_USEC 0xFFFFC000U
+/* unrelated to the microsecond clock on purpose */
+#define START_MS 5000000U
+
+static int failures;
+
+static sht_mux_t mux;
+static sht_handle_t handles[NUM_SENSORS];
+static uint8_t devices[NUM_SENSORS];
+static sht_bus_sched_op_t ops[CAPACITY];
+static sht_bus_sched_t sched;
+
+/* completions in order */
+static struct {
+    uint16_t tag;
+    int16_t ret;
+    uint32_t timestamp_ms;
+} done[MAX_DONE];
+static uint16_t num_done;
+
+static void on_done(void* user_data, const sht_bus_sched_op_t* op,
+                    int16_t ret) {
+    if (num_done == MAX_DONE)
+        return;
+    done[num_done].tag = op->tag;
+    done[num_done].ret = ret;
+    done[num_done].timestamp_ms = op->sample.timestamp_ms;
+    num_done++;
+}
+
+static uint32_t now_usec(void) {
+    return (uint32_t)sht_i2c_sim.now_usec;
+}
+
+static uint32_t now_ms(void) {
+    return START_MS + (uint32_t)((sht_i2c_sim.now_usec - START_USEC) / 1000);
+}
+
+/* one SHT3x behind each channel of a mux */
+static void setup(void) {
+    uint8_t m;
+    uint8_t i;
+
+    sht_i2c_sim_init();
+    sht_i2c_sim.now_usec = START_USEC;
+    m = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x70);
+    sht_mux_init(&mux, 0, 0x70, 0, NULL, 0);
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        devices[i] =
+            sht_i2c_sim_add_sensor(0, m, i, 0x44, SHT_FAMILY_SHT3X, 100 + i);
+        handles[i].mux = &mux;
+        handles[i].id = i;
+        handles[i].seq = 0;
+        handles[i].clock_khz = 0;
+        handles[i].bus = 0;
+        handles[i].channel = i;
+        handles[i].addr = 0x44;
+        handles[i].family = SHT_FAMILY_SHT3X;
+    }
+    sht_bus_sched_init(&sched, ops, CAPACITY, on_done, NULL);
+    num_done = 0;
+}
+
+/* run the queue empty, sleeping whenever nothing is ready */
+static void drain(void) {
+    while (sched.pending) {
+        if (!sht_bus_sched_run_once(&sched, now_usec(), now_ms()))
+            sensirion_sleep_usec(sht_bus_sched_idle_usec(&sched, now_usec()));
+    }
+}
+
+static void test_order(void) {
+    static const struct {
+        uint8_t cls;
+        uint32_t deadline_usec;
+    } submitted[] = {
+        {SHT_BUS_SCHED_ROUTINE, 20000}, {SHT_BUS_SCHED_SPOT, 50000},
+        {SHT_BUS_SCHED_ROUTINE, 10000}, {SHT_BUS_SCHED_SPOT, 30000},
+        {SHT_BUS_SCHED_ALERT, 90000},
+    };
+    /* class first, then the earliest deadline */
+    static const uint16_t expected[] = {4, 3, 1, 2, 0};
+    uint32_t t;
+    uint16_t i;
+
+    setup();
+    t = now_usec();
+    for (i = 0; i < 5; ++i)
+        CHECK(sht_bus_sched_submit(&sched, &handles[i % NUM_SENSORS],
+                                   SHT_BUS_SCHED_OP_STATUS,
+                                   submitted[i].cls, t,
+                                   t + submitted[i].deadline_usec,
+                                   i) == STATUS_OK);
+    CHECK(sht_bus_sched_next(&sched, t) == 4);
+    /* not ready yet */
+    CHECK(sht_bus_sched_next(&sched, t - 1) == CAPACITY);
+    CHECK(sht_bus_sched_idle_usec(&sched, t - 1) == 1);
+    drain();
+
+    CHECK(num_done == 5);
+    for (i = 0; i < 5; ++i) {
+        CHECK(done[i].tag == expected[i]);
+        CHECK(done[i].ret == STATUS_OK);
+    }
+    CHECK(sht_bus_sched_idle_usec(&sched, now_usec()) == UINT32_MAX);
+    CHECK(sht_bus_sched_submit(&sched, &handles[0], SHT_BUS_SCHED_OP_SAMPLE,
+                               SHT_BUS_SCHED_NUM_CLASSES, t, t,
+                               0) == STATUS_ERR_INVALID_PARAMS);
+}
+
+/* routine samples of the sensors 0 to 2, alerts for the sensor 3 */
+static void test_preemption(void) {
+    const sht_bus_sched_stats_t* alert = &sched.stats[SHT_BUS_SCHED_ALERT];
+    uint32_t measure_usec;
+    uint32_t t;
+    uint16_t i;
+
+    setup();
+    measure_usec = sht_handle_measurement_duration_usec(&handles[0]);
+    t = now_usec();
+    for (i = 0; i < 3; ++i)
+        CHECK(sht_bus_sched_submit(&sched, &handles[i],
+                                   SHT_BUS_SCHED_OP_SAMPLE,
+                                   SHT_BUS_SCHED_ROUTINE, t, t + 1000000,
+                                   i) == STATUS_OK);
+
+    /* the alert arrives while the first measure is on the bus: it waits for
+     * that transaction only, ahead of the two other measures */
+    CHECK(sht_bus_sched_run_once(&sched, t, now_ms()));
+    CHECK(sht_i2c_sim.devices[devices[0]].writes == 1);
+    CHECK(sht_bus_sched_submit(&sched, &handles[3], SHT_BUS_SCHED_OP_STATUS,
+                               SHT_BUS_SCHED_ALERT, t, t + 1000,
+                               100) == STATUS_OK);
+    CHECK(sht_bus_sched_run_once(&sched, now_usec(), now_ms()));
+    CHECK(num_done == 1 && done[0].tag == 100 && done[0].ret == STATUS_OK);
+    CHECK(sht_i2c_sim.devices[devices[1]].writes == 0);
+    CHECK(sht_i2c_sim.devices[devices[2]].writes == 0);
+    CHECK(alert->transactions == 1);
+    CHECK(alert->wait_max_usec > 0);
+    CHECK(alert->wait_max_usec == alert->wait_sum_usec);
+    CHECK(alert->wait_max_usec < measure_usec / 10);
+    CHECK(alert->missed == 0);
+
+    /* the routine measures go on; an alert submitted during the
+     * conversions is served before the reads */
+    for (i = 1; i < 3; ++i)
+        CHECK(sht_bus_sched_run_once(&sched, now_usec(), now_ms()));
+    CHECK(num_done == 1);
+    CHECK(sht_bus_sched_submit(&sched, &handles[3], SHT_BUS_SCHED_OP_SAMPLE,
+                               SHT_BUS_SCHED_ALERT, now_usec(),
+                               now_usec() + 100000, 101) == STATUS_OK);
+    CHECK(sht_bus_sched_run_once(&sched, now_usec(), now_ms()));
+    CHECK(num_done == 1);
+    CHECK(sht_i2c_sim.devices[devices[3]].writes == 2);
+    /* nothing ready until the first conversion ends */
+    CHECK(!sht_bus_sched_run_once(&sched, now_usec(), now_ms()));
+    CHECK(sht_bus_sched_idle_usec(&sched, now_usec()) > 0);
+    CHECK(sht_bus_sched_idle_usec(&sched, now_usec()) < measure_usec);
+
+    /* the reads follow in the order of the conversions, the alert read
+     * last although its class comes first */
+    drain();
+    CHECK(num_done == 5);
+    for (i = 0; i < 4; ++i) {
+        CHECK(done[1 + i].tag == (i < 3 ? i : 101));
+        CHECK(done[1 + i].ret == STATUS_OK);
+    }
+    /* the reads ran after the wrap-around of the microsecond clock and are
+     * stamped with the millisecond clock passed in */
+    CHECK(now_usec() < START_USEC);
+    for (i = 1; i < 5; ++i)
+        CHECK(done[i].timestamp_ms >= START_MS + 15);
+    CHECK(now_ms() - done[4].timestamp_ms <= 1);
+    CHECK(sht_i2c_sim.nacks == 0);
+    CHECK(sched.stats[SHT_BUS_SCHED_ROUTINE].transactions == 6);
+    CHECK(alert->transactions == 3);
+}
+
+static void test_metrics(void) {
+    const sht_bus_sched_stats_t* spot = &sched.stats[SHT_BUS_SCHED_SPOT];
+    const sht_bus_sched_stats_t* routine =
+        &sched.stats[SHT_BUS_SCHED_ROUTINE];
+    uint32_t t;
+
+    setup();
+    sht_i2c_sim.devices[devices[2]].present = 0;
+    t = now_usec();
+    /* failed: the sensor is missing */
+    CHECK(sht_bus_sched_submit(&sched, &handles[2], SHT_BUS_SCHED_OP_SAMPLE,
+                               SHT_BUS_SCHED_SPOT, t, t + 100000,
+                               0) == STATUS_OK);
+    /* missed: the deadline is over before the routine op starts */
+    CHECK(sht_bus_sched_submit(&sched, &handles[1], SHT_BUS_SCHED_OP_STATUS,
+                               SHT_BUS_SCHED_ROUTINE, t, t + 10,
+                               1) == STATUS_OK);
+    /* waited 1 ms for the bus */
+    CHECK(sht_bus_sched_submit(&sched, &handles[0], SHT_BUS_SCHED_OP_STATUS,
+                               SHT_BUS_SCHED_SPOT, t - 1000, t + 100000,
+                               2) == STATUS_OK);
+    drain();
+
+    CHECK(num_done == 3);
+    CHECK(done[0].tag == 2 && done[0].ret == STATUS_OK);
+    CHECK(done[1].tag == 0 && done[1].ret != STATUS_OK);
+    CHECK(done[2].tag == 1 && done[2].ret == STATUS_OK);
+    CHECK(spot->transactions == 2);
+    CHECK(spot->failed == 1);
+    CHECK(spot->missed == 0);
+    CHECK(spot->wait_max_usec >= 1000);
+    CHECK(spot->wait_sum_usec > spot->wait_max_usec);
+    CHECK(routine->transactions == 1);
+    CHECK(routine->failed == 0);
+    CHECK(routine->missed == 1);
+    CHECK(sched.stats[SHT_BUS_SCHED_ALERT].transactions == 0);
+
+    /* cancel drops the queued ops of a handle without completing them */
+    CHECK(sht_bus_sched_submit(&sched, &handles[3], SHT_BUS_SCHED_OP_SAMPLE,
+                               SHT_BUS_SCHED_ROUTINE, t, t, 3) == STATUS_OK);
+    CHECK(sht_bus_sched_submit(&sched, &handles[3], SHT_BUS_SCHED_OP_STATUS,
+                               SHT_BUS_SCHED_SPOT, t, t, 4) == STATUS_OK);
+    CHECK(sht_bus_sched_cancel(&sched, &handles[3]) == 2);
+    CHECK(sched.pending == 0 && num_done == 3);
+
+    sht_bus_sched_reset_stats(&sched);
+    CHECK(spot->transactions == 0 && spot->wait_sum_usec == 0);
+    CHECK(routine->missed == 0);
+}
+
+int main(void) {
+    test_order();
+    test_preemption();
+    test_metrics();
+    if (failures) {
+        printf("test_bus_sched: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_bus_sched: ok\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bus locking between processes: a forked child holds the lock while the
+ * parent reads a sensor, so the parent waits and counts the contention, then
+ * finds the generation changed by the child and rewrites its stale mux
+ * channel before the read. A second lock file descriptor in the same
+ * process detects the use of the other one as foreign, but not its own.
+ */
+
+#include "sht_buslock.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/* time the child holds the lock */
+#define HOLD_USEC 50000
+
+static int failures;
+
+static char dir[] = "/tmp/test_buslock.XXXXXX";
+
+static void test_contended(void) {
+    sht_mux_t mux;
+    sht_handle_t handle = {&mux, 0, 0, 0, 0, 1, 0x44, SHT_FAMILY_SHT3X};
+    sht_raw_sample_t sample;
+    sht_buslock_t lock;
+    const sht_buslock_bus_t* b = &lock.buses[0];
+    uint8_t m;
+    uint32_t writes;
+    int pipefd[2];
+    int status;
+    pid_t pid;
+    char c;
+
+    sht_i2c_sim_init();
+    m = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x70);
+    sht_i2c_sim_add_sensor(0, m, 1, 0x44, SHT_FAMILY_SHT3X, 1);
+    sht_mux_init(&mux, 0, 0x70, 0, NULL, 0);
+    sht_buslock_init(&lock, dir);
+
+    CHECK(sht_buslock_read_sample(&lock, &handle, 0, &sample) == STATUS_OK);
+    CHECK(b->acquisitions == 1 && b->contended == 0);
+    CHECK(b->foreign == 0);
+    CHECK(sht_i2c_sim_open_muxes(0) == 0);
+
+    /* a selection made without the lock leaves the cache claiming channel
+     * 1; the child closes the channel on the shared bus */
+    CHECK(sht_mux_select_handle(&handle) == STATUS_OK);
+    CHECK(pipe(pipefd) == 0);
+    pid = fork();
+    if (pid == 0) {
+        sht_buslock_t child;
+
+        sht_buslock_init(&child, dir);
+        if (sht_buslock_acquire(&child, 0, NULL) != STATUS_OK)
+            _exit(1);
+        if (write(pipefd[1], "x", 1) != 1)
+            _exit(1);
+        usleep(HOLD_USEC);
+        _exit(sht_buslock_release(&child, 0) == STATUS_OK ? 0 : 1);
+    }
+    CHECK(pid > 0);
+    CHECK(read(pipefd[0], &c, 1) == 1);
+    sht_i2c_sim.devices[m].mask = 0;
+    writes = mux.writes;
+
+    CHECK(sht_buslock_read_sample(&lock, &handle, 1, &sample) == STATUS_OK);
+    CHECK(sample.status == STATUS_OK);
+    CHECK(b->acquisitions == 2);
+    CHECK(b->contended == 1);
+    CHECK(b->wait_usec >= HOLD_USEC * 4 / 5);
+    CHECK(b->max_wait_usec == b->wait_usec);
+    CHECK(b->foreign == 1);
+    /* the channel was rewritten although the cache showed it enabled, and
+     * closed again on the release */
+    CHECK(mux.writes == writes + 2);
+    CHECK(sht_i2c_sim_open_muxes(0) == 0);
+
+    CHECK(waitpid(pid, &status, 0) == pid);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    close(pipefd[0]);
+    close(pipefd[1]);
+    sht_buslock_close(&lock);
+}
+
+static void test_foreign(void) {
+    sht_buslock_t a;
+    sht_buslock_t b;
+    uint8_t foreign;
+
+    sht_i2c_sim_init();
+    sht_buslock_init(&a, dir);
+    sht_buslock_init(&b, dir);
+
+    /* a new lock file reads as generation 0, not foreign */
+    CHECK(sht_buslock_acquire(&a, 1, &foreign) == STATUS_OK);
+    CHECK(!foreign);
+    CHECK(sht_buslock_release(&a, 1) == STATUS_OK);
+    CHECK(sht_buslock_acquire(&a, 1, &foreign) == STATUS_OK);
+    CHECK(!foreign);
+    /* nested */
+    CHECK(sht_buslock_acquire(&a, 1, &foreign) == STATUS_OK);
+    CHECK(!foreign && a.buses[1].depth == 2);
+    CHECK(sht_buslock_release(&a, 1) == STATUS_OK);
+    CHECK(sht_buslock_release(&a, 1) == STATUS_OK);
+    CHECK(sht_buslock_release(&a, 1) == STATUS_ERR_INVALID_PARAMS);
+
+    CHECK(sht_buslock_acquire(&b, 1, &foreign) == STATUS_OK);
+    CHECK(foreign);
+    CHECK(sht_buslock_release(&b, 1) == STATUS_OK);
+    CHECK(sht_buslock_acquire(&a, 1, &foreign) == STATUS_OK);
+    CHECK(foreign);
+    CHECK(sht_buslock_release(&a, 1) == STATUS_OK);
+
+    CHECK(a.buses[1].acquisitions == 3);
+    CHECK(a.buses[1].foreign == 1);
+    CHECK(a.buses[1].contended == 0);
+    CHECK(b.buses[1].foreign == 1);
+    CHECK(sht_buslock_acquire(&a, SHT_BUSLOCK_MAX_BUSES, &foreign) ==
+          STATUS_ERR_INVALID_PARAMS);
+    sht_buslock_close(&a);
+    sht_buslock_close(&b);
+}
+
+int main(void) {
+    char path[64];
+    uint8_t bus;
+
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    test_contended();
+    test_foreign();
+    for (bus = 0; bus < 2; ++bus) {
+        snprintf(path, sizeof(path), "%s/sht-i2c-%u.lock", dir, bus);
+        unlink(path);
+    }
+    rmdir(dir);
+    if (failures) {
+        printf("test_buslock: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_buslock: ok\n");
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * COBS sample stream: frames round-trip through encoder and decoder, each
+ * frame is delivered exactly once even when delimiters repeat, and the
+ * decoder resynchronizes after corrupted and truncated frames.
+ */
+
+#include "sht_cobs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static int failures;
+
+static uint8_t frame[SHT_COBS_FRAME_SIZE(SHT_COBS_MAX_SAMPLES)];
+static uint8_t payload[SHT_COBS_PAYLOAD_SIZE(SHT_COBS_MAX_SAMPLES)];
+
+static void random_sample(sht_raw_sample_t* s, uint32_t base_ms) {
+    s->timestamp_ms = base_ms + (uint32_t)(rand() % 2000);
+    s->sensor_id = (uint16_t)rand();
+    s->seq = (uint16_t)rand();
+    /* zero bytes exercise the COBS blocks */
+    s->t_ticks = rand() % 4 ? (uint16_t)rand() : 0;
+    s->rh_ticks = rand() % 4 ? (uint16_t)rand() : 0;
+    s->status = (int16_t)-(rand() % 10);
+    s->bus = (uint8_t)(rand() % 8);
+    s->family = (uint8_t)(rand() % 3);
+}
+
+static uint8_t same(const sht_raw_sample_t* a, const sht_raw_sample_t* b) {
+    return a->timestamp_ms == b->timestamp_ms &&
+           a->sensor_id == b->sensor_id && a->seq == b->seq &&
+           a->t_ticks == b->t_ticks && a->rh_ticks == b->rh_ticks &&
+           a->status == b->status && a->bus == b->bus &&
+           a->family == b->family;
+}
+
+/* feed bytes, return the samples of the last completed frame */
+static uint16_t feed(sht_cobs_decoder_t* dec, const uint8_t* data,
+                     uint16_t len, uint16_t* delivered) {
+    uint16_t samples = 0;
+    uint16_t n;
+    uint16_t i;
+
+    for (i = 0; i < len; ++i) {
+        n = sht_cobs_decoder_push(dec, data[i]);
+        if (n) {
+            samples = n;
+            (*delivered)++;
+        }
+    }
+    return samples;
+}
+
+int main(void) {
+    sht_raw_sample_t in[SHT_COBS_MAX_SAMPLES];
+    sht_raw_sample_t out;
+    sht_cobs_encoder_t enc;
+    sht_cobs_decoder_t dec;
+    static const uint8_t zeros[3] = {0, 0, 0};
+    uint16_t delivered;
+    uint16_t len;
+    uint16_t n;
+    uint16_t i;
+    uint32_t frames;
+    uint32_t errors;
+    int round;
+
+    srand(1);
+    sht_cobs_decoder_init(&dec, payload, sizeof(payload));
+
+    for (round = 0; round < 2000; ++round) {
+        n = (uint16_t)(1 + rand() % SHT_COBS_MAX_SAMPLES);
+        sht_cobs_encoder_begin(&enc, frame, sizeof(frame));
+        for (i = 0; i < n; ++i) {
+            random_sample(&in[i], i ? in[i - 1].timestamp_ms : 1000000);
+            CHECK(sht_cobs_encoder_add(&enc, &in[i]) == 0);
+        }
+        len = sht_cobs_encoder_finish(&enc);
+        CHECK(len <= SHT_COBS_FRAME_SIZE(n));
+        CHECK(memchr(frame, 0, len - 1) == NULL && frame[len - 1] == 0);
+
+        /* exactly one delivery, also with delimiters repeated after it */
+        delivered = 0;
+        frames = dec.frames;
+        errors = dec.errors;
+        CHECK(feed(&dec, frame, len, &delivered) == n);
+        CHECK(delivered == 1);
+        for (i = 0; i < n; ++i) {
+            sht_cobs_decoder_sample(&dec, i, &out);
+            CHECK(same(&in[i], &out));
+        }
+        feed(&dec, zeros, (uint16_t)(rand() % 4), &delivered);
+        CHECK(delivered == 1);
+        CHECK(dec.frames == frames + 1 && dec.errors == errors);
+
+        /* a corrupted frame is dropped, the next one decodes */
+        if (round % 3 == 0) {
+            frame[rand() % (len - 1)] ^= (uint8_t)(1 + rand() % 255);
+            delivered = 0;
+            feed(&dec, frame, len, &delivered);
+            CHECK(dec.errors == errors + 1 || delivered == 0);
+        }
+        /* a truncated one too, once the link delimits it */
+        if (round % 5 == 0) {
+            delivered = 0;
+            feed(&dec, frame, (uint16_t)(rand() % (len - 1)), &delivered);
+            feed(&dec, zeros, 1, &delivered);
+            CHECK(delivered == 0);
+        }
+    }
+
+    /* frames that do not fit the decoder are dropped */
+    sht_cobs_decoder_init(&dec, payload, SHT_COBS_PAYLOAD_SIZE(1));
+    sht_cobs_encoder_begin(&enc, frame, sizeof(frame));
+    sht_cobs_encoder_add(&enc, &in[0]);
+    sht_cobs_encoder_add(&enc, &in[1]);
+    len = sht_cobs_encoder_finish(&enc);
+    delivered = 0;
+    CHECK(feed(&dec, frame, len, &delivered) == 0);
+    CHECK(dec.errors == 1 && dec.frames == 0);
+
+    if (failures) {
+        printf("test_cobs: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_cobs: ok\n");
+    return 0;
+}
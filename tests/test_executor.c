@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Executor under concurrency: three sampler threads, one per bus, submit a
+ * numbered stream of samples per sensor into shallow strands while four
+ * worker threads process them, the fourth worker living on stolen strands
+ * only. Every sample is processed exactly once and the samples of each
+ * sensor in submission order.
+ */
+
+#include "sht_executor.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_BUSES 3
+#define SENSORS_PER_BUS 8
+#define NUM_STRANDS (NUM_BUSES * SENSORS_PER_BUS)
+#define NUM_WORKERS 4
+#define STRAND_DEPTH 4
+#define NUM_SAMPLES 20000 /* per sensor, below the 16 bit seq wrap */
+
+static int failures;
+
+static sht_executor_t exec;
+static sht_executor_worker_t workers[NUM_WORKERS];
+static sht_executor_strand_t strands[NUM_STRANDS];
+static uint16_t slots[NUM_WORKERS * NUM_STRANDS];
+static sht_raw_sample_t samples[NUM_STRANDS * STRAND_DEPTH];
+static pthread_mutex_t locks[SHT_EXECUTOR_LOCK_COUNT(NUM_WORKERS,
+                                                     NUM_STRANDS)];
+
+/* only touched by the worker processing the strand, the strand lock orders
+ * the accesses of successive workers */
+static uint32_t next_seq[NUM_STRANDS];
+static uint32_t out_of_order[NUM_STRANDS];
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t samplers_done;
+static uint32_t full; /* submissions rejected with STATUS_ERR_NO_SPACE */
+
+static void lock(void* user_data, uint16_t lock_id) {
+    pthread_mutex_lock(&locks[lock_id]);
+}
+
+static void unlock(void* user_data, uint16_t lock_id) {
+    pthread_mutex_unlock(&locks[lock_id]);
+}
+
+static void process(void* user_data, uint8_t worker,
+                    const sht_raw_sample_t* sample) {
+    uint16_t id = sample->sensor_id;
+
+    if (sample->seq != (uint16_t)next_seq[id] ||
+        sample->bus != id / SENSORS_PER_BUS)
+        out_of_order[id]++;
+    next_seq[id]++;
+}
+
+static void* sampler(void* arg) {
+    uint8_t bus = (uint8_t)(size_t)arg;
+    sht_raw_sample_t sample = {0};
+    uint32_t rejected = 0;
+    uint32_t n;
+    uint16_t k;
+
+    sample.bus = bus;
+    for (n = 0; n < NUM_SAMPLES; ++n) {
+        for (k = 0; k < SENSORS_PER_BUS; ++k) {
+            sample.sensor_id = (uint16_t)(bus * SENSORS_PER_BUS + k);
+            sample.seq = (uint16_t)n;
+            sample.t_ticks = (uint16_t)(n ^ k);
+            while (sht_executor_submit(&exec, &sample) != STATUS_OK) {
+                rejected++;
+                sched_yield();
+            }
+        }
+    }
+    pthread_mutex_lock(&state_lock);
+    full += rejected;
+    pthread_mutex_unlock(&state_lock);
+    return NULL;
+}
+
+static void* worker(void* arg) {
+    uint8_t w = (uint8_t)(size_t)arg;
+    uint8_t done;
+
+    for (;;) {
+        /* the flag is read before looking for work: once the samplers are
+         * done, finding nothing means the remaining strands are held by
+         * workers that finish them */
+        pthread_mutex_lock(&state_lock);
+        done = samplers_done;
+        pthread_mutex_unlock(&state_lock);
+        if (!sht_executor_run_once(&exec, w)) {
+            if (done)
+                break;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t samplers[NUM_BUSES];
+    pthread_t threads[NUM_WORKERS];
+    sht_raw_sample_t stray = {0};
+    uint32_t processed = 0;
+    uint32_t stolen = 0;
+    uint32_t lost = 0;
+    uint32_t reordered = 0;
+    size_t i;
+
+    for (i = 0; i < sizeof(locks) / sizeof(locks[0]); ++i)
+        pthread_mutex_init(&locks[i], NULL);
+    CHECK(sht_executor_init(&exec, workers, NUM_WORKERS, strands,
+                            NUM_STRANDS, slots, samples, STRAND_DEPTH, lock,
+                            unlock, process, NULL) == STATUS_OK);
+
+    for (i = 0; i < NUM_WORKERS; ++i)
+        CHECK(pthread_create(&threads[i], NULL, worker, (void*)i) == 0);
+    for (i = 0; i < NUM_BUSES; ++i)
+        CHECK(pthread_create(&samplers[i], NULL, sampler, (void*)i) == 0);
+    for (i = 0; i < NUM_BUSES; ++i)
+        pthread_join(samplers[i], NULL);
+    pthread_mutex_lock(&state_lock);
+    samplers_done = 1;
+    pthread_mutex_unlock(&state_lock);
+    for (i = 0; i < NUM_WORKERS; ++i)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < NUM_STRANDS; ++i) {
+        if (next_seq[i] != NUM_SAMPLES)
+            lost++;
+        reordered += out_of_order[i];
+        CHECK(strands[i].count == 0 && !strands[i].runnable);
+    }
+    for (i = 0; i < NUM_WORKERS; ++i) {
+        processed += workers[i].processed;
+        stolen += workers[i].stolen;
+        CHECK(workers[i].count == 0);
+    }
+    CHECK(lost == 0);
+    CHECK(reordered == 0);
+    CHECK(processed == (uint32_t)NUM_STRANDS * NUM_SAMPLES);
+    printf("test_executor: %lu samples, %lu stolen strands, %lu full "
+           "strand retries\n",
+           (unsigned long)processed, (unsigned long)stolen,
+           (unsigned long)full);
+
+    /* a sensor id without a strand */
+    stray.sensor_id = NUM_STRANDS;
+    CHECK(sht_executor_submit(&exec, &stray) == STATUS_ERR_INVALID_PARAMS);
+
+    if (failures) {
+        printf("test_executor: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_executor: ok\n");
+    return 0;
+}
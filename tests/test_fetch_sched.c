@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fetch scheduling against a model of an SHT3x in periodic mode whose
+ * oscillator runs off the nominal rate: new data appears every true period
+ * and a fetch without new data is NACKed. Over an hour at 10 mps the
+ * schedule must waste few fetches, keep the sample age low and miss no
+ * sample, also after the oscillator drifts while locked. Unknown rates are
+ * rejected.
+ */
+
+#include "sht3x_fetch_sched.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define PERIOD_USEC 100000ULL /* 10 mps */
+#define HOUR_USEC 3600000000ULL
+#define SETTLE_USEC 10000000ULL
+/* the 32 bit clock of the schedule wraps during the runs */
+#define START_USEC 0xF0000000ULL
+
+static int failures;
+
+/* the sensor: data edges every true period, ppm off the nominal one */
+typedef struct _model {
+    uint64_t next_edge;
+    uint64_t latest_edge;
+    uint64_t period;
+    uint32_t pending; /* edges since the last successful fetch */
+} model_t;
+
+/* fetch outcomes from `from` on */
+typedef struct _stats {
+    uint32_t fetches;
+    uint32_t wasted;
+    uint32_t samples;
+    uint32_t missed;
+    uint64_t age_sum;
+    uint64_t age_max;
+} stats_t;
+
+static void model_set_drift(model_t* m, int32_t ppm) {
+    m->period = PERIOD_USEC * (uint64_t)(1000000 + ppm) / 1000000;
+}
+
+static int16_t model_fetch(model_t* m, uint64_t now, stats_t* st) {
+    while (m->next_edge <= now) {
+        m->latest_edge = m->next_edge;
+        m->next_edge += m->period;
+        m->pending++;
+    }
+    st->fetches++;
+    if (!m->pending) {
+        st->wasted++;
+        return -1;
+    }
+    st->samples++;
+    st->missed += m->pending - 1;
+    st->age_sum += now - m->latest_edge;
+    if (now - m->latest_edge > st->age_max)
+        st->age_max = now - m->latest_edge;
+    m->pending = 0;
+    return STATUS_OK;
+}
+
+static void stats_reset(stats_t* st) {
+    st->fetches = 0;
+    st->wasted = 0;
+    st->samples = 0;
+    st->missed = 0;
+    st->age_sum = 0;
+    st->age_max = 0;
+}
+
+/* follow the schedule until end, the bus adding up to 300 us of latency */
+static uint64_t run(sht3x_fetch_sched_entry_t* e, model_t* m, uint64_t now,
+                    uint64_t end, stats_t* st) {
+    int16_t ret;
+
+    while (now < end) {
+        now += (uint32_t)(e->next_usec - (uint32_t)now);
+        now += (uint64_t)(rand() % 300);
+        ret = model_fetch(m, now, st);
+        sht3x_fetch_sched_report(e, (uint32_t)now, ret);
+    }
+    return now;
+}
+
+static void print_stats(const char* name, const stats_t* st) {
+    printf("%-22s %6u fetches  %5.2f%% wasted  age %5.2f ms mean "
+           "%6.2f ms max  %u missed\n",
+           name, st->fetches, 100.0 * st->wasted / st->fetches,
+           st->age_sum / 1000.0 / st->samples, st->age_max / 1000.0,
+           st->missed);
+}
+
+static void check_locked(const stats_t* st) {
+    CHECK(st->missed == 0);
+    CHECK(st->wasted * 100 < st->fetches * 5);
+    CHECK(st->age_sum / st->samples < 3000);
+    CHECK(st->age_max < PERIOD_USEC / 8);
+}
+
+static void test_drift(int32_t ppm) {
+    sht3x_fetch_sched_entry_t e;
+    model_t m;
+    stats_t st;
+    char name[32];
+    uint64_t now = START_USEC;
+
+    model_set_drift(&m, ppm);
+    m.next_edge = START_USEC + m.period;
+    m.latest_edge = START_USEC;
+    m.pending = 0;
+    CHECK(sht3x_fetch_sched_init(&e, SHT3X_I2C_ADDR_DFLT,
+                                 SHT3X_PERIODIC_10_MPS,
+                                 (uint32_t)START_USEC) == STATUS_OK);
+
+    stats_reset(&st);
+    now = run(&e, &m, now, START_USEC + SETTLE_USEC, &st);
+    stats_reset(&st);
+    now = run(&e, &m, now, START_USEC + HOUR_USEC, &st);
+    snprintf(name, sizeof(name), "%+d ppm", (int)ppm);
+    print_stats(name, &st);
+    check_locked(&st);
+    CHECK(e.state != SHT3X_FETCH_SCHED_ACQUIRE);
+}
+
+static void test_recovery(void) {
+    sht3x_fetch_sched_entry_t e;
+    model_t m;
+    stats_t st;
+    uint64_t now = START_USEC;
+
+    /* locked on a slow oscillator, which then runs 10% fast */
+    model_set_drift(&m, -50000);
+    m.next_edge = START_USEC + m.period;
+    m.latest_edge = START_USEC;
+    m.pending = 0;
+    (void)sht3x_fetch_sched_init(&e, SHT3X_I2C_ADDR_DFLT,
+                                 SHT3X_PERIODIC_10_MPS, (uint32_t)START_USEC);
+    stats_reset(&st);
+    now = run(&e, &m, now, START_USEC + HOUR_USEC / 2, &st);
+    check_locked(&st);
+
+    model_set_drift(&m, 100000);
+    stats_reset(&st);
+    now = run(&e, &m, now, now + SETTLE_USEC, &st);
+    print_stats("-5% -> +10%, 10 s", &st);
+    /* the faster edges are caught up within a few periods */
+    CHECK(st.missed <= 3);
+
+    stats_reset(&st);
+    now = run(&e, &m, now, START_USEC + HOUR_USEC, &st);
+    print_stats("-5% -> +10%, relocked", &st);
+    check_locked(&st);
+}
+
+static void test_invalid_rate(void) {
+    sht3x_fetch_sched_entry_t e;
+
+    CHECK(sht3x_fetch_sched_init(&e, SHT3X_I2C_ADDR_DFLT,
+                                 (sht3x_periodic_rate_t)(SHT3X_PERIODIC_ART +
+                                                         1),
+                                 0) == STATUS_ERR_INVALID_PARAMS);
+    CHECK(sht3x_fetch_sched_init(&e, SHT3X_I2C_ADDR_DFLT,
+                                 SHT3X_PERIODIC_0_5_MPS, 0) == STATUS_OK);
+    CHECK(e.period_usec == 2000000);
+}
+
+int main(void) {
+    srand(1);
+    test_drift(0);
+    test_drift(-50000);
+    test_drift(100000);
+    test_drift(2000);
+    test_recovery();
+    test_invalid_rate();
+    if (failures) {
+        printf("test_fetch_sched: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_fetch_sched: ok\n");
+    return 0;
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Flash log on the file-backed NOR flash simulation: the write amplification
+ * and the lifetime of the flash when logging full pages and when flushing
+ * every sample, the wear leveling over the sectors, and the samples that
+ * survive a reset and a power cut.
+ */
+
+#include "sht_flash_log.h"
+#include "sht_flash_sim.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define PAGE_SIZE 256
+#define SECTOR_SIZE 4096
+#define LOG_SECTORS 62
+#define NUM_SECTORS (LOG_SECTORS + 2)
+#define FLASH_SIZE ((uint32_t)NUM_SECTORS * SECTOR_SIZE)
+#define PAGES_PER_SECTOR (SECTOR_SIZE / PAGE_SIZE)
+#define RECORDS_PER_PAGE \
+    ((PAGE_SIZE - SHT_FLASH_LOG_HEADER_SIZE) / SHT_FLASH_LOG_RECORD_SIZE)
+/* samples that fill every page of the log once */
+#define RING_SAMPLES \
+    ((uint32_t)LOG_SECTORS * PAGES_PER_SECTOR * RECORDS_PER_PAGE)
+/* rated erase cycles and sample rate of the lifetime estimate: four sensors
+ * read every 10 s */
+#define RATED_CYCLES 100000.0
+#define SAMPLES_PER_S 0.4
+#define SECONDS_PER_YEAR (365.0 * 24 * 3600)
+
+static int failures;
+
+static char path[64];
+static sht_flash_sim_t sim;
+static uint32_t sector_erases[NUM_SECTORS];
+static sht_flash_log_t flash_log;
+static uint8_t page_buf[PAGE_SIZE];
+static sht_raw_sample_t samples[RING_SAMPLES];
+
+static void make_sample(sht_raw_sample_t* s, uint32_t k) {
+    s->timestamp_ms = 1000U * k;
+    s->sensor_id = (uint16_t)(k % 4);
+    s->seq = (uint16_t)k;
+    s->t_ticks = (uint16_t)(k * 7);
+    s->rh_ticks = (uint16_t)(k * 13);
+    s->status = k % 97 ? STATUS_OK : STATUS_ERR_INVALID_PARAMS;
+    s->bus = (uint8_t)(k % 3);
+    s->family = (uint8_t)(k % 3);
+}
+
+static uint8_t is_sample(const sht_raw_sample_t* s, uint32_t k) {
+    sht_raw_sample_t e;
+
+    make_sample(&e, k);
+    return s->timestamp_ms == e.timestamp_ms && s->sensor_id == e.sensor_id &&
+           s->seq == e.seq && s->t_ticks == e.t_ticks &&
+           s->rh_ticks == e.rh_ticks && s->status == e.status &&
+           s->bus == e.bus && s->family == e.family;
+}
+
+static void open_flash(void) {
+    CHECK(sht_flash_sim_open(&sim, path, FLASH_SIZE, SECTOR_SIZE,
+                             sector_erases) == STATUS_OK);
+    CHECK(sht_flash_log_init(&flash_log, &sht_flash_sim_ops, &sim, page_buf,
+                             0, PAGE_SIZE, SECTOR_SIZE,
+                             LOG_SECTORS) == STATUS_OK);
+    CHECK(sht_flash_log_set_directory(&flash_log, (uint32_t)LOG_SECTORS *
+                                                      SECTOR_SIZE) ==
+          STATUS_OK);
+}
+
+static void format_flash(void) {
+    uint16_t i;
+
+    unlink(path);
+    for (i = 0; i < NUM_SECTORS; ++i)
+        sector_erases[i] = 0;
+    open_flash();
+    CHECK(sht_flash_log_format(&flash_log) == STATUS_OK);
+    /* count the wear of the logging only */
+    for (i = 0; i < NUM_SECTORS; ++i)
+        sector_erases[i] = 0;
+    sim.max_sector_erases = 0;
+    sim.program_bytes = 0;
+    sim.erases = 0;
+}
+
+/* read the whole log: the samples must be consecutive and end at last */
+static uint32_t read_all(uint32_t last) {
+    uint32_t n = 0;
+    uint32_t i;
+    uint16_t got;
+
+    do {
+        got = sht_flash_log_read(&flash_log, &samples[n],
+                                 (uint16_t)(RING_SAMPLES - n > 1000
+                                                ? 1000
+                                                : RING_SAMPLES - n));
+        n += got;
+    } while (got && n < RING_SAMPLES);
+    CHECK(n > 0);
+    for (i = 0; i < n; ++i)
+        CHECK(is_sample(&samples[i], last + 1 - n + i));
+    return n;
+}
+
+/* log three rounds of the ring, flushing every flush_every samples; return
+ * the write amplification and the lifetime in years */
+static void log_samples(uint32_t count, uint32_t flush_every,
+                        double* amplification, double* years) {
+    sht_raw_sample_t s;
+    uint32_t min_erases = UINT32_MAX;
+    uint32_t k;
+    uint16_t i;
+
+    format_flash();
+    for (k = 0; k < count; ++k) {
+        make_sample(&s, k);
+        CHECK(sht_flash_log_append(&flash_log, &s) == STATUS_OK);
+        if (flush_every && (k + 1) % flush_every == 0)
+            CHECK(sht_flash_log_flush(&flash_log) == STATUS_OK);
+    }
+    CHECK(sht_flash_log_flush(&flash_log) == STATUS_OK);
+    CHECK(!sim.bad_programs);
+    CHECK(!flash_log.stats.flash_errors);
+
+    /* every log sector is erased as often as the others, the directory
+     * far less */
+    for (i = 0; i < LOG_SECTORS; ++i) {
+        if (sector_erases[i] < min_erases)
+            min_erases = sector_erases[i];
+    }
+    CHECK(sim.max_sector_erases - min_erases <= 1);
+    CHECK(sector_erases[LOG_SECTORS] + sector_erases[LOG_SECTORS + 1] <
+          sim.max_sector_erases);
+
+    *amplification =
+        (double)sim.program_bytes / ((double)count * SHT_FLASH_LOG_RECORD_SIZE);
+    *years = RATED_CYCLES * count /
+             (sim.max_sector_erases * SAMPLES_PER_S * SECONDS_PER_YEAR);
+}
+
+static void test_wear(void) {
+    double full_wa;
+    double full_years;
+    double flush_wa;
+    double flush_years;
+    uint32_t count = 3 * RING_SAMPLES;
+    uint32_t n;
+
+    /* full pages: a page header and the checkpoints of the directory */
+    log_samples(count, 0, &full_wa, &full_years);
+    CHECK(sim.max_sector_erases == 3 || sim.max_sector_erases == 4);
+    CHECK(full_wa > (double)PAGE_SIZE / (PAGE_SIZE - 10) - 0.01);
+    CHECK(full_wa < 1.06);
+    CHECK(full_years > 0.95 * RATED_CYCLES * RING_SAMPLES /
+                           (SAMPLES_PER_S * SECONDS_PER_YEAR));
+
+    /* the log survives a reset: all but the erased sector ahead of the head */
+    sht_flash_sim_close(&sim);
+    open_flash();
+    CHECK(sht_flash_log_mount(&flash_log) == STATUS_OK);
+    CHECK(flash_log.stats.mount_pages <= 2 * PAGES_PER_SECTOR);
+    n = read_all(count - 1);
+    CHECK(n >= RING_SAMPLES - PAGES_PER_SECTOR * RECORDS_PER_PAGE);
+    sht_flash_sim_close(&sim);
+
+    /* a page per sample: the header on every record and a page of wear */
+    log_samples(RING_SAMPLES, 1, &flush_wa, &flush_years);
+    CHECK(flush_wa > (double)(SHT_FLASH_LOG_HEADER_SIZE +
+                              SHT_FLASH_LOG_RECORD_SIZE) /
+                         SHT_FLASH_LOG_RECORD_SIZE);
+    CHECK(flush_years * (RECORDS_PER_PAGE - 1) < full_years);
+    sht_flash_sim_close(&sim);
+
+    printf("test_flash_log: full pages: write amplification %.3f, "
+           "%.0f years\n",
+           full_wa, full_years);
+    printf("test_flash_log: flush per sample: write amplification %.3f, "
+           "%.1f years\n",
+           flush_wa, flush_years);
+}
+
+static void test_power_cut(void) {
+    sht_raw_sample_t s;
+    uint32_t programmed;
+    uint32_t cut;
+    int16_t ret;
+    uint32_t k;
+    uint32_t n;
+
+    for (cut = 1; cut < 400; cut += 37) {
+        format_flash();
+        sim.power_cut_after = (int32_t)cut;
+        programmed = 0;
+        for (k = 0; k < RING_SAMPLES / 2; ++k) {
+            make_sample(&s, k);
+            ret = sht_flash_log_append(&flash_log, &s);
+            /* a cut in the erase ahead still leaves the page programmed */
+            if (flash_log.fill == 0)
+                programmed = k + 1;
+            if (ret != STATUS_OK)
+                break;
+        }
+        CHECK(!sim.powered);
+
+        /* the samples of the programmed pages are back, the torn page and
+         * the RAM buffer are lost */
+        sht_flash_sim_power_on(&sim);
+        CHECK(sht_flash_log_init(&flash_log, &sht_flash_sim_ops, &sim,
+                                 page_buf, 0, PAGE_SIZE, SECTOR_SIZE,
+                                 LOG_SECTORS) == STATUS_OK);
+        CHECK(sht_flash_log_set_directory(
+                  &flash_log, (uint32_t)LOG_SECTORS * SECTOR_SIZE) ==
+              STATUS_OK);
+        CHECK(sht_flash_log_mount(&flash_log) == STATUS_OK);
+        if (programmed) {
+            n = read_all(programmed - 1);
+            CHECK(n == programmed);
+        }
+        CHECK(!sim.bad_programs);
+
+        /* and logging goes on after them */
+        make_sample(&s, programmed);
+        CHECK(sht_flash_log_append(&flash_log, &s) == STATUS_OK);
+        CHECK(sht_flash_log_flush(&flash_log) == STATUS_OK);
+        CHECK(sht_flash_log_read(&flash_log, samples, 1) == 1);
+        CHECK(is_sample(&samples[0], programmed));
+        sht_flash_sim_close(&sim);
+    }
+}
+
+int main(void) {
+    snprintf(path, sizeof(path), "/tmp/test_flash_log.%d", (int)getpid());
+    test_wear();
+    test_power_cut();
+    unlink(path);
+    if (failures) {
+        printf("test_flash_log: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_flash_log: ok\n");
+    return 0;
+}
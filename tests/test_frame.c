@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fused CRC check and unpacking against the bitwise reference of the HAL:
+ * the CRC of every 16 bit word, and valid frames as well as frames with
+ * every single bit error, unpacked word by word, frame by frame and as a
+ * buffer of frames. The program is built twice, with the lookup tables and
+ * with the bitwise CRC used on AVR.
+ */
+
+#include "sensirion_common.h"
+#include "sht_frame.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/* odd, so the buffer ends with a frame outside the paired loop */
+#define NUM_FRAMES 37
+#define NUM_BYTES (NUM_FRAMES * SHT_FRAME_MEASUREMENT_SIZE)
+
+#if SHT_FRAME_CRC_TABLE
+#define NAME "test_frame"
+#else
+#define NAME "test_frame_bitwise"
+#endif
+
+static int failures;
+
+static uint32_t rng = 12345;
+
+static uint16_t random_word(void) {
+    rng = rng * 1103515245U + 12345U;
+    return (uint16_t)(rng >> 16);
+}
+
+/* the frames built word by word with the reference CRC */
+static void build(uint8_t* data, uint16_t* words) {
+    uint16_t i;
+
+    for (i = 0; i < 2 * NUM_FRAMES; ++i) {
+        uint8_t* p = &data[i * SHT_FRAME_WORD_SIZE];
+
+        words[i] = random_word();
+        p[0] = (uint8_t)(words[i] >> 8);
+        p[1] = (uint8_t)words[i];
+        p[2] = sensirion_common_generate_crc(p, 2);
+    }
+}
+
+/* number of leading frames whose words pass the reference check */
+static uint16_t reference_valid(const uint8_t* data) {
+    uint16_t i;
+
+    for (i = 0; i < 2 * NUM_FRAMES; ++i) {
+        const uint8_t* p = &data[i * SHT_FRAME_WORD_SIZE];
+
+        if (sensirion_common_check_crc(p, 2, p[2]) != NO_ERROR)
+            break;
+    }
+    return i / 2;
+}
+
+static void test_crc(void) {
+    uint8_t data[2];
+    uint32_t w;
+    uint32_t mismatches = 0;
+
+    for (w = 0; w <= 0xFFFF; ++w) {
+        data[0] = (uint8_t)(w >> 8);
+        data[1] = (uint8_t)w;
+        if (sht_frame_crc(data) != sensirion_common_generate_crc(data, 2))
+            mismatches++;
+    }
+    CHECK(mismatches == 0);
+    /* example of the datasheets */
+    data[0] = 0xBE;
+    data[1] = 0xEF;
+    CHECK(sht_frame_crc(data) == 0x92);
+}
+
+/* unpack a buffer whose first `valid` frames are intact */
+static void check_unpack(const uint8_t* data, const uint16_t* words,
+                         uint16_t valid) {
+    uint16_t t[NUM_FRAMES];
+    uint16_t rh[NUM_FRAMES];
+    uint16_t unpacked[2 * NUM_FRAMES];
+    uint16_t i;
+
+    memset(t, 0, sizeof(t));
+    memset(rh, 0, sizeof(rh));
+    CHECK(sht_frame_unpack_measurements(data, NUM_FRAMES, t, rh) == valid);
+    for (i = 0; i < valid; ++i) {
+        CHECK(t[i] == words[2 * i]);
+        CHECK(rh[i] == words[2 * i + 1]);
+    }
+
+    for (i = 0; i < NUM_FRAMES; ++i) {
+        const uint8_t* p = &data[i * SHT_FRAME_MEASUREMENT_SIZE];
+
+        CHECK((sht_frame_unpack_ticks(p, &t[0], &rh[0]) == STATUS_OK) ==
+              (sensirion_common_check_crc(p, 2, p[2]) == NO_ERROR &&
+               sensirion_common_check_crc(p + 3, 2, p[5]) == NO_ERROR));
+    }
+
+    CHECK((sht_frame_unpack_words(data, unpacked, 2 * NUM_FRAMES) ==
+           STATUS_OK) == (valid == NUM_FRAMES));
+    /* the words are unpacked even behind a CRC mismatch */
+    CHECK(memcmp(unpacked, words, sizeof(unpacked)) == 0);
+}
+
+static void test_frames(void) {
+    uint8_t data[NUM_BYTES];
+    uint16_t words[2 * NUM_FRAMES];
+    uint16_t flipped = 0;
+    uint16_t pos;
+    uint8_t bit;
+
+    build(data, words);
+    CHECK(reference_valid(data) == NUM_FRAMES);
+    check_unpack(data, words, NUM_FRAMES);
+
+    /* a single bit error anywhere, in a word or in its CRC, is caught */
+    for (pos = 0; pos < NUM_BYTES; ++pos) {
+        for (bit = 0; bit < 8; ++bit) {
+            uint16_t word = pos / SHT_FRAME_WORD_SIZE;
+            uint16_t saved = words[word];
+
+            data[pos] ^= (uint8_t)(1U << bit);
+            if (pos % SHT_FRAME_WORD_SIZE != 2)
+                words[word] ^= (uint16_t)(pos % SHT_FRAME_WORD_SIZE
+                                              ? 1U << bit
+                                              : 1U << (bit + 8));
+            CHECK(reference_valid(data) == pos / SHT_FRAME_MEASUREMENT_SIZE);
+            check_unpack(data, words, pos / SHT_FRAME_MEASUREMENT_SIZE);
+            words[word] = saved;
+            data[pos] ^= (uint8_t)(1U << bit);
+            flipped++;
+        }
+    }
+    CHECK(flipped == NUM_BYTES * 8);
+    CHECK(reference_valid(data) == NUM_FRAMES);
+}
+
+int main(void) {
+    test_crc();
+    test_frames();
+    if (failures) {
+        printf(NAME ": %d failures\n", failures);
+        return 1;
+    }
+    printf(NAME ": ok\n");
+    return 0;
+}
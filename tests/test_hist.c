@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Latency histograms: every reported percentile lies within the bucket
+ * error of the exact one, histograms merged across sensors report what a
+ * single histogram of all values does, values beyond the range land in the
+ * last bucket, and the recorder times the handle operations on the
+ * simulated bus per operation and per sensor, failed calls included.
+ */
+
+#include "sht_handle.h"
+#include "sht_hist.h"
+#include "sht_i2c_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_VALUES 100000
+#define NUM_SENSORS 4
+#define RANGE ((1UL << SHT_HIST_MAX_BITS) - 1)
+/* lowest value of the last bucket */
+#define LAST \
+    ((SHT_HIST_SUB_BUCKETS - 1) << (SHT_HIST_MAX_BITS - SHT_HIST_SUB_BITS))
+
+static int failures;
+
+static uint32_t values[NUM_VALUES];
+static sht_hist_t all;
+static sht_hist_t parts[NUM_SENSORS];
+static sht_hist_t merged;
+
+/* the reported value is the upper bound of the bucket of the exact one */
+static int within_bucket(uint32_t exact, uint32_t reported) {
+    if (exact < SHT_HIST_SUB_BUCKETS)
+        return reported == exact;
+    return reported >= exact &&
+           reported - exact <= exact >> (SHT_HIST_SUB_BITS - 1);
+}
+
+static int compare(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void test_buckets(void) {
+    sht_hist_t hist;
+    uint32_t v;
+
+    /* a value and one far above it: the median is the bucket of the value */
+    for (v = 0; v < LAST; v += v < 4096 ? 1 : v / 1000) {
+        sht_hist_reset(&hist);
+        sht_hist_record(&hist, v);
+        sht_hist_record(&hist, UINT32_MAX);
+        if (!within_bucket(v, sht_hist_percentile(&hist, 5000))) {
+            CHECK(within_bucket(v, sht_hist_percentile(&hist, 5000)));
+            break;
+        }
+    }
+
+    /* the last bucket ends at the range, unless values beyond the range
+     * were counted in it */
+    sht_hist_reset(&hist);
+    CHECK(sht_hist_percentile(&hist, 5000) == 0);
+    sht_hist_record(&hist, LAST);
+    sht_hist_record(&hist, RANGE);
+    CHECK(sht_hist_percentile(&hist, 0) == RANGE);
+    sht_hist_record(&hist, RANGE + 1);
+    sht_hist_record(&hist, 100000000);
+    CHECK(hist.counts[SHT_HIST_NUM_BUCKETS - 1] == 4);
+    CHECK(sht_hist_percentile(&hist, 0) == 100000000);
+    CHECK(sht_hist_percentile(&hist, 10000) == 100000000);
+}
+
+static void test_percentiles(void) {
+    static const uint16_t percents[] = {0, 1000, 5000, 9000, 9900,
+                                        9990, 9999, 10000};
+    uint32_t sorted[NUM_VALUES];
+    uint32_t rank;
+    uint32_t i;
+
+    /* a latency distribution: a body around 5 ms and a heavy tail */
+    srand(1);
+    sht_hist_reset(&all);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        sht_hist_reset(&parts[i]);
+    for (i = 0; i < NUM_VALUES; ++i) {
+        values[i] = 4000 + (uint32_t)(rand() % 2000);
+        if (!(rand() % 100))
+            values[i] += (uint32_t)(rand() % 1000) * (uint32_t)(rand() % 1000);
+        sorted[i] = values[i];
+        sht_hist_record(&all, values[i]);
+        sht_hist_record(&parts[i % NUM_SENSORS], values[i]);
+    }
+    qsort(sorted, NUM_VALUES, sizeof(sorted[0]), compare);
+
+    CHECK(all.count == NUM_VALUES);
+    CHECK(all.min == sorted[0] && all.max == sorted[NUM_VALUES - 1]);
+    for (i = 0; i < sizeof(percents) / sizeof(percents[0]); ++i) {
+        rank = (uint32_t)(((uint64_t)NUM_VALUES * percents[i] + 9999) / 10000);
+        if (!rank)
+            rank = 1;
+        CHECK(within_bucket(sorted[rank - 1],
+                            sht_hist_percentile(&all, percents[i])));
+    }
+
+    /* merging the per-sensor histograms gives the histogram of all values */
+    sht_hist_reset(&merged);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        sht_hist_merge(&merged, &parts[i]);
+    CHECK(merged.count == all.count);
+    CHECK(merged.min == all.min && merged.max == all.max);
+    for (i = 0; i < SHT_HIST_NUM_BUCKETS; ++i) {
+        if (merged.counts[i] != all.counts[i]) {
+            CHECK(merged.counts[i] == all.counts[i]);
+            break;
+        }
+    }
+    for (i = 0; i < sizeof(percents) / sizeof(percents[0]); ++i)
+        CHECK(sht_hist_percentile(&merged, percents[i]) ==
+              sht_hist_percentile(&all, percents[i]));
+}
+
+static uint32_t sim_now_usec(void* user_data) {
+    return (uint32_t)sht_i2c_sim.now_usec;
+}
+
+static void test_recorder(void) {
+    static sht_hist_t ops[SHT_HIST_NUM_OPS];
+    static sht_hist_t sensors[2 * SHT_HIST_NUM_OPS];
+    sht_handle_t handles[3] = {
+        {NULL, 0, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X},
+        {NULL, 1, 0, 0, 0, 0, 0x70, SHT_FAMILY_SHTC1},
+        {NULL, 2, 0, 0, 0, 0, 0x45, SHT_FAMILY_SHT3X}, /* no histograms */
+    };
+    sht_hist_recorder_t recorder;
+    sht_raw_sample_t sample;
+    const sht_hist_t* h;
+    uint32_t serial;
+    uint32_t start;
+    uint8_t dev;
+    uint16_t i;
+
+    sht_i2c_sim_init();
+    dev = sht_i2c_sim_add_sensor(0, SHT_I2C_SIM_ROOT, 0, 0x44,
+                                 SHT_FAMILY_SHT3X, 1);
+    sht_i2c_sim_add_sensor(0, SHT_I2C_SIM_ROOT, 0, 0x70, SHT_FAMILY_SHTC1, 2);
+    sht_i2c_sim_add_sensor(0, SHT_I2C_SIM_ROOT, 0, 0x45, SHT_FAMILY_SHT3X, 3);
+    sht_hist_recorder_init(&recorder, ops, sensors, 2, sim_now_usec, NULL);
+
+    for (i = 0; i < 3; ++i) {
+        CHECK(sht_hist_wake_up(&recorder, &handles[i]) == 0);
+        CHECK(sht_hist_read_serial(&recorder, &handles[i], &serial) == 0);
+        CHECK(serial == i + 1U);
+        CHECK(sht_hist_measure(&recorder, &handles[i]) == 0);
+        sht_i2c_sim.now_usec +=
+            sht_handle_measurement_duration_usec(&handles[i]);
+        CHECK(sht_hist_read_sample(&recorder, &handles[i], 0, &sample) == 0);
+        CHECK(sht_hist_sleep(&recorder, &handles[i]) == 0);
+    }
+    for (i = 0; i < SHT_HIST_NUM_OPS; ++i) {
+        if (i != SHT_HIST_OP_STATUS)
+            CHECK(ops[i].count == 3);
+    }
+    CHECK(sht_hist_recorder_sensor(&recorder, 2, SHT_HIST_OP_READ) == NULL);
+
+    /* a serial read takes its transfers and the command delay, as budgeted
+     * for the presence probes */
+    h = sht_hist_recorder_sensor(&recorder, 0, SHT_HIST_OP_SERIAL);
+    CHECK(h && h->count == 1);
+    CHECK(h && h->max > 1000 &&
+          h->max <= sht_handle_serial_duration_usec(&handles[0], 100));
+    /* the SHTC1 alone wakes up over the bus */
+    h = sht_hist_recorder_sensor(&recorder, 1, SHT_HIST_OP_WAKE_UP);
+    CHECK(h && h->count == 1 && h->max > 0);
+    h = sht_hist_recorder_sensor(&recorder, 0, SHT_HIST_OP_WAKE_UP);
+    CHECK(h && h->count == 1 && h->max == 0);
+
+    /* a failed call is timed too */
+    sht_i2c_sim.devices[dev].present = 0;
+    start = (uint32_t)sht_i2c_sim.now_usec;
+    CHECK(sht_hist_probe(&recorder, &handles[0]) != 0);
+    h = sht_hist_recorder_sensor(&recorder, 0, SHT_HIST_OP_STATUS);
+    CHECK(h && h->count == 1);
+    CHECK(h && h->max == (uint32_t)sht_i2c_sim.now_usec - start);
+    CHECK(ops[SHT_HIST_OP_STATUS].count == 1);
+}
+
+int main(void) {
+    test_buckets();
+    test_percentiles();
+    test_recorder();
+    if (failures) {
+        printf("test_hist: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_hist: ok\n");
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * InfluxDB line protocol batches posted to a local InfluxDB compatible
+ * endpoint: every batch is accepted, every sample arrives once with its
+ * tags, values and timestamp, and the fixed-point formatting matches printf.
+ */
+
+#include "sht_influx.h"
+#include "sht_influx_stub.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_SENSORS 5
+#define NUM_SAMPLES 1000
+#define EPOCH_MS 1700000000000ULL
+#define WRITE_PATH "/api/v2/write?org=o&bucket=b&precision=ms"
+
+static int failures;
+
+static void check_format(int32_t milli) {
+    char ours[16];
+    char ref[24];
+    uint8_t n = sht_influx_format_milli(ours, milli);
+
+    ours[n] = '\0';
+    snprintf(ref, sizeof(ref), "%s%ld.%03ld", milli < 0 ? "-" : "",
+             labs((long)milli / 1000), labs((long)milli % 1000));
+    if (strcmp(ours, ref) != 0) {
+        printf("format %ld: %s, expected %s\n", (long)milli, ours, ref);
+        failures++;
+    }
+}
+
+int main(void) {
+    static const int32_t edges[] = {0,     1,    -1,   999,       -999,
+                                    1000,  -1000, 45678, -45678,  INT32_MAX,
+                                    INT32_MIN + 1, INT32_MIN};
+    sht_handle_t handles[NUM_SENSORS];
+    sht_influx_prefix_t prefixes[NUM_SENSORS];
+    sht_influx_prefix_t prefix;
+    sht_raw_sample_t samples[NUM_SAMPLES];
+    sht_influx_batch_t batch;
+    const sht_influx_stub_point_t* points;
+    char buf[1024];
+    char tags[SHT_INFLUX_STUB_NAME_MAX];
+    uint32_t num_points;
+    uint32_t posts = 0;
+    int32_t t;
+    int32_t rh;
+    uint16_t port;
+    uint16_t i;
+    int j;
+
+    for (i = 0; i < sizeof(edges) / sizeof(edges[0]); ++i)
+        check_format(edges[i]);
+    srand(1);
+    for (j = 0; j < 100000; ++j)
+        check_format((int32_t)((uint32_t)rand() * 2654435761U));
+
+    port = sht_influx_stub_start();
+    if (!port) {
+        printf("test_influx: cannot start the endpoint\n");
+        return 1;
+    }
+
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        memset(&handles[i], 0, sizeof(handles[i]));
+        handles[i].id = (uint16_t)(100 + i);
+        handles[i].bus = (uint8_t)(i % 2);
+        handles[i].family = (uint8_t)(i % 3);
+        CHECK(sht_influx_prefix_init(&prefixes[i], "sht climate,v=2",
+                                     &handles[i], "room=lab\\ 1") == 0);
+    }
+    /* a prefix that does not fit */
+    CHECK(sht_influx_prefix_init(&prefix,
+                                 "a measurement name far too long to leave "
+                                 "room for the tags of the sensor",
+                                 &handles[0], "k=v") == STATUS_ERR_NO_SPACE);
+
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        sht_handle_t* h = &handles[i % NUM_SENSORS];
+
+        samples[i].timestamp_ms = 1000U * i;
+        samples[i].sensor_id = h->id;
+        samples[i].seq = h->seq++;
+        samples[i].t_ticks = (uint16_t)rand();
+        samples[i].rh_ticks = (uint16_t)rand();
+        samples[i].status = rand() % 10 ? 0 : (int16_t)-(1 + rand() % 9);
+        samples[i].bus = h->bus;
+        samples[i].family = h->family;
+    }
+
+    /* fill each batch up to the POST size, send, continue */
+    sht_influx_batch_init(&batch, buf, sizeof(buf), EPOCH_MS);
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        const sht_influx_prefix_t* p = &prefixes[i % NUM_SENSORS];
+
+        if (sht_influx_batch_add(&batch, p, &samples[i]) == 0)
+            continue;
+        CHECK(batch.lines > 0 && batch.len <= sizeof(buf));
+        CHECK(sht_influx_stub_post(port, WRITE_PATH, buf, batch.len) == 204);
+        posts++;
+        sht_influx_batch_reset(&batch);
+        CHECK(sht_influx_batch_add(&batch, p, &samples[i]) == 0);
+    }
+    CHECK(sht_influx_stub_post(port, WRITE_PATH, buf, batch.len) == 204);
+    posts++;
+
+    /* the endpoint rejects broken line protocol */
+    CHECK(sht_influx_stub_post(port, WRITE_PATH, "sht temperature=1.0.0 1\n",
+                               24) == 400);
+    CHECK(sht_influx_stub_rejected() == 1);
+
+    points = sht_influx_stub_points(&num_points);
+    CHECK(num_points == NUM_SAMPLES);
+    for (i = 0; i < NUM_SAMPLES && i < num_points; ++i) {
+        const sht_raw_sample_t* s = &samples[i];
+        const sht_influx_stub_point_t* pt = &points[i];
+
+        snprintf(tags, sizeof(tags), "sensor=%u,bus=%u,room=lab\\ 1",
+                 s->sensor_id, s->bus);
+        CHECK(strcmp(pt->measurement, "sht climate,v=2") == 0);
+        CHECK(strcmp(pt->tags, tags) == 0);
+        CHECK(pt->timestamp_ms == EPOCH_MS + s->timestamp_ms);
+        if (s->status == 0) {
+            sht_raw_sample_convert(s, &t, &rh);
+            CHECK(pt->has_values == 2 && !pt->has_status);
+            CHECK((int32_t)(pt->temperature * 1000 +
+                            (pt->temperature < 0 ? -0.5 : 0.5)) == t);
+            CHECK((int32_t)(pt->humidity * 1000 +
+                            (pt->humidity < 0 ? -0.5 : 0.5)) == rh);
+        } else {
+            CHECK(pt->has_status && pt->status == s->status);
+        }
+    }
+    sht_influx_stub_stop();
+
+    if (failures) {
+        printf("test_influx: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_influx: ok, %d samples in %u posts\n", NUM_SAMPLES, posts);
+    return 0;
+}
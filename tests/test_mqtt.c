@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * The MQTT publisher against a local broker process: mosquitto if it is
+ * installed, else sht_mqtt_broker. A publisher and a subscriber connection
+ * exchange CBOR batches through the broker; the broker is killed for a while
+ * and restarted, and every sample that was not dropped from the full queue
+ * must reach the subscriber, the backlog in full batches.
+ *
+ * Dropping samples from the full queue must not make a topic look older
+ * than its oldest remaining sample; that part runs without a broker.
+ */
+
+#include "sht_mqtt.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_TOPICS 4
+#define QUEUE_CAPACITY 200
+#define WINDOW_SIZE 4
+#define BATCH_CAPACITY 32
+#define PAYLOAD_SIZE SHT_CBOR_BATCH_SIZE(BATCH_CAPACITY, SHT_CBOR_MILLI)
+#define ONLINE_S 60
+#define OFFLINE_S 120
+#define TOTAL_S (ONLINE_S + OFFLINE_S)
+#define PKT_MAX 4096
+
+static int failures;
+
+typedef struct {
+    int fd;
+    size_t len;
+    uint8_t buf[PKT_MAX * 4];
+} conn_t;
+
+static conn_t pub_conn = {-1, 0, {0}};
+static conn_t sub_conn = {-1, 0, {0}};
+static uint16_t port;
+static pid_t broker;
+
+/* deliveries per topic and sample second */
+static uint8_t received[NUM_TOPICS][TOTAL_S];
+static uint32_t bad_samples;
+
+/* ---- broker process ---- */
+
+static uint16_t free_port(void) {
+    struct sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        getsockname(fd, (struct sockaddr*)&addr, &len) != 0)
+        addr.sin_port = 0;
+    close(fd);
+    return ntohs(addr.sin_port);
+}
+
+static void start_broker(void) {
+    char arg[8];
+
+    snprintf(arg, sizeof(arg), "%u", port);
+    broker = fork();
+    if (broker == 0) {
+        execlp("mosquitto", "mosquitto", "-p", arg, (char*)NULL);
+        execl("./sht_mqtt_broker", "sht_mqtt_broker", arg, (char*)NULL);
+        _exit(127);
+    }
+}
+
+static void kill_broker(void) {
+    kill(broker, SIGKILL);
+    waitpid(broker, NULL, 0);
+}
+
+/* ---- MQTT 3.1.1 client ---- */
+
+static int send_packet(conn_t* c, uint8_t type, const uint8_t* body,
+                       size_t len) {
+    uint8_t pkt[PKT_MAX];
+    size_t rem = len;
+    size_t n = 0;
+
+    pkt[n++] = type;
+    do {
+        pkt[n++] = (uint8_t)((rem & 0x7F) | (rem > 0x7F ? 0x80 : 0));
+        rem >>= 7;
+    } while (rem);
+    memcpy(&pkt[n], body, len);
+    n += len;
+    if (c->fd < 0 || send(c->fd, pkt, n, MSG_NOSIGNAL) != (ssize_t)n)
+        return -1;
+    return 0;
+}
+
+/* the next packet, waiting up to timeout_ms: 1 if one was read, 0 on
+ * timeout, -1 once the connection is closed */
+static int read_packet(conn_t* c, int timeout_ms, uint8_t* type,
+                       uint8_t* body, size_t* len) {
+    struct pollfd pfd;
+    size_t rem;
+    size_t hdr;
+    ssize_t r;
+    int shift;
+
+    for (;;) {
+        rem = 0;
+        shift = 0;
+        for (hdr = 1; hdr < c->len; ++hdr) {
+            rem |= (size_t)(c->buf[hdr] & 0x7F) << shift;
+            shift += 7;
+            if (!(c->buf[hdr] & 0x80))
+                break;
+        }
+        if (hdr < c->len && c->len >= hdr + 1 + rem) {
+            *type = c->buf[0];
+            memcpy(body, &c->buf[hdr + 1], rem);
+            *len = rem;
+            c->len -= hdr + 1 + rem;
+            memmove(c->buf, &c->buf[hdr + 1 + rem], c->len);
+            return 1;
+        }
+        if (c->fd < 0)
+            return -1;
+        pfd.fd = c->fd;
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, timeout_ms) <= 0)
+            return 0;
+        r = read(c->fd, c->buf + c->len, sizeof(c->buf) - c->len);
+        if (r <= 0) {
+            close(c->fd);
+            c->fd = -1;
+            return -1;
+        }
+        c->len += (size_t)r;
+    }
+}
+
+static int mqtt_connect(conn_t* c, const char* client_id) {
+    /* protocol name and level, clean session, 60 s keep alive */
+    static const uint8_t head[] = {0, 4, 'M', 'Q', 'T', 'T', 4, 0x02, 0, 60};
+    struct sockaddr_in addr;
+    uint8_t body[PKT_MAX];
+    uint8_t type;
+    size_t id_len = strlen(client_id);
+    size_t len;
+    int tries;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    c->len = 0;
+    for (tries = 0; tries < 500; ++tries) {
+        c->fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (connect(c->fd, (struct sockaddr*)&addr, sizeof(addr)) == 0)
+            break;
+        close(c->fd);
+        c->fd = -1;
+        usleep(10000);
+    }
+    memcpy(body, head, sizeof(head));
+    body[sizeof(head)] = 0;
+    body[sizeof(head) + 1] = (uint8_t)id_len;
+    memcpy(&body[sizeof(head) + 2], client_id, id_len);
+    if (send_packet(c, 0x10, body, sizeof(head) + 2 + id_len) != 0 ||
+        read_packet(c, 2000, &type, body, &len) != 1 || type != 0x20 ||
+        len != 2 || body[1] != 0)
+        return -1;
+    return 0;
+}
+
+static int mqtt_subscribe(conn_t* c, const char* filter) {
+    uint8_t body[PKT_MAX];
+    uint8_t type;
+    size_t n = strlen(filter);
+    size_t len;
+
+    body[0] = 0;
+    body[1] = 1;
+    body[2] = 0;
+    body[3] = (uint8_t)n;
+    memcpy(&body[4], filter, n);
+    body[4 + n] = 0;
+    if (send_packet(c, 0x82, body, 5 + n) != 0 ||
+        read_packet(c, 2000, &type, body, &len) != 1 || type != 0x90)
+        return -1;
+    return 0;
+}
+
+/* ---- publisher callbacks ---- */
+
+static uint8_t topic_of(void* user_data, const sht_raw_sample_t* sample) {
+    return (uint8_t)sample->sensor_id;
+}
+
+static int16_t publish(void* user_data, uint8_t topic, const uint8_t* payload,
+                       uint16_t len, uint16_t packet_id, uint8_t dup) {
+    uint8_t body[PKT_MAX];
+
+    /* topic "sht/<n>", packet id, payload */
+    body[0] = 0;
+    body[1] = 5;
+    memcpy(&body[2], "sht/", 4);
+    body[6] = (uint8_t)('0' + topic);
+    body[7] = (uint8_t)(packet_id >> 8);
+    body[8] = (uint8_t)packet_id;
+    memcpy(&body[9], payload, len);
+    if (send_packet(&pub_conn, (uint8_t)(0x32 | (dup ? 0x08 : 0)), body,
+                    9U + len) != 0)
+        return -1;
+    return 0;
+}
+
+static const sht_mqtt_ops_t ops = {topic_of, publish};
+
+/* ---- samples and their batches ---- */
+
+static void make_sample(sht_raw_sample_t* s, uint8_t topic, uint32_t k) {
+    s->timestamp_ms = 1000U * k;
+    s->sensor_id = topic;
+    s->seq = (uint16_t)k;
+    s->t_ticks = (uint16_t)(20000 + topic * 1000 + k * 7);
+    s->rh_ticks = (uint16_t)(30000 + k);
+    s->status = STATUS_OK;
+    s->bus = 0;
+    s->family = SHT_FAMILY_SHT3X;
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 |
+           p[3];
+}
+
+static int32_t get_int32(const uint8_t* p) {
+    uint32_t v = get32(&p[1]);
+
+    return (p[0] >> 5) == 1 ? -1 - (int32_t)v : (int32_t)v;
+}
+
+/* a PUBLISH forwarded to the subscriber: the batch has the fixed layout of
+ * sht_cbor.h, [ts, t, rh, q] entries of 18 bytes after a 32 byte header */
+static void deliver(const uint8_t* body, size_t len) {
+    size_t topic_len = (size_t)(body[0] << 8 | body[1]);
+    const uint8_t* cbor = &body[2 + topic_len];
+    const uint8_t* e;
+    sht_raw_sample_t s;
+    uint16_t count;
+    uint16_t i;
+    uint32_t k;
+    uint8_t topic = (uint8_t)(body[2 + topic_len - 1] - '0');
+    int32_t t;
+    int32_t rh;
+
+    count = (uint16_t)(cbor[30] << 8 | cbor[31]);
+    if (topic >= NUM_TOPICS || 2 + topic_len + SHT_CBOR_HEADER_SIZE +
+                                       (size_t)count * 18 != len) {
+        bad_samples++;
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        e = &cbor[SHT_CBOR_HEADER_SIZE + i * 18];
+        k = get32(&e[2]) / 1000;
+        if (k >= TOTAL_S) {
+            bad_samples++;
+            continue;
+        }
+        make_sample(&s, topic, k);
+        sht_raw_sample_convert(&s, &t, &rh);
+        if (get_int32(&e[6]) != t || get_int32(&e[11]) != rh || e[17]) {
+            bad_samples++;
+            continue;
+        }
+        received[topic][k]++;
+    }
+}
+
+static int in_flight(const sht_mqtt_t* pub) {
+    uint8_t i;
+
+    for (i = 0; i < pub->window_size; ++i) {
+        if (pub->window[i].state != SHT_MQTT_MSG_FREE)
+            return 1;
+    }
+    return 0;
+}
+
+/* read the acknowledgements of the publisher and the batches of the
+ * subscriber until the broker has nothing more to say */
+static void pump(sht_mqtt_t* pub, int timeout_ms) {
+    uint8_t body[PKT_MAX * 2];
+    uint8_t type;
+    size_t len;
+    int r;
+
+    while (pub->connected && in_flight(pub)) {
+        r = read_packet(&pub_conn, timeout_ms, &type, body, &len);
+        if (r < 0)
+            sht_mqtt_set_connected(pub, 0);
+        if (r <= 0)
+            break;
+        if ((type & 0xF0) == 0x40)
+            CHECK(sht_mqtt_puback(pub, (uint16_t)(body[0] << 8 | body[1])) ==
+                  STATUS_OK);
+    }
+    while (read_packet(&sub_conn, timeout_ms / 10, &type, body, &len) == 1) {
+        if ((type & 0xF0) == 0x30)
+            deliver(body, len);
+    }
+}
+
+static void connect_all(sht_mqtt_t* pub) {
+    CHECK(mqtt_connect(&sub_conn, "sht-sub") == 0);
+    CHECK(mqtt_subscribe(&sub_conn, "sht/#") == 0);
+    CHECK(mqtt_connect(&pub_conn, "sht-pub") == 0);
+    sht_mqtt_set_connected(pub, 1);
+}
+
+static void test_broker(void) {
+    static sht_raw_sample_t queue[QUEUE_CAPACITY];
+    static sht_mqtt_msg_t window[WINDOW_SIZE];
+    static uint8_t payloads[WINDOW_SIZE * PAYLOAD_SIZE];
+    sht_mqtt_t pub;
+    sht_raw_sample_t s;
+    uint32_t published;
+    uint32_t samples;
+    uint32_t unique = 0;
+    uint32_t now_ms;
+    uint32_t k;
+    uint8_t topic;
+    int rounds;
+
+    port = free_port();
+    CHECK(port != 0);
+    start_broker();
+    CHECK(sht_mqtt_init(&pub, NUM_TOPICS, queue, QUEUE_CAPACITY, window,
+                        WINDOW_SIZE, payloads, PAYLOAD_SIZE, &ops,
+                        NULL) == STATUS_OK);
+    connect_all(&pub);
+
+    /* one sample per topic and second; the broker is away for OFFLINE_S */
+    for (k = 0; k < TOTAL_S; ++k) {
+        if (k == ONLINE_S)
+            kill_broker();
+        for (topic = 0; topic < NUM_TOPICS; ++topic) {
+            make_sample(&s, topic, k);
+            CHECK(sht_mqtt_submit(&pub, &s) == STATUS_OK);
+        }
+        sht_mqtt_poll(&pub, 1000U * k);
+        pump(&pub, k < ONLINE_S ? 1000 : 0);
+    }
+    CHECK(!pub.connected);
+    CHECK(pub.stats.dropped > 0);
+
+    /* the backlog goes out in full batches once the broker is back */
+    start_broker();
+    connect_all(&pub);
+    published = pub.stats.published;
+    samples = pub.stats.samples;
+    now_ms = 1000U * TOTAL_S;
+    for (rounds = 0; rounds < 100 && (pub.count || in_flight(&pub));
+         ++rounds) {
+        sht_mqtt_poll(&pub, now_ms);
+        pump(&pub, 1000);
+        now_ms += 1000;
+    }
+    CHECK(!pub.count && !in_flight(&pub));
+    CHECK(pub.stats.published - published <=
+          (pub.stats.samples - samples) / BATCH_CAPACITY + NUM_TOPICS);
+    pump(&pub, 500);
+    kill_broker();
+
+    for (topic = 0; topic < NUM_TOPICS; ++topic) {
+        for (k = 0; k < TOTAL_S; ++k)
+            unique += received[topic][k] != 0;
+    }
+    CHECK(!bad_samples);
+    CHECK(unique == NUM_TOPICS * TOTAL_S - pub.stats.dropped);
+    printf("test_mqtt: %u samples, %u dropped, %u batches, %u resent\n",
+           unique, pub.stats.dropped, pub.stats.published, pub.stats.resent);
+}
+
+static uint32_t batches;
+
+static int16_t count_publish(void* user_data, uint8_t topic,
+                             const uint8_t* payload, uint16_t len,
+                             uint16_t packet_id, uint8_t dup) {
+    batches++;
+    return 0;
+}
+
+static const sht_mqtt_ops_t count_ops = {topic_of, count_publish};
+
+static void test_drop_age(void) {
+    sht_raw_sample_t queue[3];
+    sht_mqtt_msg_t window[2];
+    uint8_t payloads[2 * PAYLOAD_SIZE];
+    sht_mqtt_t pub;
+    sht_raw_sample_t s;
+
+    CHECK(sht_mqtt_init(&pub, 2, queue, 3, window, 2, payloads, PAYLOAD_SIZE,
+                        &count_ops, NULL) == STATUS_OK);
+    make_sample(&s, 0, 0);
+    sht_mqtt_submit(&pub, &s);
+    make_sample(&s, 0, 9);
+    sht_mqtt_submit(&pub, &s);
+    make_sample(&s, 1, 9);
+    sht_mqtt_submit(&pub, &s);
+    /* drops the sample of topic 0 at 0 ms */
+    s.timestamp_ms = 9500;
+    sht_mqtt_submit(&pub, &s);
+    CHECK(pub.stats.dropped == 1);
+    CHECK(pub.oldest_ms[0] == 9000);
+
+    sht_mqtt_set_connected(&pub, 1);
+    CHECK(sht_mqtt_poll(&pub, 10000) == 0);
+    CHECK(sht_mqtt_poll(&pub, 19000) == 2);
+    CHECK(batches == 2);
+}
+
+int main(void) {
+    test_drop_age();
+    test_broker();
+    if (failures) {
+        printf("test_mqtt: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_mqtt: ok\n");
+    return 0;
+}
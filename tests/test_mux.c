@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Mux path switching on nested multiplexers: after every selection only the
+ * muxes on the selected path may be open, so sensors sharing an address
+ * behind different muxes never answer together. Sweeps of a filtered order
+ * wait for the sensors they trigger, and a failed trigger behind a
+ * multi-channel mux only fails the sensors sharing its write.
+ */
+
+#include "sht_handle.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static int failures;
+
+/*
+ * bus 0:  A 0x70 -+- ch0 C 0x73 --- ch5 s3 0x44
+ *                 +- ch1 B 0x71 -+- ch0 s0 0x44
+ *                 |              +- ch2 s1 0x44
+ *                 +- ch1 E 0x72 --- ch0 s2 0x44
+ *                 +- ch2 s4 0x44
+ *         F 0x74 --- ch3 s5 0x44
+ * bus 1:  G 0x70 --- ch0 H 0x71 --- ch1 s6 0x44
+ */
+#define NUM_SENSORS 7
+
+static sht_mux_t mux_a;
+static sht_mux_t mux_b;
+static sht_mux_t mux_c;
+static sht_mux_t mux_e;
+static sht_mux_t mux_f;
+static sht_mux_t mux_g;
+static sht_mux_t mux_h;
+static sht_handle_t handles[NUM_SENSORS];
+
+static void setup(void) {
+    static const struct {
+        sht_mux_t* mux;
+        uint8_t channel;
+        uint8_t bus;
+    } where[NUM_SENSORS] = {
+        {&mux_b, 0, 0}, {&mux_b, 2, 0}, {&mux_e, 0, 0}, {&mux_c, 5, 0},
+        {&mux_a, 2, 0}, {&mux_f, 3, 0}, {&mux_h, 1, 1},
+    };
+    uint8_t a, b, c, e, f, g, h;
+    uint8_t i;
+
+    sht_i2c_sim_init();
+    a = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x70);
+    c = sht_i2c_sim_add_mux(0, a, 0, 0x73);
+    b = sht_i2c_sim_add_mux(0, a, 1, 0x71);
+    e = sht_i2c_sim_add_mux(0, a, 1, 0x72);
+    f = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x74);
+    g = sht_i2c_sim_add_mux(1, SHT_I2C_SIM_ROOT, 0, 0x70);
+    h = sht_i2c_sim_add_mux(1, g, 0, 0x71);
+    sht_i2c_sim_add_sensor(0, b, 0, 0x44, SHT_FAMILY_SHT3X, 100);
+    sht_i2c_sim_add_sensor(0, b, 2, 0x44, SHT_FAMILY_SHT3X, 101);
+    sht_i2c_sim_add_sensor(0, e, 0, 0x44, SHT_FAMILY_SHT3X, 102);
+    sht_i2c_sim_add_sensor(0, c, 5, 0x44, SHT_FAMILY_SHT3X, 103);
+    sht_i2c_sim_add_sensor(0, a, 2, 0x44, SHT_FAMILY_SHT3X, 104);
+    sht_i2c_sim_add_sensor(0, f, 3, 0x44, SHT_FAMILY_SHT3X, 105);
+    sht_i2c_sim_add_sensor(1, h, 1, 0x44, SHT_FAMILY_SHT3X, 106);
+
+    sht_mux_init(&mux_a, 0, 0x70, 0, NULL, 0);
+    sht_mux_init(&mux_c, 0, 0x73, 0, &mux_a, 0);
+    sht_mux_init(&mux_b, 0, 0x71, 0, &mux_a, 1);
+    sht_mux_init(&mux_e, 0, 0x72, 0, &mux_a, 1);
+    sht_mux_init(&mux_f, 0, 0x74, 0, NULL, 0);
+    sht_mux_init(&mux_g, 1, 0x70, 0, NULL, 0);
+    sht_mux_init(&mux_h, 1, 0x71, 0, &mux_g, 0);
+
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        handles[i].mux = where[i].mux;
+        handles[i].id = i;
+        handles[i].seq = 0;
+        handles[i].clock_khz = 0;
+        handles[i].bus = where[i].bus;
+        handles[i].channel = where[i].channel;
+        handles[i].addr = 0x44;
+        handles[i].family = SHT_FAMILY_SHT3X;
+    }
+    (void)c;
+    (void)e;
+    (void)f;
+}
+
+static uint8_t depth(const sht_mux_t* mux) {
+    uint8_t d = 0;
+
+    for (; mux; mux = mux->parent)
+        d++;
+    return d;
+}
+
+/* select a sensor, read its serial and check nothing else is open */
+static void visit(uint16_t i) {
+    uint32_t collisions = sht_i2c_sim.collisions;
+    uint32_t serial = 0;
+
+    CHECK(sht_mux_select_handle(&handles[i]) == 0);
+    CHECK(sht_handle_read_serial(&handles[i], &serial) == 0);
+    CHECK(serial == 100U + i);
+    CHECK(sht_i2c_sim.collisions == collisions);
+    CHECK(sht_i2c_sim_open_muxes(handles[i].bus) == depth(handles[i].mux));
+}
+
+/* a filtered order sweeps an SHT3x without the SHT4x listed before it: the
+ * wait must cover the 15 ms conversion of the swept sensor, not the 10 ms of
+ * the skipped one */
+static void test_filtered_sweep(void) {
+    sht_handle_t mixed[2] = {
+        {NULL, 0, 0, 0, 2, 0, 0x44, SHT_FAMILY_SHT4X},
+        {NULL, 1, 0, 0, 2, 0, 0x45, SHT_FAMILY_SHT3X},
+    };
+    sht_raw_sample_t samples[2];
+    uint16_t order[2];
+    uint16_t swept;
+
+    sht_i2c_sim_init();
+    sht_i2c_sim_add_sensor(2, SHT_I2C_SIM_ROOT, 0, 0x44, SHT_FAMILY_SHT4X, 0);
+    sht_i2c_sim_add_sensor(2, SHT_I2C_SIM_ROOT, 0, 0x45, SHT_FAMILY_SHT3X, 1);
+    sht_mux_plan(mixed, 2, order);
+    swept = order[0] == 1 ? order[0] : order[1];
+
+    CHECK(sht_mux_sweep(mixed, &swept, 1, 0, samples) == 0);
+    CHECK(samples[0].status == 0 && samples[0].sensor_id == 1);
+    CHECK(sht_i2c_sim.nacks == 0);
+}
+
+/* one missing sensor behind a multi-channel mux fails alone: the other
+ * addresses of its group are still triggered */
+static void test_trigger_group(void) {
+    sht_mux_t multi;
+    sht_handle_t group[4] = {
+        {&multi, 0, 0, 0, 3, 0, 0x45, SHT_FAMILY_SHT3X}, /* missing */
+        {&multi, 1, 0, 0, 3, 1, 0x44, SHT_FAMILY_SHT3X},
+        {&multi, 2, 0, 0, 3, 2, 0x44, SHT_FAMILY_SHT3X},
+        {&multi, 3, 0, 0, 3, 3, 0x45, SHT_FAMILY_SHT3X}, /* missing too */
+    };
+    uint8_t devices[4];
+    uint16_t order[4];
+    uint8_t m;
+    uint8_t i;
+
+    sht_i2c_sim_init();
+    m = sht_i2c_sim_add_mux(3, SHT_I2C_SIM_ROOT, 0, 0x70);
+    sht_mux_init(&multi, 3, 0x70, SHT_MUX_FLAG_MULTI_CHANNEL, NULL, 0);
+    for (i = 0; i < 4; ++i)
+        devices[i] = sht_i2c_sim_add_sensor(3, m, i, group[i].addr,
+                                            SHT_FAMILY_SHT3X, i);
+    sht_i2c_sim.devices[devices[0]].present = 0;
+    sht_i2c_sim.devices[devices[3]].present = 0;
+    sht_mux_plan(group, 4, order);
+    CHECK(order[0] == 0);
+
+    /* the write to 0x45 fails for both missing sensors, the one to 0x44
+     * reaches both present ones */
+    CHECK(sht_mux_sweep_trigger(group, order, 4) == 2);
+    CHECK(sht_i2c_sim.devices[devices[1]].writes == 1);
+    CHECK(sht_i2c_sim.devices[devices[2]].writes == 1);
+}
+
+int main(void) {
+    static const uint16_t parting[] = {0, 3, 2, 0, 1, 4, 2, 5, 0, 6, 1};
+    uint32_t writes;
+    uint16_t order[NUM_SENSORS];
+    uint16_t i;
+
+    setup();
+
+    /* the paths part at a different channel of a shared mux: the previous
+     * sub-mux must be closed before that channel is switched off */
+    for (i = 0; i < sizeof(parting) / sizeof(parting[0]); ++i)
+        visit(parting[i]);
+
+    /* a random walk over all sensors */
+    srand(1);
+    for (i = 0; i < 2000; ++i)
+        visit((uint16_t)(rand() % NUM_SENSORS));
+
+    /* switching channels of the leaf mux only rewrites the leaf */
+    visit(0);
+    writes = mux_a.writes;
+    visit(1);
+    CHECK(mux_a.writes == writes);
+
+    /* a planned sweep visits every sensor without collisions */
+    sht_mux_plan(handles, NUM_SENSORS, order);
+    for (i = 0; i < NUM_SENSORS; ++i)
+        visit(order[i]);
+
+    /* closing a bus leaves no mux open and the next selection reopens the
+     * path from the root */
+    visit(3);
+    CHECK(sht_mux_close(0) == 0);
+    CHECK(sht_i2c_sim_open_muxes(0) == 0);
+    writes = mux_a.writes + mux_c.writes;
+    CHECK(sht_mux_close(0) == 0);
+    CHECK(mux_a.writes + mux_c.writes == writes);
+    visit(3);
+    visit(6);
+    CHECK(sht_mux_close(1) == 0);
+    CHECK(sht_i2c_sim_open_muxes(1) == 0);
+
+    CHECK(sht_i2c_sim.collisions == 0);
+    CHECK(sht_i2c_sim.nacks == 0);
+
+    test_filtered_sweep();
+    test_trigger_group();
+
+    if (failures) {
+        printf("test_mux: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_mux: ok\n");
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bit packing round trips at every width from 0 to 16 with partial and full
+ * blocks, offsets reaching both ends of the width and ticks up to 0xFFFF.
+ * The blocks are decoded at the end of a page followed by an inaccessible
+ * one, so the tail lanes of the widest block must not load past its
+ * payload. The fused decoder matches sht_raw_sample_convert() for all three
+ * quantities.
+ */
+
+#include "sht_pack.h"
+#include "sht_sample.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static int failures;
+
+static uint32_t rng = 7;
+
+static uint32_t random_u32(void) {
+    rng = rng * 1103515245U + 12345U;
+    return rng >> 8;
+}
+
+/* the converted value of one tick, from the reference conversion */
+static int32_t reference_milli(uint16_t ticks, uint8_t quantity) {
+    sht_raw_sample_t sample;
+    int32_t temperature;
+    int32_t humidity;
+
+    memset(&sample, 0, sizeof(sample));
+    sample.family = quantity == SHT_PACK_HUMIDITY_SHT4X ? SHT_FAMILY_SHT4X
+                                                         : SHT_FAMILY_SHT3X;
+    sample.t_ticks = ticks;
+    sample.rh_ticks = ticks;
+    sht_raw_sample_convert(&sample, &temperature, &humidity);
+    return quantity == SHT_PACK_TEMPERATURE ? temperature : humidity;
+}
+
+static void round_trip(uint8_t* guarded, uint8_t width, uint8_t count) {
+    uint16_t ticks[SHT_PACK_BLOCK_SAMPLES];
+    uint16_t decoded[SHT_PACK_BLOCK_SAMPLES];
+    int32_t values[SHT_PACK_BLOCK_SAMPLES];
+    uint8_t encoded[SHT_PACK_BLOCK_MAX_SIZE];
+    uint32_t range = (1UL << width) - 1;
+    uint16_t base;
+    uint16_t size;
+    uint8_t* block;
+    uint8_t q;
+    uint16_t i;
+
+    /* the largest base puts the maximum at 0xFFFF */
+    base = (uint16_t)(count % 2 ? 0xFFFF - range
+                                : random_u32() % (0x10000 - range));
+    for (i = 0; i < count; ++i)
+        ticks[i] = (uint16_t)(base + (range ? random_u32() % (range + 1) : 0));
+    /* both ends of the range, so the width is exactly width */
+    ticks[0] = base;
+    if (count > 1)
+        ticks[count - 1] = (uint16_t)(base + range);
+
+    size = sht_pack_encode(ticks, count, encoded);
+    CHECK(size == SHT_PACK_BLOCK_SIZE(count > 1 ? width : 0));
+    CHECK(sht_pack_block_size(encoded) == size);
+    CHECK(sht_pack_block_count(encoded) == count);
+
+    block = guarded - size;
+    memcpy(block, encoded, size);
+    sht_pack_decode(block, decoded);
+    CHECK(memcmp(decoded, ticks, count * sizeof(ticks[0])) == 0);
+    /* the lanes past count are the base */
+    for (i = count; i < SHT_PACK_BLOCK_SAMPLES; ++i)
+        CHECK(decoded[i] == base);
+
+    for (q = SHT_PACK_TEMPERATURE; q <= SHT_PACK_HUMIDITY_SHT4X; ++q) {
+        uint16_t mismatches = 0;
+
+        sht_pack_decode_milli(block, q, values);
+        for (i = 0; i < count; ++i)
+            if (values[i] != reference_milli(ticks[i], q))
+                mismatches++;
+        CHECK(mismatches == 0);
+    }
+}
+
+int main(void) {
+    static const uint8_t counts[] = {1, 2, 17, 111, 112, 113, 127, 128};
+    long page = sysconf(_SC_PAGESIZE);
+    uint8_t* pages;
+    uint8_t width;
+    uint8_t i;
+
+    pages = mmap(NULL, 2 * page, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED || mprotect(pages + page, page, PROT_NONE)) {
+        perror("mmap");
+        return 1;
+    }
+    for (width = 0; width <= 16; ++width)
+        for (i = 0; i < sizeof(counts); ++i)
+            round_trip(pages + page, width, counts[i]);
+    munmap(pages, 2 * page);
+
+    if (failures) {
+        printf("test_pack: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_pack: ok\n");
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Presence tracking on the simulated bus: a probe is a single serial number
+ * read that fits the idle gap it was given, an unplugged sensor is
+ * quarantined and re-probed with an exponential backoff, and a different
+ * sensor plugged into its place is reported as a replacement.
+ */
+
+#include "sht_clock.h"
+#include "sht_handle.h"
+#include "sht_i2c_sim.h"
+#include "sht_mux.h"
+#include "sht_presence.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static int failures;
+
+/*
+ * bus 0:  M 0x71 -+- ch0 SHT3x 0x44
+ *                 +- ch1 SHT4x 0x44
+ *                 +- ch2 SHTC1 0x70
+ *         SHT3x 0x45
+ */
+#define NUM_SENSORS 4
+
+static sht_mux_t mux;
+static sht_handle_t handles[NUM_SENSORS];
+static uint8_t devices[NUM_SENSORS];
+
+/* the sensor writes of a serial number read, wake-up included */
+static const uint32_t serial_writes[NUM_SENSORS] = {1, 1, 4, 1};
+
+static uint32_t last_serial;
+static uint8_t last_replaced;
+static uint16_t onlines;
+
+static void setup(void) {
+    static const struct {
+        sht_mux_t* mux;
+        uint8_t channel;
+        uint8_t addr;
+        uint8_t family;
+    } where[NUM_SENSORS] = {
+        {&mux, 0, 0x44, SHT_FAMILY_SHT3X},
+        {&mux, 1, 0x44, SHT_FAMILY_SHT4X},
+        {&mux, 2, 0x70, SHT_FAMILY_SHTC1},
+        {NULL, 0, 0x45, SHT_FAMILY_SHT3X},
+    };
+    uint8_t m;
+    uint8_t i;
+
+    sht_i2c_sim_init();
+    m = sht_i2c_sim_add_mux(0, SHT_I2C_SIM_ROOT, 0, 0x71);
+    sht_mux_init(&mux, 0, 0x71, 0, NULL, 0);
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        devices[i] = sht_i2c_sim_add_sensor(
+            0, where[i].mux ? m : SHT_I2C_SIM_ROOT, where[i].channel,
+            where[i].addr, where[i].family, 300U + i);
+        handles[i].mux = where[i].mux;
+        handles[i].id = i;
+        handles[i].seq = 0;
+        handles[i].clock_khz = 0;
+        handles[i].bus = 0;
+        handles[i].channel = where[i].channel;
+        handles[i].addr = where[i].addr;
+        handles[i].family = where[i].family;
+    }
+}
+
+static int16_t on_online(void* user_data, sht_handle_t* handle,
+                         uint32_t serial, uint8_t replaced) {
+    last_serial = serial;
+    last_replaced = replaced;
+    onlines++;
+    return STATUS_OK;
+}
+
+/* the probe time the presence manager reserves for a handle */
+static uint32_t budget(const sht_handle_t* handle) {
+    uint16_t khz = sht_clock_handle_khz(handle);
+
+    return sht_mux_select_writes(handle) * SHT_HANDLE_TRANSFER_USEC(1, khz) +
+           sht_handle_serial_duration_usec(handle, khz);
+}
+
+static void test_budget(void) {
+    sht_presence_entry_t entry;
+    sht_presence_t presence;
+    uint64_t start;
+    uint32_t writes;
+    uint32_t usec;
+    uint8_t i;
+
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        setup();
+        CHECK(sht_presence_init(&presence, &handles[i], &entry, 1, 3, 100,
+                                800, on_online, NULL, 0) == STATUS_OK);
+
+        /* a gap one microsecond too short is left alone */
+        start = sht_i2c_sim.now_usec;
+        CHECK(sht_presence_poll(&presence, 0, budget(&handles[i]) - 1) == 1);
+        CHECK(presence.probes == 0);
+        CHECK(sht_i2c_sim.now_usec == start);
+
+        /* the probe fits its budget, which only counts the writes closing
+         * the previous path in excess, and reads the serial number once */
+        usec = budget(&handles[i]);
+        writes = sht_i2c_sim.devices[devices[i]].writes;
+        CHECK(sht_presence_poll(&presence, 0, usec) == 0);
+        CHECK(sht_i2c_sim.now_usec - start <= usec);
+        CHECK(sht_i2c_sim.now_usec - start > usec * 8 / 10);
+        CHECK(sht_i2c_sim.devices[devices[i]].writes - writes ==
+              serial_writes[i]);
+        CHECK(presence.probes == 1);
+        CHECK(last_serial == 300U + i);
+        CHECK(sht_presence_is_online(&presence, 0));
+    }
+}
+
+static void test_hot_plug(void) {
+    sht_presence_entry_t entries[NUM_SENSORS];
+    sht_presence_t presence;
+    sht_i2c_sim_device_t* sht4x;
+    uint16_t order[NUM_SENSORS] = {3, 2, 1, 0};
+    uint16_t online[NUM_SENSORS];
+    uint16_t t_ticks;
+    uint16_t rh_ticks;
+    uint32_t now_ms;
+    int16_t ret;
+    uint8_t k;
+
+    setup();
+    sht4x = &sht_i2c_sim.devices[devices[1]];
+    onlines = 0;
+    CHECK(sht_presence_init(&presence, handles, entries, NUM_SENSORS, 3, 100,
+                            800, on_online, NULL, 0) == STATUS_OK);
+    for (k = 0; k < NUM_SENSORS; ++k)
+        CHECK(sht_presence_poll(&presence, 0, 100000) < NUM_SENSORS);
+    CHECK(onlines == NUM_SENSORS && presence.replacements == 0);
+    CHECK(sht_presence_filter(&presence, order, NUM_SENSORS, online) ==
+          NUM_SENSORS);
+
+    /* unplugged: quarantined after three failed reads */
+    sht4x->present = 0;
+    for (k = 0; k < 3; ++k) {
+        CHECK(sht_presence_is_online(&presence, 1));
+        ret = sht_mux_select_handle(&handles[1]);
+        if (ret == STATUS_OK)
+            ret = sht_handle_read_ticks(&handles[1], &t_ticks, &rh_ticks);
+        CHECK(ret != STATUS_OK);
+        sht_presence_report(&presence, 1, ret, 0);
+    }
+    CHECK(!sht_presence_is_online(&presence, 1));
+    CHECK(presence.quarantines == 1);
+    CHECK(sht_presence_filter(&presence, order, NUM_SENSORS, online) == 3);
+    CHECK(online[0] == 3 && online[1] == 2 && online[2] == 0);
+
+    /* re-probed at 100, 200, 400, 800 and 1600 ms */
+    for (now_ms = 0; now_ms <= 2000; now_ms += 10)
+        CHECK(sht_presence_poll(&presence, now_ms, 100000) == NUM_SENSORS);
+    CHECK(presence.probes == NUM_SENSORS + 5);
+
+    /* a different sensor in its place comes back at the next probe */
+    sht4x->present = 1;
+    sht4x->serial = 401;
+    CHECK(sht_presence_poll(&presence, 2390, 100000) == NUM_SENSORS);
+    CHECK(sht_presence_poll(&presence, 2400, 100000) == 1);
+    CHECK(last_serial == 401 && last_replaced);
+    CHECK(presence.replacements == 1);
+    CHECK(sht_presence_filter(&presence, order, NUM_SENSORS, online) ==
+          NUM_SENSORS);
+}
+
+int main(void) {
+    test_budget();
+    test_hot_plug();
+    if (failures) {
+        printf("test_presence: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_presence: ok\n");
+    return 0;
+}
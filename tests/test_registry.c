@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Registry storage defined with SHT_REGISTRY_DEFINE(), iteration over the
+ * registered entries only, the per-sensor sample rings wrapping without
+ * touching the rings of their neighbours, the moving average filter and the
+ * schedules started on a timing wheel delivering into the rings.
+ */
+
+#include "sht_i2c_sim.h"
+#include "sht_registry.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_SENSORS 3
+#define DEPTH 4
+
+static int failures;
+
+SHT_REGISTRY_DEFINE(registry, NUM_SENSORS, DEPTH);
+
+static sht_raw_sample_t make_sample(uint16_t sensor_id, uint16_t seq,
+                                    uint16_t t_ticks, uint16_t rh_ticks) {
+    sht_raw_sample_t sample;
+
+    memset(&sample, 0, sizeof(sample));
+    sample.sensor_id = sensor_id;
+    sample.seq = seq;
+    sample.t_ticks = t_ticks;
+    sample.rh_ticks = rh_ticks;
+    sample.family = SHT_FAMILY_SHT3X;
+    return sample;
+}
+
+static void reset(uint8_t filter_shift) {
+    sht_handle_t handle = {NULL, 0xFFFF, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X};
+    uint16_t i;
+
+    registry.num_sensors = 0;
+    for (i = 0; i < NUM_SENSORS; ++i) {
+        handle.bus = (uint8_t)i;
+        CHECK(sht_registry_add(&registry, &handle, filter_shift, NULL) ==
+              STATUS_OK);
+    }
+}
+
+static void test_define(void) {
+    sht_handle_t handle = {NULL, 0xFFFF, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X};
+    sht_registry_entry_t* e;
+    uint16_t index = 0xFFFF;
+    uint16_t visited = 0;
+
+    CHECK(registry.entries == registry_storage.entries);
+    CHECK(registry.samples == registry_storage.samples);
+    CHECK(registry.capacity == NUM_SENSORS && registry.depth == DEPTH);
+    CHECK(sizeof(registry_storage.samples) ==
+          NUM_SENSORS * DEPTH * sizeof(sht_raw_sample_t));
+
+    /* nothing registered: the loop body never runs */
+    CHECK(registry.num_sensors == 0);
+    SHT_REGISTRY_FOR_EACH(&registry, e) {
+        visited++;
+    }
+    CHECK(visited == 0);
+
+    /* the id is the entry index, whatever the handle said */
+    handle.bus = 7;
+    CHECK(sht_registry_add(&registry, &handle, 0, &index) == STATUS_OK);
+    CHECK(index == 0 && registry.entries[0].handle.id == 0);
+    CHECK(registry.entries[0].handle.bus == 7);
+    handle.bus = 8;
+    CHECK(sht_registry_add(&registry, &handle, 0, &index) == STATUS_OK);
+    CHECK(index == 1 && registry.entries[1].handle.id == 1);
+
+    /* only the registered entries are visited, in index order */
+    SHT_REGISTRY_FOR_EACH(&registry, e) {
+        CHECK(e == &registry.entries[visited]);
+        CHECK(e->handle.id == visited);
+        visited++;
+    }
+    CHECK(visited == 2);
+
+    CHECK(sht_registry_add(&registry, &handle, 0, NULL) == STATUS_OK);
+    index = 0xFFFF;
+    CHECK(sht_registry_add(&registry, &handle, 0, &index) ==
+          STATUS_ERR_NO_SPACE);
+    CHECK(index == 0xFFFF && registry.num_sensors == NUM_SENSORS);
+}
+
+static void test_ring(void) {
+    sht_raw_sample_t sample;
+    const sht_raw_sample_t* s;
+    uint16_t i;
+
+    reset(0);
+    memset(registry_storage.samples, 0xA5, sizeof(registry_storage.samples));
+
+    /* partially filled, newest first */
+    CHECK(sht_registry_sample(&registry, 1, 0) == NULL);
+    for (i = 0; i < 2; ++i) {
+        sample = make_sample(1, i, 1000, 2000);
+        CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    }
+    CHECK(registry.entries[1].count == 2);
+    s = sht_registry_sample(&registry, 1, 0);
+    CHECK(s && s->seq == 1);
+    s = sht_registry_sample(&registry, 1, 1);
+    CHECK(s && s->seq == 0);
+    CHECK(sht_registry_sample(&registry, 1, 2) == NULL);
+
+    /* wrapped more than once: the oldest samples are dropped */
+    for (; i < 11; ++i) {
+        sample = make_sample(1, i, 1000, 2000);
+        CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    }
+    CHECK(registry.entries[1].count == DEPTH);
+    for (i = 0; i < DEPTH; ++i) {
+        s = sht_registry_sample(&registry, 1, i);
+        CHECK(s && s->seq == 10 - i);
+        CHECK(s >= &registry.samples[DEPTH] &&
+              s < &registry.samples[2 * DEPTH]);
+    }
+    CHECK(sht_registry_sample(&registry, 1, DEPTH) == NULL);
+
+    /* the rings of the neighbours are untouched */
+    for (i = 0; i < DEPTH; ++i) {
+        CHECK(registry.samples[i].seq == 0xA5A5);
+        CHECK(registry.samples[2 * DEPTH + i].seq == 0xA5A5);
+    }
+    CHECK(registry.entries[0].count == 0 && registry.entries[2].count == 0);
+    CHECK(sht_registry_sample(&registry, 0, 0) == NULL);
+
+    /* unknown sensors */
+    sample = make_sample(NUM_SENSORS, 0, 1000, 2000);
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_ERR_INVALID_PARAMS);
+    CHECK(sht_registry_sample(&registry, NUM_SENSORS, 0) == NULL);
+}
+
+static void test_filter(void) {
+    sht_registry_filter_t* f = &registry.entries[0].filter;
+    sht_raw_sample_t sample;
+    int32_t t0, rh0, t1, rh1;
+
+    reset(2);
+    sample = make_sample(0, 0, 26000, 30000);
+    sht_raw_sample_convert(&sample, &t0, &rh0);
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    CHECK(f->primed && f->temperature == t0 && f->humidity == rh0);
+
+    /* a quarter of the way towards the new values, rounding down */
+    sample = make_sample(0, 1, 20000, 40000);
+    sht_raw_sample_convert(&sample, &t1, &rh1);
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    CHECK(t1 < t0 && rh1 > rh0);
+    CHECK(f->temperature == t0 + ((t1 - t0) >> 2));
+    CHECK(f->temperature <= t0 + (t1 - t0) / 4);
+    CHECK(f->humidity == rh0 + (rh1 - rh0) / 4);
+
+    /* a failed read is stored but not filtered */
+    t0 = f->temperature;
+    rh0 = f->humidity;
+    sample = make_sample(0, 2, 0, 0);
+    sample.status = -1;
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    CHECK(f->temperature == t0 && f->humidity == rh0);
+    CHECK(sht_registry_sample(&registry, 0, 0)->status == -1);
+
+    /* the other sensors are not primed */
+    CHECK(!registry.entries[1].filter.primed);
+
+    /* without filtering the filter follows the last sample */
+    reset(0);
+    f = &registry.entries[0].filter;
+    sample = make_sample(0, 0, 26000, 30000);
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    sample = make_sample(0, 1, 20000, 40000);
+    CHECK(sht_registry_push(&registry, &sample) == STATUS_OK);
+    CHECK(f->temperature == t1 && f->humidity == rh1);
+}
+
+static void test_start(void) {
+    sht_registry_entry_t* e;
+    const sht_raw_sample_t* s;
+    sht_wheel_t wheel;
+    uint32_t dur_ms;
+    uint32_t t;
+    uint16_t i;
+
+    /* 1 ms ticks, one sensor per bus, a sample every 90 ms */
+    reset(0);
+    sht_i2c_sim_init();
+    for (i = 0; i < NUM_SENSORS; ++i)
+        sht_i2c_sim_add_sensor((uint8_t)i, SHT_I2C_SIM_ROOT, 0, 0x44,
+                               SHT_FAMILY_SHT3X, i + 1);
+    sht_wheel_init(&wheel, 0, 1000);
+    sht_registry_start(&registry, &wheel, 90, 5, 2, 10);
+    for (t = 0; t < 10 + 2 * 90; ++t) {
+        sht_i2c_sim.now_usec = (uint64_t)t * 1000;
+        sht_wheel_run_sensors(&wheel, t, sht_registry_on_sample, &registry);
+    }
+
+    /* the first measurements are spread over one period */
+    dur_ms = sht_handle_measurement_duration_usec(&registry.entries[0].handle)
+             / 1000;
+    i = 0;
+    SHT_REGISTRY_FOR_EACH(&registry, e) {
+        CHECK(e->count == 2);
+        s = sht_registry_sample(&registry, i, 1);
+        CHECK(s && s->status == STATUS_OK && s->sensor_id == i);
+        CHECK(s && s->bus == i && s->seq == 0);
+        CHECK(s && s->timestamp_ms == 10 + 30U * i + dur_ms + 1);
+        s = sht_registry_sample(&registry, i, 0);
+        CHECK(s && s->seq == 1);
+        CHECK(e->filter.primed);
+        i++;
+    }
+    CHECK(sht_i2c_sim.nacks == 0);
+}
+
+int main(void) {
+    test_define();
+    test_ring();
+    test_filter();
+    test_start();
+    if (failures) {
+        printf("test_registry: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_registry: ok\n");
+    return 0;
+}
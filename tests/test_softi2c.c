@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bit-banged master on the simulated GPIO bus: the SCL half periods at 100
+ * and 400 kHz, the exact edges, GPIO accesses and duration of a write and a
+ * read, and open drain emulation with direction changes. Clock stretching
+ * within and beyond the timeouts, the bus clear after a timeout and before
+ * a start finding SDA held low, and a circuit breaker keeping a stretching
+ * sensor from taking the bus time of every sweep. The master is built as
+ * the HAL, so the sensor is read through the handle functions.
+ */
+
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_breaker.h"
+#include "sht_handle.h"
+#include "sht_softi2c.h"
+#include "sht_softi2c_sim.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define ADDR 0x44
+#define STRETCH_TIMEOUT_USEC 2000
+#define TRANSACTION_TIMEOUT_USEC 5000
+/* start, address, six bytes and stop at 100 kHz, with margin */
+#define CLOCKING_USEC 1000
+
+static int failures;
+
+static sht_softi2c_sim_t sim;
+static sht_softi2c_t i2c;
+
+static void init_bus(uint16_t clock_khz, uint8_t flags) {
+    sht_softi2c_sim_init(&sim, ADDR);
+    sht_softi2c_init(&i2c, &sht_softi2c_sim_gpio, &sim, SHT_SOFTI2C_SIM_SCL,
+                     SHT_SOFTI2C_SIM_SDA, clock_khz, flags);
+    sht_softi2c_sim_reset_stats(&sim);
+}
+
+/* a command write and a six byte read with known edges and GPIO accesses */
+static void check_transfers(uint16_t half_usec) {
+    static const uint8_t expected[6] = {0x66, 0x66, 0x93, 0x80, 0x00, 0xA2};
+    uint8_t cmd[1] = {0xA5};
+    uint8_t data[6];
+    uint8_t i;
+
+    for (i = 0; i < 6; ++i)
+        sim.response[i] = expected[i];
+    sim.response_len = 6;
+
+    /* start 6 accesses, 30 per byte, stop 4; SCL falls at the start, rises
+     * and falls for nine clocks per byte and rises at the stop; the
+     * transaction lasts one half period after the start, 18 per byte and
+     * two before the stop */
+    sht_softi2c_sim_reset_stats(&sim);
+    CHECK(sht_softi2c_write(&i2c, ADDR, cmd, 1) == STATUS_OK);
+    CHECK(sim.written_len == 1 && sim.written[0] == 0xA5);
+    CHECK(sim.gpio_ops == 6 + 2 * 30 + 4);
+    CHECK(sim.scl_edges == 1 + 2 * 18 + 1);
+    CHECK(sim.sda_edges == 16);
+    CHECK(sim.transaction_usec == (1 + 2 * 18 + 2) * half_usec);
+    CHECK(!sim.violations);
+    CHECK(sim.min_scl_high_usec == half_usec);
+    CHECK(sim.min_scl_low_usec == half_usec);
+
+    /* 31 accesses per byte read */
+    sht_softi2c_sim_reset_stats(&sim);
+    CHECK(sht_softi2c_read(&i2c, ADDR, data, 6) == STATUS_OK);
+    for (i = 0; i < 6; ++i)
+        CHECK(data[i] == expected[i]);
+    CHECK(sim.gpio_ops == 6 + 30 + 6 * 31 + 4);
+    CHECK(sim.scl_edges == 1 + 7 * 18 + 1);
+    CHECK(sim.transaction_usec == (1 + 7 * 18 + 2) * half_usec);
+    CHECK(!sim.violations);
+    CHECK(sim.min_scl_high_usec == half_usec);
+    CHECK(sim.min_scl_low_usec == half_usec);
+}
+
+static void test_timing(void) {
+    /* 100 kHz: 4.0 us high and 4.7 us low at least, 5 us half periods */
+    init_bus(100, 0);
+    check_transfers(5);
+    CHECK(sim.min_scl_high_usec >= 4 && sim.min_scl_low_usec >= 5);
+
+    /* 400 kHz: 0.6 us and 1.3 us, the half period rounds up to 2 us */
+    init_bus(400, 0);
+    check_transfers(2);
+    CHECK(sim.min_scl_high_usec >= 1 && sim.min_scl_low_usec >= 2);
+}
+
+static void test_open_drain(void) {
+    /* pins switched between input and a low output: the lines see the same
+     * edges, each access being a direction change instead of a write */
+    init_bus(100, SHT_SOFTI2C_FLAG_EMULATE_OPEN_DRAIN);
+    CHECK(!sim.latch[SHT_SOFTI2C_SIM_SCL] && !sim.latch[SHT_SOFTI2C_SIM_SDA]);
+    CHECK(sim.scl && sim.sda);
+    check_transfers(5);
+    CHECK(!sim.latch[SHT_SOFTI2C_SIM_SCL] && !sim.latch[SHT_SOFTI2C_SIM_SDA]);
+    CHECK(!sim.output[SHT_SOFTI2C_SIM_SCL] && !sim.output[SHT_SOFTI2C_SIM_SDA]);
+}
+
+static void setup(void) {
+    sht_softi2c_sim_init(&sim, ADDR);
+    sht_softi2c_init(&i2c, &sht_softi2c_sim_gpio, &sim, SHT_SOFTI2C_SIM_SCL,
+                     SHT_SOFTI2C_SIM_SDA, 100, 0);
+    sht_softi2c_set_timeouts(&i2c, STRETCH_TIMEOUT_USEC,
+                             TRANSACTION_TIMEOUT_USEC);
+    sht_softi2c_hal_register(0, &i2c);
+    CHECK(sensirion_i2c_select_bus(0) == STATUS_OK);
+}
+
+/* a measurement of the sensor with valid CRCs */
+static void set_ticks(uint16_t t_ticks, uint16_t rh_ticks) {
+    sim.response[0] = (uint8_t)(t_ticks >> 8);
+    sim.response[1] = (uint8_t)t_ticks;
+    sim.response[2] = sensirion_common_generate_crc(&sim.response[0], 2);
+    sim.response[3] = (uint8_t)(rh_ticks >> 8);
+    sim.response[4] = (uint8_t)rh_ticks;
+    sim.response[5] = sensirion_common_generate_crc(&sim.response[3], 2);
+    sim.response_len = 6;
+}
+
+static int16_t read_ticks(uint32_t* usec) {
+    sht_handle_t handle = {NULL, 0, 0, 0, 0, 0, ADDR, SHT_FAMILY_SHT3X};
+    uint32_t start = sim.now_usec;
+    uint16_t t_ticks = 0;
+    uint16_t rh_ticks = 0;
+    int16_t ret;
+
+    ret = sht_handle_read_ticks(&handle, &t_ticks, &rh_ticks);
+    *usec = sim.now_usec - start;
+    if (ret == STATUS_OK)
+        CHECK(t_ticks == 0x6666 && rh_ticks == 0x8000);
+    return ret;
+}
+
+static void test_stretch(void) {
+    uint32_t usec;
+
+    /* within the stretch timeout the read waits for the sensor */
+    setup();
+    set_ticks(0x6666, 0x8000);
+    sim.stretch_usec = STRETCH_TIMEOUT_USEC / 2;
+    CHECK(read_ticks(&usec) == STATUS_OK);
+    CHECK(usec >= STRETCH_TIMEOUT_USEC / 2);
+    CHECK(!i2c.timeouts && !i2c.bus_clears && !sim.violations);
+
+    /* beyond it the read gives up, clears the bus and the sensor answers
+     * the next read again */
+    sim.stretch_usec = 10 * STRETCH_TIMEOUT_USEC;
+    CHECK(read_ticks(&usec) == STATUS_ERR_TIMEOUT);
+    CHECK(usec <= 2 * STRETCH_TIMEOUT_USEC + CLOCKING_USEC);
+    CHECK(i2c.timeouts >= 1 && i2c.bus_clears >= 1);
+    sim.stretch_usec = 0;
+    sim.now_usec += 10 * STRETCH_TIMEOUT_USEC;
+    CHECK(read_ticks(&usec) == STATUS_OK);
+    CHECK(usec <= CLOCKING_USEC);
+
+    /* the transaction budget caps the stretching below the stretch
+     * timeout */
+    sht_softi2c_set_timeouts(&i2c, 10 * STRETCH_TIMEOUT_USEC,
+                             STRETCH_TIMEOUT_USEC);
+    sim.stretch_usec = 5 * STRETCH_TIMEOUT_USEC;
+    CHECK(read_ticks(&usec) == STATUS_ERR_TIMEOUT);
+    CHECK(usec <= STRETCH_TIMEOUT_USEC + 10 * STRETCH_TIMEOUT_USEC +
+                      CLOCKING_USEC);
+    CHECK(!sim.violations);
+}
+
+static void test_bus_clear(void) {
+    uint8_t cmd[2] = {0x24, 0x00};
+    uint32_t clears;
+
+    /* a sensor left in the middle of a read holds SDA low: the next start
+     * clocks it free */
+    setup();
+    sim.response[0] = 0x00;
+    sim.response_len = 1;
+    sim.slave_sda = 0;
+    sht_softi2c_sim_gpio.delay_usec(&sim, 0);
+    sim.state = 2; /* transmitting */
+    sim.bit = 0;
+    sim.tx_pos = 0;
+    CHECK(!sim.sda);
+    clears = i2c.bus_clears;
+    CHECK(sensirion_i2c_write(ADDR, cmd, 2) == STATUS_OK);
+    CHECK(i2c.bus_clears == clears + 1);
+    CHECK(sim.written_len == 2 && sim.written[0] == 0x24);
+
+    /* a line that stays low is reported, not clocked forever */
+    sim.slave_sda = 0;
+    sht_softi2c_sim_gpio.delay_usec(&sim, 0);
+    sim.state = 3; /* not addressed, ignores the clock */
+    CHECK(sht_softi2c_bus_clear(&i2c) == STATUS_ERR_BUS_STUCK);
+    CHECK(sensirion_i2c_write(ADDR, cmd, 2) != STATUS_OK);
+    sim.slave_sda = 1;
+    CHECK(sensirion_i2c_write(ADDR, cmd, 2) == STATUS_OK);
+}
+
+static void test_breaker(void) {
+    static const sht_breaker_config_t config = {100, 800, 2};
+    sht_breaker_t breaker;
+    sht_raw_sample_t sample;
+    uint16_t order = 0;
+    uint16_t allowed;
+    uint16_t trials = 0;
+    uint32_t bus_usec = 0;
+    uint32_t usec;
+    uint32_t now_ms;
+
+    setup();
+    set_ticks(0x6666, 0x8000);
+    sim.stretch_usec = 10 * STRETCH_TIMEOUT_USEC;
+    sht_breaker_init(&breaker, 1, &config);
+
+    /* one sweep every 10 ms for a second: two failures open the breaker,
+     * then only the trials after 100, 200, 400 and 800 ms cost bus time */
+    for (now_ms = 0; now_ms < 1000; now_ms += 10) {
+        if (!sht_breaker_filter(&breaker, &order, 1, now_ms, &allowed))
+            continue;
+        trials++;
+        sample.status = read_ticks(&usec);
+        bus_usec += usec;
+        sim.now_usec += 10 * STRETCH_TIMEOUT_USEC;
+        sht_breaker_report_samples(&breaker, &config, &order, &sample, 1,
+                                   now_ms);
+    }
+    CHECK(trials == 5 && breaker.trips == 4);
+    CHECK(breaker.skipped == 100 - 5);
+    CHECK(bus_usec <= 5 * (2 * STRETCH_TIMEOUT_USEC + CLOCKING_USEC));
+    CHECK(breaker.state == SHT_BREAKER_OPEN);
+
+    /* once the sensor behaves, the next trial closes the breaker */
+    sim.stretch_usec = 0;
+    CHECK(sht_breaker_filter(&breaker, &order, 1, 2000, &allowed) == 1);
+    CHECK(breaker.state == SHT_BREAKER_HALF_OPEN);
+    sample.status = read_ticks(&usec);
+    CHECK(sample.status == STATUS_OK);
+    sht_breaker_report_samples(&breaker, &config, &order, &sample, 1, 2000);
+    CHECK(breaker.state == SHT_BREAKER_CLOSED);
+}
+
+int main(void) {
+    test_timing();
+    test_open_drain();
+    test_stretch();
+    test_bus_clear();
+    test_breaker();
+    if (failures) {
+        printf("test_softi2c: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_softi2c: ok\n");
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * The sysfs backend against a fake sysfs tree: device lookup by driver name
+ * and I2C location, hwmon and IIO attributes, re-reads of changed values and
+ * the error paths.
+ */
+
+#include "sht_sysfs.h"
+#include "sht_sysfs_tree.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static int failures;
+
+static int build(const char* root) {
+    return sht_sysfs_tree_add_hwmon(root, 0, "sht3x", 1, 0x44, 23450, 45600) ||
+           sht_sysfs_tree_add_hwmon(root, 1, "sht3x", 1, 0x45, -5000, 80000) ||
+           sht_sysfs_tree_add_hwmon(root, 2, "lm75", 1, 0x48, 30000, 0) ||
+           sht_sysfs_tree_add_hwmon(root, 3, "sht3x", 4, 0x44, 0, 0) ||
+           sht_sysfs_tree_unlink(root, "class/hwmon/hwmon3",
+                                 "humidity1_input") ||
+           sht_sysfs_tree_add_iio(root, 0, "sht4x", 2, 0x44, 2000, "10.5",
+                                  "100", 500, "100");
+}
+
+int main(void) {
+    char root[SHT_SYSFS_TREE_PATH_MAX];
+    sht_sysfs_dev_t dev;
+    sht_handle_t handle = {NULL, 7, 0, 0, 1, 0, 0x44, SHT_FAMILY_SHT3X};
+    sht_raw_sample_t sample;
+    int32_t t = 0;
+    int32_t rh = 0;
+
+    if (sht_sysfs_tree_create(root) != 0 || build(root) != 0) {
+        printf("test_sysfs: cannot build the fake tree\n");
+        return 1;
+    }
+
+    /* hwmon, by location */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT3X, 1, 0x45) == 0);
+    CHECK(dev.iio == 0);
+    CHECK(sht_sysfs_read(&dev, &t, &rh) == 0);
+    CHECK(t == -5000 && rh == 80000);
+    sht_sysfs_close(&dev);
+
+    /* the open files see new values */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT3X, 1, 0x44) == 0);
+    CHECK(sht_sysfs_read(&dev, &t, &rh) == 0);
+    CHECK(t == 23450 && rh == 45600);
+    sht_sysfs_tree_write(root, "class/hwmon/hwmon0", "temp1_input", "-12125");
+    CHECK(sht_sysfs_read(&dev, &t, &rh) == 0);
+    CHECK(t == -12125 && rh == 45600);
+
+    /* raw samples carry the values as ticks of the family */
+    CHECK(sht_sysfs_read_sample(&dev, &handle, 1000, &sample) == 0);
+    CHECK(sample.status == 0 && sample.seq == 0 && handle.seq == 1);
+    CHECK(sample.sensor_id == 7 && sample.timestamp_ms == 1000);
+    sht_raw_sample_convert(&sample, &t, &rh);
+    CHECK(t >= -12125 - 3 && t <= -12125 + 3);
+    CHECK(rh >= 45600 - 2 && rh <= 45600 + 2);
+
+    sht_sysfs_tree_write(root, "class/hwmon/hwmon0", "temp1_input", "n/a");
+    CHECK(sht_sysfs_read(&dev, &t, &rh) == STATUS_ERR_BAD_DATA);
+    CHECK(sht_sysfs_read_sample(&dev, &handle, 2000, &sample) ==
+          STATUS_ERR_BAD_DATA);
+    CHECK(sample.status == STATUS_ERR_BAD_DATA && sample.t_ticks == 0);
+    CHECK(sample.seq == 1);
+    sht_sysfs_close(&dev);
+    CHECK(dev.temperature_fd == -1 && dev.humidity_fd == -1);
+
+    /* any location takes the first match of the driver */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT3X, -1, 0) == 0);
+    sht_sysfs_close(&dev);
+
+    /* IIO: (raw + offset) * scale */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT4X, 2, 0x44) == 0);
+    CHECK(dev.iio == 1);
+    CHECK(sht_sysfs_read(&dev, &t, &rh) == 0);
+    CHECK(t == 22050 && rh == 50000);
+    sht_sysfs_close(&dev);
+
+    /* lookup failures */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHTC1, -1, 0) ==
+          STATUS_UNKNOWN_DEVICE);
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT3X, 3, 0x44) ==
+          STATUS_UNKNOWN_DEVICE);
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT4X, 2, 0x45) ==
+          STATUS_UNKNOWN_DEVICE);
+    CHECK(sht_sysfs_open(&dev, root, 7, -1, 0) == STATUS_ERR_INVALID_PARAMS);
+
+    /* a device without the humidity attribute */
+    CHECK(sht_sysfs_open(&dev, root, SHT_FAMILY_SHT3X, 4, 0x44) ==
+          STATUS_ERR_IO);
+    CHECK(dev.temperature_fd == -1 && dev.humidity_fd == -1);
+
+    sht_sysfs_tree_remove(root);
+
+    if (failures) {
+        printf("test_sysfs: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_sysfs: ok\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C++11 unit types: every conversion of sht_units.h agrees with the C
+ * function it mirrors over the whole input range, the literals and
+ * conversions are evaluated at compile time, and quantities of different
+ * units do not convert into each other.
+ */
+
+#include "sensirion_humidity_conversion.h"
+#include "sensirion_temperature_unit_conversion.h"
+#include "sht3x.h"
+#include "sht_sample.h"
+#include "sht_units.h"
+
+#include <cstdio>
+#include <type_traits>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+using namespace sht::literals;
+
+static int failures;
+
+/* evaluated by the compiler */
+static_assert((25_degC).value() == 25000, "integer literal");
+static_assert((12.5_degC).value() == 12500, "floating point literal");
+static_assert((45.25_pctRH).value() == 45250, "humidity literal");
+static_assert(sht::to_fahrenheit(100_degC).value() == 212004, "fahrenheit");
+static_assert(sht::temperature_to_ticks(60_degC) > 0, "ticks");
+static_assert(sht::absolute_humidity(20_degC, 50_pctRH).value() > 0,
+              "absolute humidity");
+
+/* a value needs its unit spelled out */
+static_assert(!std::is_convertible<int32_t, sht::milli_celsius>::value,
+              "implicit from int");
+static_assert(
+    !std::is_convertible<sht::milli_celsius, sht::milli_fahrenheit>::value,
+    "celsius to fahrenheit");
+static_assert(
+    !std::is_convertible<sht::milli_percent_rh, sht::milli_celsius>::value,
+    "humidity to temperature");
+static_assert(sizeof(sht::milli_celsius) == sizeof(int32_t), "no overhead");
+
+static void test_ticks() {
+    sht_raw_sample_t sample = sht_raw_sample_t();
+    int32_t t;
+    int32_t rh;
+    uint16_t c_tick;
+    uint32_t tick;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        tick_to_temperature(static_cast<uint16_t>(tick), &t);
+        tick_to_humidity(static_cast<uint16_t>(tick), &rh);
+        CHECK(sht::temperature_from_ticks(static_cast<uint16_t>(tick)) ==
+              sht::milli_celsius(t));
+        CHECK(sht::humidity_from_ticks(static_cast<uint16_t>(tick)) ==
+              sht::milli_percent_rh(rh));
+
+        sample.t_ticks = static_cast<uint16_t>(tick);
+        sample.rh_ticks = static_cast<uint16_t>(tick);
+        sample.family = SHT_FAMILY_SHT4X;
+        sht_raw_sample_convert(&sample, &t, &rh);
+        CHECK(sht::humidity_from_ticks_sht4x(static_cast<uint16_t>(tick)) ==
+              sht::milli_percent_rh(rh));
+    }
+
+    for (t = -45000; t <= 130000; t += 7) {
+        temperature_to_tick(t, &c_tick);
+        CHECK(sht::temperature_to_ticks(sht::milli_celsius(t)) == c_tick);
+    }
+    for (rh = 0; rh <= 100000; rh += 3) {
+        humidity_to_tick(rh, &c_tick);
+        CHECK(sht::humidity_to_ticks(sht::milli_percent_rh(rh)) == c_tick);
+    }
+}
+
+static void test_conversions() {
+    int32_t t;
+    int32_t rh;
+
+    for (t = -60000; t <= 150000; t += 13) {
+        CHECK(sht::to_fahrenheit(sht::milli_celsius(t)).value() ==
+              sensirion_celsius_to_fahrenheit(t));
+        CHECK(sht::to_celsius(sht::milli_fahrenheit(t)).value() ==
+              sensirion_fahrenheit_to_celsius(t));
+    }
+    for (t = -30000; t <= 80000; t += 251) {
+        for (rh = -1000; rh <= 101000; rh += 997) {
+            CHECK(sht::absolute_humidity(sht::milli_celsius(t),
+                                         sht::milli_percent_rh(rh))
+                      .value() == sensirion_calc_absolute_humidity(t, rh));
+        }
+    }
+}
+
+static void test_operators() {
+    sht::milli_celsius a = 20_degC;
+    sht::milli_celsius b = 21.5_degC;
+
+    CHECK(a < b && b > a && a <= a && b >= a && a != b);
+    CHECK(b - a == 1.5_degC);
+    CHECK(a + b == 41.5_degC);
+    /* the fixed point factors round by a few milli degrees */
+    CHECK(sht::to_celsius(sht::to_fahrenheit(a)) > a - 0.01_degC);
+    CHECK(sht::to_celsius(sht::to_fahrenheit(a)) < a + 0.01_degC);
+}
+
+int main() {
+    test_ticks();
+    test_conversions();
+    test_operators();
+    if (failures) {
+        printf("test_units: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_units: ok\n");
+    return 0;
+}
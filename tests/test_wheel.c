@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026, sensirion-embedded-sht-lib contributors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Timing wheel: timers on every level cascade down and expire exactly on
+ * their tick while the tick counter wraps around, expiries beyond the wheel
+ * span are clamped and past ones fire on the next tick, timers cancelled or
+ * re-armed from a callback behave, and the sensor state machine produces one
+ * sample per period on the simulated bus, retries included.
+ */
+
+#include "sht_i2c_sim.h"
+#include "sht_wheel.h"
+
+#include <stdio.h>
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#define NUM_TIMERS 256
+/* the span of the wheel ends after the wrap-around */
+#define START_TICK ((uint32_t)(0xFFFFFFFFU - SHT_WHEEL_MAX_DELTA / 2))
+#define SPAN ((uint32_t)SHT_WHEEL_MAX_DELTA)
+
+static int failures;
+
+typedef struct _test_timer {
+    sht_wheel_timer_t timer; /* first member */
+    uint32_t fired_tick;
+    uint32_t fired;
+    struct _test_timer* cancel; /* cancelled when this one fires */
+    uint8_t rearm;              /* re-armed for the current tick once */
+} test_timer_t;
+
+static test_timer_t timers[NUM_TIMERS];
+static uint32_t last_tick;
+static uint32_t out_of_order;
+
+static uint32_t rng = 1;
+
+static uint32_t random_u32(void) {
+    rng = rng * 1103515245U + 12345U;
+    return rng;
+}
+
+static void on_expire(sht_wheel_t* wheel, sht_wheel_timer_t* timer,
+                      void* user_data) {
+    test_timer_t* t = (test_timer_t*)timer;
+    uint32_t tick = wheel->now - 1;
+
+    if ((int32_t)(tick - last_tick) < 0)
+        out_of_order++;
+    last_tick = tick;
+    t->fired_tick = tick;
+    t->fired++;
+    if (t->cancel)
+        sht_wheel_cancel(&t->cancel->timer);
+    if (t->rearm) {
+        t->rearm = 0;
+        sht_wheel_add(wheel, timer, tick, timer->event);
+    }
+}
+
+static void reset_timers(void) {
+    uint16_t i;
+
+    for (i = 0; i < NUM_TIMERS; ++i) {
+        timers[i].timer.next = NULL;
+        timers[i].timer.pprev = NULL;
+        timers[i].fired = 0;
+        timers[i].cancel = NULL;
+        timers[i].rearm = 0;
+    }
+}
+
+static void test_cascade(void) {
+    static const uint32_t edges[] = {
+        0,
+        1,
+        SHT_WHEEL_SLOTS - 1,
+        SHT_WHEEL_SLOTS,
+        SHT_WHEEL_SLOTS + 1,
+        SHT_WHEEL_SLOTS * SHT_WHEEL_SLOTS - 1,
+        SHT_WHEEL_SLOTS * SHT_WHEEL_SLOTS,
+        SHT_WHEEL_SLOTS * SHT_WHEEL_SLOTS + 1,
+        SHT_WHEEL_MAX_DELTA / SHT_WHEEL_SLOTS,
+        SHT_WHEEL_MAX_DELTA / SHT_WHEEL_SLOTS + 1,
+        SHT_WHEEL_MAX_DELTA - 1,
+        SHT_WHEEL_MAX_DELTA,
+    };
+    const uint16_t num_edges = sizeof(edges) / sizeof(edges[0]);
+    sht_wheel_t wheel;
+    uint32_t want[NUM_TIMERS];
+    uint32_t now = START_TICK;
+    uint32_t end = START_TICK + SPAN;
+    uint32_t expired = 0;
+    uint32_t step;
+    uint16_t i;
+
+    reset_timers();
+    last_tick = START_TICK;
+    out_of_order = 0;
+    sht_wheel_init(&wheel, START_TICK, 1000);
+    for (i = 0; i < NUM_TIMERS; ++i) {
+        /* the edges of every level, then random distances */
+        want[i] = START_TICK + (i < num_edges
+                                    ? edges[i]
+                                    : random_u32() % (SHT_WHEEL_MAX_DELTA + 1));
+        sht_wheel_add(&wheel, &timers[i].timer, want[i], 0);
+    }
+
+    /* uneven steps, some of them across many slots of level 0 */
+    while ((int32_t)(end - now) > 0) {
+        step = random_u32() % 4 ? random_u32() % 64 : random_u32() % 100000;
+        now = (int32_t)(end - now) > (int32_t)step ? now + step : end;
+        expired += sht_wheel_advance(&wheel, now, on_expire, NULL);
+    }
+
+    CHECK(expired == NUM_TIMERS);
+    CHECK(out_of_order == 0);
+    for (i = 0; i < NUM_TIMERS; ++i) {
+        CHECK(timers[i].fired == 1);
+        CHECK(timers[i].fired_tick == want[i]);
+        CHECK(!timers[i].timer.pprev);
+    }
+    CHECK(wheel.now == end + 1);
+    CHECK(wheel.now < START_TICK);
+}
+
+static void test_overflow(void) {
+    sht_wheel_t wheel;
+    uint32_t start = 0xFFFFFF00U;
+
+    reset_timers();
+    last_tick = start;
+    sht_wheel_init(&wheel, start, 1000);
+
+    /* beyond the span: clamped to the last tick it covers */
+    sht_wheel_add(&wheel, &timers[0].timer, start + SPAN + 5000, 0);
+    CHECK(timers[0].timer.expires == start + SPAN);
+    /* in the past: expires on the next advance */
+    sht_wheel_add(&wheel, &timers[1].timer, start - 10, 0);
+    CHECK(timers[1].timer.expires == start);
+    /* moved by a second add */
+    sht_wheel_add(&wheel, &timers[2].timer, start + 10, 0);
+    sht_wheel_add(&wheel, &timers[2].timer, start + 300, 0);
+
+    CHECK(sht_wheel_advance(&wheel, start, on_expire, NULL) == 1);
+    CHECK(timers[1].fired == 1 && timers[1].fired_tick == start);
+    CHECK(sht_wheel_advance(&wheel, start + 299, on_expire, NULL) == 0);
+    CHECK(sht_wheel_advance(&wheel, start + 300, on_expire, NULL) == 1);
+    CHECK(timers[2].fired == 1 && timers[2].fired_tick == start + 300);
+    CHECK(sht_wheel_advance(&wheel, start + SPAN - 1, on_expire, NULL) == 0);
+    CHECK(sht_wheel_advance(&wheel, start + SPAN, on_expire, NULL) == 1);
+    CHECK(timers[0].fired == 1 && timers[0].fired_tick == start + SPAN);
+}
+
+static void test_callbacks(void) {
+    sht_wheel_t wheel;
+
+    reset_timers();
+    last_tick = 0;
+    sht_wheel_init(&wheel, 0, 1000);
+
+    /* three timers in one slot: the first one to fire cancels another one
+     * of the detached list and re-arms itself for the current tick */
+    sht_wheel_add(&wheel, &timers[0].timer, 40, 0);
+    sht_wheel_add(&wheel, &timers[1].timer, 40, 0);
+    sht_wheel_add(&wheel, &timers[2].timer, 40, 0);
+    /* the list is last in, first out */
+    timers[2].cancel = &timers[1];
+    timers[2].rearm = 1;
+    /* cancelled before it fires */
+    sht_wheel_add(&wheel, &timers[3].timer, 20, 0);
+    sht_wheel_cancel(&timers[3].timer);
+    sht_wheel_cancel(&timers[3].timer);
+
+    CHECK(sht_wheel_advance(&wheel, 40, on_expire, NULL) == 2);
+    CHECK(timers[0].fired == 1 && timers[1].fired == 0);
+    CHECK(timers[2].fired == 1 && timers[2].timer.pprev);
+    CHECK(timers[3].fired == 0);
+    CHECK(sht_wheel_advance(&wheel, 41, on_expire, NULL) == 1);
+    CHECK(timers[2].fired == 2 && timers[2].fired_tick == 41);
+}
+
+static uint32_t num_samples;
+static uint32_t failed_samples;
+static uint32_t sample_ticks[16];
+
+static void on_sample(void* user_data, const sht_raw_sample_t* sample) {
+    if (sample->status != 0)
+        failed_samples++;
+    if (num_samples < 16)
+        sample_ticks[num_samples] = sample->timestamp_ms;
+    num_samples++;
+}
+
+static void test_sensor(void) {
+    sht_handle_t handle = {NULL, 0, 0, 0, 0, 0, 0x44, SHT_FAMILY_SHT3X};
+    sht_wheel_sensor_t sensor;
+    sht_wheel_t wheel;
+    uint8_t dev;
+    uint32_t t;
+
+    /* 1 ms ticks, a sample every 100 ms, 2 retries 5 ms apart */
+    sht_i2c_sim_init();
+    dev = sht_i2c_sim_add_sensor(0, SHT_I2C_SIM_ROOT, 0, 0x44,
+                                 SHT_FAMILY_SHT3X, 1);
+    sht_wheel_init(&wheel, 0, 1000);
+    sht_wheel_sensor_start(&wheel, &sensor, &handle, 100, 5, 2, 10);
+    for (t = 0; t < 1000; ++t) {
+        sht_i2c_sim.now_usec = (uint64_t)t * 1000;
+        sht_wheel_run_sensors(&wheel, t, on_sample, NULL);
+    }
+    CHECK(num_samples == 10 && failed_samples == 0);
+    /* read in the tick after the conversion, which starts once the measure
+     * command is on the bus, not earlier */
+    CHECK(sht_i2c_sim.nacks == 0);
+    CHECK(sample_ticks[0] ==
+          10 + sht_handle_measurement_duration_usec(&handle) / 1000 + 1);
+    CHECK(sample_ticks[9] - sample_ticks[0] == 900);
+
+    /* gone: each period retries twice, then reports a failed sample */
+    sht_i2c_sim.devices[dev].present = 0;
+    sht_i2c_sim.nacks = 0;
+    for (; t < 2000; ++t) {
+        sht_i2c_sim.now_usec = (uint64_t)t * 1000;
+        sht_wheel_run_sensors(&wheel, t, on_sample, NULL);
+    }
+    CHECK(num_samples == 20 && failed_samples == 10);
+    CHECK(sht_i2c_sim.nacks == 10 * 3);
+}
+
+int main(void) {
+    test_cascade();
+    test_overflow();
+    test_callbacks();
+    test_sensor();
+    if (failures) {
+        printf("test_wheel: %d failures\n", failures);
+        return 1;
+    }
+    printf("test_wheel: ok\n");
+    return 0;
+}